@@ -0,0 +1,270 @@
+/* victor-bench: latency and reciprocal throughput of Victor's
+ * operations through the C API, the C++ API, and the raw intrinsics,
+ * written to stdout as JSON.
+ *
+ *   victor-bench [-n ITERATIONS] [-r REPEATS] [-p] [-o RATIO] [-l] [FILTER...]
+ *
+ * Each kernel is run REPEATS times and the fastest run is reported, in
+ * TSC ticks per operation.  The TSC ticks at a fixed rate, which is
+ * only the core clock if turbo is off, so compare numbers from the
+ * same machine (or lock the frequency).  FILTERs are substrings of
+ * operation names, e.g. "i8x16_" or "_add".
+ *
+ * The table is a sample of the API, not all of it; -l lists what a
+ * build has.  f32x4, i32x4 and i8x16 get the arithmetic, bitwise and
+ * shift operators, select on a comparison, a shuffle, a conversion
+ * and back, a store and load (whole and partial), gather and the
+ * reductions.  i16x8, u8x16, f64x2 and the 256- and 512-bit types get
+ * a few operations each, when the target has them.
+ *
+ * -p adds hardware counters (see perf.h) for the throughput kernel:
+ * core cycles, instructions, uops, L1D/L2 misses and branch misses per
+ * operation, IPC, and cycles per element.  ns_per_element, from the
+ * wall clock, is always reported, so there is still a per-element cost
+ * when the counters can't be opened.
+ *
+ * Where there is a raw version of an operation, the C and C++ entries
+ * also get "overhead", their throughput relative to the raw one.  It
+ * should be 1 in optimized builds; in debug builds it's what the
+ * wrappers cost, and -o makes victor-bench fail if any entry exceeds
+ * RATIO ("make check-debug" uses it at -O0 and -Og).  Where there is a
+ * "scalar" version instead (a plain loop over the lanes, for the
+ * reductions), the others get "speedup", its throughput divided by
+ * theirs. */
+
+#include "victor/victor.h"
+#include "victor/dispatch.h"
+#include "bench.h"
+#include "perf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_X_ONES \
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+
+float bench_f32_ones[16] = { BENCH_X_ONES };
+int32_t bench_i32_ones[16] = { BENCH_X_ONES };
+float bench_f32_scratch[16] __attribute__((__aligned__(64)));
+int32_t bench_i32_scratch[16] __attribute__((__aligned__(64)));
+int8_t bench_i8_scratch[64] __attribute__((__aligned__(64)));
+size_t bench_zero = 0;
+size_t bench_partial_count = 3;
+
+static struct bench_op* bench_ops = NULL;
+static size_t bench_ops_count = 0;
+
+void bench_register(struct bench_op* op) {
+  op->next = bench_ops;
+  bench_ops = op;
+  bench_ops_count++;
+}
+
+static const char* bench_tier_name(int tier) {
+  switch (tier) {
+    case VICTOR_TIER_SSE2: return "sse2";
+    case VICTOR_TIER_SSE4_1: return "sse4.1";
+    case VICTOR_TIER_AVX2: return "avx2";
+    case VICTOR_TIER_AVX512: return "avx512";
+    default: return "none";
+  }
+}
+
+/* By name, then c, cxx, raw, scalar, so the versions of an operation
+   end up next to each other. */
+static int bench_op_compare(const void* a, const void* b) {
+  const struct bench_op* x = *((const struct bench_op* const*) a);
+  const struct bench_op* y = *((const struct bench_op* const*) b);
+  int r = strcmp(x->name, y->name);
+  return (r != 0) ? r : strcmp(x->api, y->api);
+}
+
+static int bench_selected(const struct bench_op* op, int nfilters, char** filters) {
+  int i;
+
+  if (nfilters == 0)
+    return 1;
+  for (i = 0 ; i < nfilters ; i++)
+    if (strstr(op->name, filters[i]) != NULL)
+      return 1;
+  return 0;
+}
+
+struct bench_run {
+  uint64_t ticks;
+  uint64_t ns;
+  struct bench_counts counts;
+};
+
+/* Keeps the fastest of REPEATS runs, with the wall-clock time and
+   counters from that same run. */
+static void bench_fastest(struct bench_run* best, bench_kernel kernel, size_t iterations, int repeats, int counters) {
+  struct bench_run run;
+  uint64_t begin;
+  int i;
+
+  /* One run first so the caches, the branch predictor and the clock
+     have settled before we start counting. */
+  kernel(iterations);
+  best->ticks = UINT64_MAX;
+  for (i = 0 ; i < repeats ; i++) {
+    if (counters)
+      bench_counters_start();
+    begin = bench_now_ns();
+    run.ticks = kernel(iterations);
+    run.ns = bench_now_ns() - begin;
+    if (counters)
+      bench_counters_stop(&run.counts);
+    if (run.ticks < best->ticks)
+      *best = run;
+  }
+}
+
+static void bench_print_counters(const struct bench_counts* counts, double ops, double elements) {
+  const uint64_t* v = counts->value;
+  const char* sep = "";
+  int i;
+
+  if (v[BENCH_CYCLES] != BENCH_COUNTER_UNAVAILABLE) {
+    printf(", \"cycles_per_element\": %.4f", (double) v[BENCH_CYCLES] / elements);
+    if (v[BENCH_INSTRUCTIONS] != BENCH_COUNTER_UNAVAILABLE && v[BENCH_CYCLES] != 0)
+      printf(", \"ipc\": %.3f", (double) v[BENCH_INSTRUCTIONS] / (double) v[BENCH_CYCLES]);
+  }
+  printf(", \"per_op\": {");
+  for (i = 0 ; i < BENCH_COUNTERS ; i++) {
+    if (v[i] != BENCH_COUNTER_UNAVAILABLE) {
+      printf("%s \"%s\": %.4f", sep, bench_counter_name((enum bench_counter) i), (double) v[i] / ops);
+      sep = ",";
+    }
+  }
+  printf(" }");
+}
+
+static void bench_usage(FILE* stream, const char* argv0) {
+  fprintf(stream, "usage: %s [-n ITERATIONS] [-r REPEATS] [-p] [-o RATIO] [-l] [FILTER...]\n", argv0);
+}
+
+int main(int argc, char** argv) {
+  size_t iterations = 1000000;
+  int repeats = 10;
+  int list = 0;
+  int counters = 0;
+  double max_overhead = 0.0;
+  int status = EXIT_SUCCESS;
+  int argi;
+  struct bench_op** ops;
+  struct bench_op* op;
+  struct bench_run* latency;
+  struct bench_run* throughput;
+  size_t i, j, n;
+  const char* sep = "";
+
+  for (argi = 1 ; argi < argc && argv[argi][0] == '-' ; argi++) {
+    if (strcmp(argv[argi], "-n") == 0 && argi + 1 < argc) {
+      iterations = strtoul(argv[++argi], NULL, 0);
+    } else if (strcmp(argv[argi], "-r") == 0 && argi + 1 < argc) {
+      repeats = atoi(argv[++argi]);
+    } else if (strcmp(argv[argi], "-o") == 0 && argi + 1 < argc) {
+      max_overhead = strtod(argv[++argi], NULL);
+    } else if (strcmp(argv[argi], "-p") == 0) {
+      counters = 1;
+    } else if (strcmp(argv[argi], "-l") == 0) {
+      list = 1;
+    } else if (strcmp(argv[argi], "-h") == 0) {
+      bench_usage(stdout, argv[0]);
+      return EXIT_SUCCESS;
+    } else {
+      bench_usage(stderr, argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (iterations == 0 || repeats < 1) {
+    bench_usage(stderr, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  ops = (struct bench_op**) malloc(bench_ops_count * sizeof(ops[0]));
+  latency = (struct bench_run*) malloc(bench_ops_count * sizeof(latency[0]));
+  throughput = (struct bench_run*) malloc(bench_ops_count * sizeof(throughput[0]));
+  if (ops == NULL || latency == NULL || throughput == NULL)
+    return EXIT_FAILURE;
+  for (n = 0, op = bench_ops ; op != NULL ; op = op->next)
+    if (bench_selected(op, argc - argi, argv + argi))
+      ops[n++] = op;
+  qsort(ops, n, sizeof(ops[0]), bench_op_compare);
+
+  if (list) {
+    for (i = 0 ; i < n ; i++)
+      printf("%s %s\n", ops[i]->name, ops[i]->api);
+    free(ops);
+    free(latency);
+    free(throughput);
+    return EXIT_SUCCESS;
+  }
+
+  if (counters && bench_counters_open() == 0) {
+    fprintf(stderr, "%s: no hardware counters available, using the wall clock only\n", argv[0]);
+    counters = 0;
+  }
+
+  printf("{\n");
+  printf("  \"tier\": \"%s\",\n", bench_tier_name(VICTOR_TIER));
+  printf("  \"cpu_tier\": \"%s\",\n", bench_tier_name(victor_dispatch_tier()));
+  printf("  \"unit\": \"tsc_ticks\",\n");
+  printf("  \"counters\": \"%s\",\n", counters ? "perf" : "none");
+  printf("  \"streams\": %d,\n", BENCH_STREAMS);
+  printf("  \"iterations\": %lu,\n", (unsigned long) iterations);
+  printf("  \"repeats\": %d,\n", repeats);
+  printf("  \"results\": [");
+  for (i = 0 ; i < n ; i = j) {
+    const struct bench_run* raw = NULL;
+    const struct bench_run* scalar = NULL;
+
+    /* Run every version of this operation before printing any, so
+       the C and C++ entries can be compared with the raw or scalar
+       one. */
+    for (j = i ; j < n && strcmp(ops[j]->name, ops[i]->name) == 0 ; j++) {
+      bench_fastest(&latency[j], ops[j]->latency, iterations, repeats, 0);
+      bench_fastest(&throughput[j], ops[j]->throughput, iterations, repeats, counters);
+      if (strcmp(ops[j]->api, "raw") == 0)
+        raw = &throughput[j];
+      else if (strcmp(ops[j]->api, "scalar") == 0)
+        scalar = &throughput[j];
+    }
+
+    for ( ; i < j ; i++) {
+      const double ops_run = (double) iterations * BENCH_STREAMS;
+      const double elements = ops_run * ops[i]->lanes;
+
+      printf("%s\n    { \"op\": \"%s\", \"api\": \"%s\", \"lanes\": %u, \"latency\": %.3f, \"throughput\": %.3f, \"ns_per_element\": %.4f",
+        sep, ops[i]->name, ops[i]->api, ops[i]->lanes,
+        (double) latency[i].ticks / (double) iterations,
+        (double) throughput[i].ticks / ops_run,
+        (double) throughput[i].ns / elements);
+      if (raw != NULL && raw != &throughput[i]) {
+        const double overhead = (double) throughput[i].ticks / (double) raw->ticks;
+        printf(", \"overhead\": %.3f", overhead);
+        if (max_overhead > 0.0 && overhead > max_overhead) {
+          fprintf(stderr, "%s: %s (%s) is %.2fx the raw intrinsics\n", argv[0], ops[i]->name, ops[i]->api, overhead);
+          status = EXIT_FAILURE;
+        }
+      }
+      if (scalar != NULL && scalar != &throughput[i])
+        printf(", \"speedup\": %.3f", (double) scalar->ticks / (double) throughput[i].ticks);
+      if (counters)
+        bench_print_counters(&throughput[i].counts, ops_run, elements);
+      printf(" }");
+      sep = ",";
+    }
+    fflush(stdout);
+  }
+  printf("\n  ]\n}\n");
+
+  if (counters)
+    bench_counters_close();
+  free(ops);
+  free(latency);
+  free(throughput);
+  return status;
+}
@@ -0,0 +1,147 @@
+/* Latency/throughput harness for victor-bench.
+ *
+ * Each operation gets two kernels.  The latency kernel feeds the
+ * result of every call into the next one, so it measures how long one
+ * call takes from input to output; the throughput kernel keeps
+ * BENCH_STREAMS independent chains going, so it measures how often a
+ * new call can start.  Both return elapsed TSC ticks.
+ *
+ * BENCH_OP() defines the kernels and registers them, so ops-c.c and
+ * ops-cxx.cc can put an operation inside an #if without also having to
+ * keep a table in sync. */
+
+#if !defined(VICTOR_BENCH_H)
+#define VICTOR_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <x86intrin.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Enough to cover latency 4, two per cycle, which is where most
+   vector ALU and FMA operations are today. */
+#define BENCH_STREAMS 8
+
+typedef uint64_t (*bench_kernel)(size_t iterations);
+
+struct bench_op {
+  const char* name;
+  const char* api;
+  unsigned lanes;
+  bench_kernel latency;
+  bench_kernel throughput;
+  struct bench_op* next;
+};
+
+void bench_register(struct bench_op* op);
+
+/* Memory for the load, store and gather kernels, defined in bench.c.
+   None of it is const, so the compiler can't fold the loads.  The
+   store_load kernels read from scratch + bench_zero, so the load isn't
+   replaced with the value just stored, and bench_partial_count (3)
+   keeps load_partial and store_partial from being specialized for one
+   count.  The *_ones tables are all 1, so a gather which uses its
+   result as the next index stays in bounds. */
+extern float bench_f32_ones[16];
+extern int32_t bench_i32_ones[16];
+extern float bench_f32_scratch[16];
+extern int32_t bench_i32_scratch[16];
+extern int8_t bench_i8_scratch[64];
+extern size_t bench_zero;
+extern size_t bench_partial_count;
+
+/* rdtsc can run ahead of (or behind) the code it's timing; the fences
+   keep the kernel between the two reads. */
+static inline uint64_t bench_ticks_begin(void) {
+  uint64_t t;
+  _mm_lfence();
+  t = __rdtsc();
+  _mm_lfence();
+  return t;
+}
+
+static inline uint64_t bench_ticks_end(void) {
+  unsigned int aux;
+  uint64_t t = __rdtscp(&aux);
+  _mm_lfence();
+  return t;
+}
+
+/* Makes the compiler forget what it knows about a value without
+   emitting any code, so it can't fold x * 1.0f or x & ~0 away, hoist
+   the operation out of the loop, or merge the chains.  The C++
+   kernels overload bench_opaque() for Victor's classes. */
+#if !defined(__cplusplus)
+  #define bench_opaque(v) __asm__ __volatile__("" : "+x" (v))
+#endif
+
+#define BENCH_X_OPAQUE(i) bench_opaque(x##i)
+
+/* Defines bench_<api>_<name> for expr, an expression in x (the chained
+   value) and y (a loop-invariant operand), and registers it.  The op
+   function is always inlined; otherwise -Og inlines it for some APIs
+   and not others, and the call dwarfs what we're trying to measure. */
+#define BENCH_OP(api, name, T, lanes, init_x, init_y, expr) \
+  static inline __attribute__((__always_inline__)) T bench_##api##_##name##_op(T x, T y) { \
+    (void) y; \
+    return (expr); \
+  } \
+  \
+  static uint64_t bench_##api##_##name##_latency(size_t iterations) { \
+    T x = (init_x), y = (init_y); \
+    uint64_t begin, end; \
+    size_t i; \
+    bench_opaque(y); \
+    begin = bench_ticks_begin(); \
+    for (i = 0 ; i < iterations ; i++) { \
+      x = bench_##api##_##name##_op(x, y); \
+      bench_opaque(x); \
+    } \
+    end = bench_ticks_end(); \
+    bench_opaque(x); \
+    return end - begin; \
+  } \
+  \
+  static uint64_t bench_##api##_##name##_throughput(size_t iterations) { \
+    T x0 = (init_x), x1 = x0, x2 = x0, x3 = x0, x4 = x0, x5 = x0, x6 = x0, x7 = x0; \
+    T y = (init_y); \
+    uint64_t begin, end; \
+    size_t i; \
+    bench_opaque(y); \
+    begin = bench_ticks_begin(); \
+    for (i = 0 ; i < iterations ; i++) { \
+      BENCH_X_UNROLL(bench_##api##_##name##_op); \
+    } \
+    end = bench_ticks_end(); \
+    BENCH_X_FOREACH(BENCH_X_OPAQUE); \
+    return end - begin; \
+  } \
+  \
+  static struct bench_op bench_##api##_##name = { \
+    #name, #api, (lanes), \
+    bench_##api##_##name##_latency, \
+    bench_##api##_##name##_throughput, \
+    NULL \
+  }; \
+  \
+  __attribute__((__constructor__)) \
+  static void bench_##api##_##name##_register(void) { \
+    bench_register(&bench_##api##_##name); \
+  }
+
+#define BENCH_X_FOREACH(m) \
+  m(0); m(1); m(2); m(3); m(4); m(5); m(6); m(7)
+
+#define BENCH_X_UNROLL(op) \
+  x0 = op(x0, y); x1 = op(x1, y); x2 = op(x2, y); x3 = op(x3, y); \
+  x4 = op(x4, y); x5 = op(x5, y); x6 = op(x6, y); x7 = op(x7, y); \
+  BENCH_X_FOREACH(BENCH_X_OPAQUE)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* !defined(VICTOR_BENCH_H) */
@@ -0,0 +1,307 @@
+/* Victor's C API, and the intrinsics it wraps as a baseline.  Emulated
+   operations (i8x16 multiplication and shifts, for example) have no
+   single intrinsic to compare against, so they only get a "c" entry.
+   Reductions have no single intrinsic either; their baseline is a
+   "scalar" entry which copies the lanes out and loops over them, which
+   is what you would write without Victor. */
+
+#include "victor/victor.h"
+#include "bench.h"
+
+#include <string.h>
+
+#define C_F32X4(name, expr) \
+  BENCH_OP(c, f32x4_##name, victor_f32x4, 4, victor_f32x4_set1(1.0f), victor_f32x4_set1(1.0f), expr)
+#define RAW_F32X4(name, expr) \
+  BENCH_OP(raw, f32x4_##name, __m128, 4, _mm_set1_ps(1.0f), _mm_set1_ps(1.0f), expr)
+#define C_I32X4(name, expr) \
+  BENCH_OP(c, i32x4_##name, victor_i32x4, 4, victor_i32x4_set1(1), victor_i32x4_set1(1), expr)
+#define RAW_I32X4(name, expr) \
+  BENCH_OP(raw, i32x4_##name, __m128i, 4, _mm_set1_epi32(1), _mm_set1_epi32(1), expr)
+#define C_I8X16(name, expr) \
+  BENCH_OP(c, i8x16_##name, victor_i8x16, 16, victor_i8x16_set1(1), victor_i8x16_set1(1), expr)
+#define RAW_I8X16(name, expr) \
+  BENCH_OP(raw, i8x16_##name, __m128i, 16, _mm_set1_epi8(1), _mm_set1_epi8(1), expr)
+#define C_I16X8(name, expr) \
+  BENCH_OP(c, i16x8_##name, victor_i16x8, 8, victor_i16x8_set1(1), victor_i16x8_set1(1), expr)
+#define RAW_I16X8(name, expr) \
+  BENCH_OP(raw, i16x8_##name, __m128i, 8, _mm_set1_epi16(1), _mm_set1_epi16(1), expr)
+#define C_U8X16(name, expr) \
+  BENCH_OP(c, u8x16_##name, victor_u8x16, 16, victor_u8x16_set1(1), victor_u8x16_set1(1), expr)
+#define RAW_U8X16(name, expr) \
+  BENCH_OP(raw, u8x16_##name, __m128i, 16, _mm_set1_epi8(1), _mm_set1_epi8(1), expr)
+#define C_F64X2(name, expr) \
+  BENCH_OP(c, f64x2_##name, victor_f64x2, 2, victor_f64x2_set1(1.0), victor_f64x2_set1(1.0), expr)
+#define RAW_F64X2(name, expr) \
+  BENCH_OP(raw, f64x2_##name, __m128d, 2, _mm_set1_pd(1.0), _mm_set1_pd(1.0), expr)
+#define C_F32X8(name, expr) \
+  BENCH_OP(c, f32x8_##name, victor_f32x8, 8, victor_f32x8_set1(1.0f), victor_f32x8_set1(1.0f), expr)
+#define RAW_F32X8(name, expr) \
+  BENCH_OP(raw, f32x8_##name, __m256, 8, _mm256_set1_ps(1.0f), _mm256_set1_ps(1.0f), expr)
+#define C_I32X8(name, expr) \
+  BENCH_OP(c, i32x8_##name, victor_i32x8, 8, victor_i32x8_set1(1), victor_i32x8_set1(1), expr)
+#define RAW_I32X8(name, expr) \
+  BENCH_OP(raw, i32x8_##name, __m256i, 8, _mm256_set1_epi32(1), _mm256_set1_epi32(1), expr)
+#define C_I8X32(name, expr) \
+  BENCH_OP(c, i8x32_##name, victor_i8x32, 32, victor_i8x32_set1(1), victor_i8x32_set1(1), expr)
+#define RAW_I8X32(name, expr) \
+  BENCH_OP(raw, i8x32_##name, __m256i, 32, _mm256_set1_epi8(1), _mm256_set1_epi8(1), expr)
+#define C_F32X16(name, expr) \
+  BENCH_OP(c, f32x16_##name, victor_f32x16, 16, victor_f32x16_set1(1.0f), victor_f32x16_set1(1.0f), expr)
+#define RAW_F32X16(name, expr) \
+  BENCH_OP(raw, f32x16_##name, __m512, 16, _mm512_set1_ps(1.0f), _mm512_set1_ps(1.0f), expr)
+#define C_I32X16(name, expr) \
+  BENCH_OP(c, i32x16_##name, victor_i32x16, 16, victor_i32x16_set1(1), victor_i32x16_set1(1), expr)
+#define RAW_I32X16(name, expr) \
+  BENCH_OP(raw, i32x16_##name, __m512i, 16, _mm512_set1_epi32(1), _mm512_set1_epi32(1), expr)
+#define C_I8X64(name, expr) \
+  BENCH_OP(c, i8x64_##name, victor_i8x64, 64, victor_i8x64_set1(1), victor_i8x64_set1(1), expr)
+#define RAW_I8X64(name, expr) \
+  BENCH_OP(raw, i8x64_##name, __m512i, 64, _mm512_set1_epi8(1), _mm512_set1_epi8(1), expr)
+
+/* Without SSE4.1 a blend needs the mask twice, so it can't be written
+   as one expression. */
+static inline __m128 raw_f32x4_select(__m128 mask, __m128 a, __m128 b) {
+  #if defined(VICTOR_ENABLE_SSE4_1)
+    return _mm_blendv_ps(b, a, mask);
+  #else
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+  #endif
+}
+
+static inline __m128i raw_si128_select(__m128i mask, __m128i a, __m128i b) {
+  #if defined(VICTOR_ENABLE_SSE4_1)
+    return _mm_blendv_epi8(b, a, mask);
+  #else
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+  #endif
+}
+
+/* f32x4 */
+C_F32X4(add, victor_f32x4_add(x, y))
+RAW_F32X4(add, _mm_add_ps(x, y))
+C_F32X4(sub, victor_f32x4_sub(x, y))
+RAW_F32X4(sub, _mm_sub_ps(x, y))
+C_F32X4(mul, victor_f32x4_mul(x, y))
+RAW_F32X4(mul, _mm_mul_ps(x, y))
+C_F32X4(div, victor_f32x4_div(x, y))
+RAW_F32X4(div, _mm_div_ps(x, y))
+C_F32X4(and, victor_f32x4_and(x, y))
+RAW_F32X4(and, _mm_and_ps(x, y))
+C_F32X4(and_not, victor_f32x4_and_not(x, y))
+RAW_F32X4(and_not, _mm_andnot_ps(y, x))
+C_F32X4(or, victor_f32x4_or(x, y))
+RAW_F32X4(or, _mm_or_ps(x, y))
+C_F32X4(xor, victor_f32x4_xor(x, y))
+RAW_F32X4(xor, _mm_xor_ps(x, y))
+C_F32X4(not, victor_f32x4_not(x))
+RAW_F32X4(not, _mm_xor_ps(x, _mm_castsi128_ps(_mm_set1_epi32(-1))))
+C_F32X4(fmadd, victor_f32x4_fmadd(x, y, y))
+C_F32X4(floor, victor_f32x4_floor(x))
+C_F32X4(ceil, victor_f32x4_ceil(x))
+#if defined(VICTOR_ENABLE_SSE4_1)
+  RAW_F32X4(floor, _mm_round_ps(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC))
+  RAW_F32X4(ceil, _mm_round_ps(x, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC))
+#endif
+#if defined(VICTOR_ENABLE_FMA)
+  RAW_F32X4(fmadd, _mm_fmadd_ps(x, y, y))
+#endif
+C_F32X4(select, victor_f32x4_select(victor_f32x4_cmplt(x, y), x, y))
+RAW_F32X4(select, raw_f32x4_select(_mm_cmplt_ps(x, y), x, y))
+C_F32X4(shuffle, victor_f32x4_shuffle(x, 3, 2, 1, 0))
+RAW_F32X4(shuffle, _mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 1, 2, 3)))
+C_F32X4(to_i32x4, victor_i32x4_to_f32x4(victor_f32x4_to_i32x4(x)))
+RAW_F32X4(to_i32x4, _mm_cvtepi32_ps(_mm_cvtps_epi32(x)))
+C_F32X4(store_load, (victor_f32x4_store(bench_f32_scratch, x), victor_f32x4_load(bench_f32_scratch + bench_zero)))
+RAW_F32X4(store_load, (_mm_storeu_ps(bench_f32_scratch, x), _mm_loadu_ps(bench_f32_scratch + bench_zero)))
+C_F32X4(store_load_partial, (victor_f32x4_store_partial(bench_f32_scratch, bench_partial_count, x), victor_f32x4_load_partial(bench_f32_scratch + bench_zero, bench_partial_count)))
+C_F32X4(gather, victor_f32x4_gather(bench_f32_ones, victor_f32x4_to_i32x4_trunc(x)))
+#if defined(VICTOR_ENABLE_AVX2)
+  RAW_F32X4(gather, _mm_i32gather_ps(bench_f32_ones, _mm_cvttps_epi32(x), 4))
+#endif
+
+/* i32x4 */
+C_I32X4(add, victor_i32x4_add(x, y))
+RAW_I32X4(add, _mm_add_epi32(x, y))
+C_I32X4(sub, victor_i32x4_sub(x, y))
+RAW_I32X4(sub, _mm_sub_epi32(x, y))
+C_I32X4(mul, victor_i32x4_mul(x, y))
+C_I32X4(and, victor_i32x4_and(x, y))
+RAW_I32X4(and, _mm_and_si128(x, y))
+C_I32X4(and_not, victor_i32x4_and_not(x, y))
+RAW_I32X4(and_not, _mm_andnot_si128(y, x))
+C_I32X4(or, victor_i32x4_or(x, y))
+RAW_I32X4(or, _mm_or_si128(x, y))
+C_I32X4(xor, victor_i32x4_xor(x, y))
+RAW_I32X4(xor, _mm_xor_si128(x, y))
+C_I32X4(not, victor_i32x4_not(x))
+RAW_I32X4(not, _mm_andnot_si128(x, _mm_set1_epi32(-1)))
+C_I32X4(shl, victor_i32x4_shl(x, 1))
+RAW_I32X4(shl, _mm_slli_epi32(x, 1))
+C_I32X4(shr, victor_i32x4_shr(x, 1))
+RAW_I32X4(shr, _mm_srai_epi32(x, 1))
+C_I32X4(shlv, victor_i32x4_shlv(x, y))
+C_I32X4(shrv, victor_i32x4_shrv(x, y))
+#if defined(VICTOR_ENABLE_SSE4_1)
+  RAW_I32X4(mul, _mm_mullo_epi32(x, y))
+#endif
+#if defined(VICTOR_ENABLE_AVX2)
+  RAW_I32X4(shlv, _mm_sllv_epi32(x, y))
+  RAW_I32X4(shrv, _mm_srav_epi32(x, y))
+#endif
+C_I32X4(select, victor_i32x4_select(victor_i32x4_cmpgt(x, y), x, y))
+RAW_I32X4(select, raw_si128_select(_mm_cmpgt_epi32(x, y), x, y))
+C_I32X4(shuffle, victor_i32x4_shuffle(x, 3, 2, 1, 0))
+RAW_I32X4(shuffle, _mm_shuffle_epi32(x, _MM_SHUFFLE(0, 1, 2, 3)))
+C_I32X4(to_f32x4, victor_f32x4_to_i32x4_trunc(victor_i32x4_to_f32x4(x)))
+RAW_I32X4(to_f32x4, _mm_cvttps_epi32(_mm_cvtepi32_ps(x)))
+C_I32X4(store_load, (victor_i32x4_store(bench_i32_scratch, x), victor_i32x4_load(bench_i32_scratch + bench_zero)))
+RAW_I32X4(store_load, (_mm_storeu_si128((__m128i*) bench_i32_scratch, x), _mm_loadu_si128((const __m128i*) (bench_i32_scratch + bench_zero))))
+C_I32X4(store_load_partial, (victor_i32x4_store_partial(bench_i32_scratch, bench_partial_count, x), victor_i32x4_load_partial(bench_i32_scratch + bench_zero, bench_partial_count)))
+C_I32X4(gather, victor_i32x4_gather(bench_i32_ones, x))
+#if defined(VICTOR_ENABLE_AVX2)
+  RAW_I32X4(gather, _mm_i32gather_epi32(bench_i32_ones, x, 4))
+#endif
+
+/* i8x16 */
+C_I8X16(add, victor_i8x16_add(x, y))
+RAW_I8X16(add, _mm_add_epi8(x, y))
+C_I8X16(adds, victor_i8x16_adds(x, y))
+RAW_I8X16(adds, _mm_adds_epi8(x, y))
+C_I8X16(sub, victor_i8x16_sub(x, y))
+RAW_I8X16(sub, _mm_sub_epi8(x, y))
+C_I8X16(subs, victor_i8x16_subs(x, y))
+RAW_I8X16(subs, _mm_subs_epi8(x, y))
+C_I8X16(mul, victor_i8x16_mul(x, y))
+C_I8X16(and, victor_i8x16_and(x, y))
+RAW_I8X16(and, _mm_and_si128(x, y))
+C_I8X16(and_not, victor_i8x16_and_not(x, y))
+RAW_I8X16(and_not, _mm_andnot_si128(y, x))
+C_I8X16(or, victor_i8x16_or(x, y))
+RAW_I8X16(or, _mm_or_si128(x, y))
+C_I8X16(xor, victor_i8x16_xor(x, y))
+RAW_I8X16(xor, _mm_xor_si128(x, y))
+C_I8X16(shl, victor_i8x16_shl(x, 1))
+C_I8X16(shr, victor_i8x16_shr(x, 1))
+C_I8X16(abs, victor_i8x16_abs(x))
+#if defined(VICTOR_ENABLE_SSSE3)
+  RAW_I8X16(abs, _mm_abs_epi8(x))
+#endif
+C_I8X16(select, victor_i8x16_select(victor_i8x16_cmpgt(x, y), x, y))
+RAW_I8X16(select, raw_si128_select(_mm_cmpgt_epi8(x, y), x, y))
+C_I8X16(shuffle, victor_i8x16_shuffle(x, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+C_I8X16(to_i16x8, victor_i8x16_narrow_i16x8(victor_i8x16_to_i16x8(x), victor_i8x16_to_i16x8_high(x)))
+C_I8X16(store_load, (victor_i8x16_store(bench_i8_scratch, x), victor_i8x16_load(bench_i8_scratch + bench_zero)))
+RAW_I8X16(store_load, (_mm_storeu_si128((__m128i*) bench_i8_scratch, x), _mm_loadu_si128((const __m128i*) (bench_i8_scratch + bench_zero))))
+C_I8X16(store_load_partial, (victor_i8x16_store_partial(bench_i8_scratch, bench_partial_count, x), victor_i8x16_load_partial(bench_i8_scratch + bench_zero, bench_partial_count)))
+#if defined(VICTOR_ENABLE_SSSE3)
+  RAW_I8X16(shuffle, _mm_shuffle_epi8(x, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)))
+#endif
+
+/* The other 128-bit types */
+C_I16X8(add, victor_i16x8_add(x, y))
+RAW_I16X8(add, _mm_add_epi16(x, y))
+C_I16X8(adds, victor_i16x8_adds(x, y))
+RAW_I16X8(adds, _mm_adds_epi16(x, y))
+C_I16X8(min, victor_i16x8_min(x, y))
+RAW_I16X8(min, _mm_min_epi16(x, y))
+C_U8X16(add, victor_u8x16_add(x, y))
+RAW_U8X16(add, _mm_add_epi8(x, y))
+C_U8X16(avg, victor_u8x16_avg(x, y))
+RAW_U8X16(avg, _mm_avg_epu8(x, y))
+C_U8X16(max, victor_u8x16_max(x, y))
+RAW_U8X16(max, _mm_max_epu8(x, y))
+C_F64X2(add, victor_f64x2_add(x, y))
+RAW_F64X2(add, _mm_add_pd(x, y))
+C_F64X2(fmadd, victor_f64x2_fmadd(x, y, y))
+#if defined(VICTOR_ENABLE_FMA)
+  RAW_F64X2(fmadd, _mm_fmadd_pd(x, y, y))
+#endif
+
+/* 256-bit */
+#if defined(VICTOR_ENABLE_AVX)
+  C_F32X8(add, victor_f32x8_add(x, y))
+  RAW_F32X8(add, _mm256_add_ps(x, y))
+  C_F32X8(and, victor_f32x8_and(x, y))
+  RAW_F32X8(and, _mm256_and_ps(x, y))
+  C_F32X8(fmadd, victor_f32x8_fmadd(x, y, y))
+  C_F32X8(store_load_partial, (victor_f32x8_store_partial(bench_f32_scratch, bench_partial_count, x), victor_f32x8_load_partial(bench_f32_scratch + bench_zero, bench_partial_count)))
+#endif
+#if defined(VICTOR_ENABLE_FMA)
+  RAW_F32X8(fmadd, _mm256_fmadd_ps(x, y, y))
+#endif
+#if defined(VICTOR_ENABLE_AVX2)
+  C_I32X8(add, victor_i32x8_add(x, y))
+  RAW_I32X8(add, _mm256_add_epi32(x, y))
+  C_I32X8(gather, victor_i32x8_gather(bench_i32_ones, x))
+  RAW_I32X8(gather, _mm256_i32gather_epi32(bench_i32_ones, x, 4))
+  C_I8X32(add, victor_i8x32_add(x, y))
+  RAW_I8X32(add, _mm256_add_epi8(x, y))
+#endif
+
+/* 512-bit */
+#if defined(VICTOR_ENABLE_AVX512F)
+  C_F32X16(add, victor_f32x16_add(x, y))
+  RAW_F32X16(add, _mm512_add_ps(x, y))
+  C_F32X16(fmadd, victor_f32x16_fmadd(x, y, y))
+  RAW_F32X16(fmadd, _mm512_fmadd_ps(x, y, y))
+  C_F32X16(maskz_add, victor_f32x16_maskz_add(victor_f32x16_cmplt(x, y), x, y))
+  RAW_F32X16(maskz_add, _mm512_maskz_add_ps(_mm512_cmp_ps_mask(x, y, _CMP_LT_OQ), x, y))
+  C_I32X16(add, victor_i32x16_add(x, y))
+  RAW_I32X16(add, _mm512_add_epi32(x, y))
+  C_I32X16(gather, victor_i32x16_gather(bench_i32_ones, x))
+  RAW_I32X16(gather, _mm512_i32gather_epi32(x, bench_i32_ones, 4))
+#endif
+#if defined(VICTOR_ENABLE_AVX512BW)
+  C_I8X64(add, victor_i8x64_add(x, y))
+  RAW_I8X64(add, _mm512_add_epi8(x, y))
+#endif
+
+/* Reductions.  The chain broadcasts the result back into a vector, so
+   every version pays for one set1 on top of the reduction. */
+#define SCALAR_REDUCE(type, N, T, R, lanes, name, combine) \
+  static inline R scalar_##type##_reduce_##name(N v) { \
+    T a[lanes]; \
+    R r; \
+    size_t i; \
+    memcpy(a, &v, sizeof(a)); \
+    for (r = a[0], i = 1 ; i < (lanes) ; i++) \
+      r = (combine); \
+    return r; \
+  }
+
+SCALAR_REDUCE(f32x4, __m128, float, float, 4, add, r + a[i])
+SCALAR_REDUCE(f32x4, __m128, float, float, 4, min, (a[i] < r) ? a[i] : r)
+SCALAR_REDUCE(f32x4, __m128, float, float, 4, max, (a[i] > r) ? a[i] : r)
+SCALAR_REDUCE(i32x4, __m128i, int32_t, int32_t, 4, add, r + a[i])
+SCALAR_REDUCE(i32x4, __m128i, int32_t, int32_t, 4, min, (a[i] < r) ? a[i] : r)
+SCALAR_REDUCE(i32x4, __m128i, int32_t, int32_t, 4, max, (a[i] > r) ? a[i] : r)
+SCALAR_REDUCE(i8x16, __m128i, int8_t, int32_t, 16, add, r + a[i])
+SCALAR_REDUCE(i8x16, __m128i, int8_t, int8_t, 16, min, (a[i] < r) ? a[i] : r)
+SCALAR_REDUCE(i8x16, __m128i, int8_t, int8_t, 16, max, (a[i] > r) ? a[i] : r)
+
+#define SCALAR_F32X4(name, expr) \
+  BENCH_OP(scalar, f32x4_##name, __m128, 4, _mm_set1_ps(1.0f), _mm_set1_ps(1.0f), expr)
+#define SCALAR_I32X4(name, expr) \
+  BENCH_OP(scalar, i32x4_##name, __m128i, 4, _mm_set1_epi32(1), _mm_set1_epi32(1), expr)
+#define SCALAR_I8X16(name, expr) \
+  BENCH_OP(scalar, i8x16_##name, __m128i, 16, _mm_set1_epi8(1), _mm_set1_epi8(1), expr)
+
+C_F32X4(reduce_add, victor_f32x4_set1(victor_f32x4_reduce_add(x)))
+SCALAR_F32X4(reduce_add, _mm_set1_ps(scalar_f32x4_reduce_add(x)))
+C_F32X4(reduce_min, victor_f32x4_set1(victor_f32x4_reduce_min(x)))
+SCALAR_F32X4(reduce_min, _mm_set1_ps(scalar_f32x4_reduce_min(x)))
+C_F32X4(reduce_max, victor_f32x4_set1(victor_f32x4_reduce_max(x)))
+SCALAR_F32X4(reduce_max, _mm_set1_ps(scalar_f32x4_reduce_max(x)))
+C_I32X4(reduce_add, victor_i32x4_set1(victor_i32x4_reduce_add(x)))
+SCALAR_I32X4(reduce_add, _mm_set1_epi32(scalar_i32x4_reduce_add(x)))
+C_I32X4(reduce_min, victor_i32x4_set1(victor_i32x4_reduce_min(x)))
+SCALAR_I32X4(reduce_min, _mm_set1_epi32(scalar_i32x4_reduce_min(x)))
+C_I32X4(reduce_max, victor_i32x4_set1(victor_i32x4_reduce_max(x)))
+SCALAR_I32X4(reduce_max, _mm_set1_epi32(scalar_i32x4_reduce_max(x)))
+C_I8X16(reduce_add, victor_i8x16_set1((int8_t) victor_i8x16_reduce_add(x)))
+SCALAR_I8X16(reduce_add, _mm_set1_epi8((char) scalar_i8x16_reduce_add(x)))
+C_I8X16(reduce_min, victor_i8x16_set1(victor_i8x16_reduce_min(x)))
+SCALAR_I8X16(reduce_min, _mm_set1_epi8(scalar_i8x16_reduce_min(x)))
+C_I8X16(reduce_max, victor_i8x16_set1(victor_i8x16_reduce_max(x)))
+SCALAR_I8X16(reduce_max, _mm_set1_epi8(scalar_i8x16_reduce_max(x)))
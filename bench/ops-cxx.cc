@@ -0,0 +1,139 @@
+/* Victor's C++ API.  The intrinsic baselines are in ops-c.c; the
+   operations here match the "c" entries one for one. */
+
+#include "victor/victor.h"
+#include "bench.h"
+
+using namespace Victor;
+
+/* The asm in bench.h's C version only takes vector registers, so go
+   through the native type, which costs nothing. */
+template <typename T>
+static inline void bench_opaque(T& v) {
+  auto n = v.to_native();
+  __asm__ __volatile__("" : "+x" (n));
+  v = T(n);
+}
+
+#define CXX_F32X4(name, expr) BENCH_OP(cxx, f32x4_##name, f32x4, 4, f32x4(1.0f), f32x4(1.0f), expr)
+#define CXX_I32X4(name, expr) BENCH_OP(cxx, i32x4_##name, i32x4, 4, i32x4(1), i32x4(1), expr)
+#define CXX_I8X16(name, expr) BENCH_OP(cxx, i8x16_##name, i8x16, 16, i8x16(1), i8x16(1), expr)
+#define CXX_I16X8(name, expr) BENCH_OP(cxx, i16x8_##name, i16x8, 8, i16x8(1), i16x8(1), expr)
+#define CXX_U8X16(name, expr) BENCH_OP(cxx, u8x16_##name, u8x16, 16, u8x16(1), u8x16(1), expr)
+#define CXX_F64X2(name, expr) BENCH_OP(cxx, f64x2_##name, f64x2, 2, f64x2(1.0), f64x2(1.0), expr)
+#define CXX_F32X8(name, expr) BENCH_OP(cxx, f32x8_##name, f32x8, 8, f32x8(1.0f), f32x8(1.0f), expr)
+#define CXX_I32X8(name, expr) BENCH_OP(cxx, i32x8_##name, i32x8, 8, i32x8(1), i32x8(1), expr)
+#define CXX_I8X32(name, expr) BENCH_OP(cxx, i8x32_##name, i8x32, 32, i8x32(1), i8x32(1), expr)
+#define CXX_F32X16(name, expr) BENCH_OP(cxx, f32x16_##name, f32x16, 16, f32x16(1.0f), f32x16(1.0f), expr)
+#define CXX_I32X16(name, expr) BENCH_OP(cxx, i32x16_##name, i32x16, 16, i32x16(1), i32x16(1), expr)
+#define CXX_I8X64(name, expr) BENCH_OP(cxx, i8x64_##name, i8x64, 64, i8x64(1), i8x64(1), expr)
+
+/* f32x4 */
+CXX_F32X4(add, x + y)
+CXX_F32X4(sub, x - y)
+CXX_F32X4(mul, x * y)
+CXX_F32X4(div, x / y)
+CXX_F32X4(and, x & y)
+CXX_F32X4(and_not, x.and_not(y))
+CXX_F32X4(or, x | y)
+CXX_F32X4(xor, x ^ y)
+CXX_F32X4(not, ~x)
+CXX_F32X4(fmadd, fmadd(x, y, y))
+CXX_F32X4(floor, x.floor())
+CXX_F32X4(ceil, x.ceil())
+CXX_F32X4(reduce_add, f32x4(x.reduce_add()))
+CXX_F32X4(reduce_min, f32x4(x.reduce_min()))
+CXX_F32X4(reduce_max, f32x4(x.reduce_max()))
+CXX_F32X4(select, select(x < y, x, y))
+CXX_F32X4(shuffle, (shuffle<3, 2, 1, 0>(x)))
+CXX_F32X4(to_i32x4, x.to_i32x4().to_f32x4())
+CXX_F32X4(store_load, (x.store(bench_f32_scratch), f32x4::load(bench_f32_scratch + bench_zero)))
+CXX_F32X4(store_load_partial, (x.store_partial(bench_f32_scratch, bench_partial_count), f32x4::load_partial(bench_f32_scratch + bench_zero, bench_partial_count)))
+CXX_F32X4(gather, f32x4::gather(bench_f32_ones, x.to_i32x4_trunc()))
+
+/* i32x4 */
+CXX_I32X4(add, x + y)
+CXX_I32X4(sub, x - y)
+CXX_I32X4(mul, x * y)
+CXX_I32X4(and, x & y)
+CXX_I32X4(and_not, x.and_not(y))
+CXX_I32X4(or, x | y)
+CXX_I32X4(xor, x ^ y)
+CXX_I32X4(not, ~x)
+CXX_I32X4(shl, x << 1)
+CXX_I32X4(shr, x >> 1)
+CXX_I32X4(shlv, x << y)
+CXX_I32X4(shrv, x >> y)
+CXX_I32X4(reduce_add, i32x4(x.reduce_add()))
+CXX_I32X4(reduce_min, i32x4(x.reduce_min()))
+CXX_I32X4(reduce_max, i32x4(x.reduce_max()))
+CXX_I32X4(select, select(x > y, x, y))
+CXX_I32X4(shuffle, (shuffle<3, 2, 1, 0>(x)))
+CXX_I32X4(to_f32x4, x.to_f32x4().to_i32x4_trunc())
+CXX_I32X4(store_load, (x.store(bench_i32_scratch), i32x4::load(bench_i32_scratch + bench_zero)))
+CXX_I32X4(store_load_partial, (x.store_partial(bench_i32_scratch, bench_partial_count), i32x4::load_partial(bench_i32_scratch + bench_zero, bench_partial_count)))
+CXX_I32X4(gather, i32x4::gather(bench_i32_ones, x))
+
+/* i8x16 */
+CXX_I8X16(add, x + y)
+CXX_I8X16(adds, x.adds(y))
+CXX_I8X16(sub, x - y)
+CXX_I8X16(subs, x.subs(y))
+CXX_I8X16(mul, x * y)
+CXX_I8X16(and, x & y)
+CXX_I8X16(and_not, x.and_not(y))
+CXX_I8X16(or, x | y)
+CXX_I8X16(xor, x ^ y)
+CXX_I8X16(shl, x << 1)
+CXX_I8X16(shr, x >> 1)
+CXX_I8X16(abs, x.abs())
+CXX_I8X16(reduce_add, i8x16(static_cast<int8_t>(x.reduce_add())))
+CXX_I8X16(reduce_min, i8x16(x.reduce_min()))
+CXX_I8X16(reduce_max, i8x16(x.reduce_max()))
+CXX_I8X16(select, select(x > y, x, y))
+CXX_I8X16(shuffle, (shuffle<15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0>(x)))
+CXX_I8X16(to_i16x8, i8x16::narrow(x.to_i16x8(), x.to_i16x8_high()))
+CXX_I8X16(store_load, (x.store(bench_i8_scratch), i8x16::load(bench_i8_scratch + bench_zero)))
+CXX_I8X16(store_load_partial, (x.store_partial(bench_i8_scratch, bench_partial_count), i8x16::load_partial(bench_i8_scratch + bench_zero, bench_partial_count)))
+
+/* The other 128-bit types */
+CXX_I16X8(add, x + y)
+CXX_I16X8(adds, x.adds(y))
+CXX_I16X8(min, x.min(y))
+CXX_U8X16(add, x + y)
+CXX_U8X16(avg, x.avg(y))
+CXX_U8X16(max, x.max(y))
+CXX_F64X2(add, x + y)
+CXX_F64X2(fmadd, fmadd(x, y, y))
+
+/* 256-bit */
+#if defined(VICTOR_ENABLE_AVX)
+  CXX_F32X8(add, x + y)
+  CXX_F32X8(and, x & y)
+  CXX_F32X8(fmadd, fmadd(x, y, y))
+  CXX_F32X8(store_load_partial, (x.store_partial(bench_f32_scratch, bench_partial_count), f32x8::load_partial(bench_f32_scratch + bench_zero, bench_partial_count)))
+#endif
+#if defined(VICTOR_ENABLE_AVX2)
+  CXX_I32X8(add, x + y)
+  CXX_I32X8(gather, i32x8::gather(bench_i32_ones, x))
+  CXX_I8X32(add, x + y)
+#endif
+
+/* 512-bit */
+#if defined(VICTOR_ENABLE_AVX512F)
+  CXX_F32X16(add, x + y)
+  CXX_F32X16(fmadd, fmadd(x, y, y))
+  CXX_F32X16(maskz_add, x.maskz_add(x < y, y))
+  CXX_I32X16(add, x + y)
+  /* GCC 12's _mm512_i32gather_epi32 starts from _mm512_undefined_epi32,
+     which it then warns about in C++. */
+  HEDLEY_DIAGNOSTIC_PUSH
+  #if HEDLEY_GCC_VERSION_CHECK(4,7,0)
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+  CXX_I32X16(gather, i32x16::gather(bench_i32_ones, x))
+  HEDLEY_DIAGNOSTIC_POP
+#endif
+#if defined(VICTOR_ENABLE_AVX512BW)
+  CXX_I8X64(add, x + y)
+#endif
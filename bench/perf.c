@@ -0,0 +1,203 @@
+/* See perf.h. */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE
+#endif
+
+#include "perf.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__)
+  #include <cpuid.h>
+  #include <linux/perf_event.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+static const char* const bench_counter_names[BENCH_COUNTERS] = {
+  "cycles",
+  "instructions",
+  "uops",
+  "l1d_misses",
+  "l2_misses",
+  "branch_misses"
+};
+
+const char* bench_counter_name(enum bench_counter counter) {
+  return bench_counter_names[counter];
+}
+
+uint64_t bench_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+}
+
+#if defined(__linux__)
+
+static int bench_counter_fds[BENCH_COUNTERS] = { -1, -1, -1, -1, -1, -1 };
+
+enum bench_vendor {
+  BENCH_VENDOR_OTHER,
+  BENCH_VENDOR_INTEL,
+  BENCH_VENDOR_AMD
+};
+
+static enum bench_vendor bench_cpu_vendor(void) {
+  unsigned int eax, ebx, ecx, edx;
+  char vendor[13];
+
+  if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx))
+    return BENCH_VENDOR_OTHER;
+  memcpy(vendor + 0, &ebx, 4);
+  memcpy(vendor + 4, &edx, 4);
+  memcpy(vendor + 8, &ecx, 4);
+  vendor[12] = '\0';
+
+  if (strcmp(vendor, "GenuineIntel") == 0)
+    return BENCH_VENDOR_INTEL;
+  if (strcmp(vendor, "AuthenticAMD") == 0 || strcmp(vendor, "HygonGenuine") == 0)
+    return BENCH_VENDOR_AMD;
+  return BENCH_VENDOR_OTHER;
+}
+
+/* Fills in a raw event from the environment or the vendor's encoding;
+   returns 0 if we don't know one. */
+static int bench_raw_event(struct perf_event_attr* attr, const char* env, uint64_t intel, uint64_t amd) {
+  const char* code = getenv(env);
+
+  attr->type = PERF_TYPE_RAW;
+  if (code != NULL && code[0] != '\0') {
+    attr->config = strtoull(code, NULL, 16);
+    return 1;
+  }
+  switch (bench_cpu_vendor()) {
+    case BENCH_VENDOR_INTEL: attr->config = intel; return 1;
+    case BENCH_VENDOR_AMD: attr->config = amd; return 1;
+    default: return 0;
+  }
+}
+
+static int bench_counter_open(enum bench_counter counter) {
+  struct perf_event_attr attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  switch (counter) {
+    case BENCH_CYCLES:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case BENCH_INSTRUCTIONS:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case BENCH_UOPS:
+      if (!bench_raw_event(&attr, "VICTOR_BENCH_UOPS_EVENT", 0x010e, 0x00c1))
+        return -1;
+      break;
+    case BENCH_L1D_MISSES:
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config =
+        PERF_COUNT_HW_CACHE_L1D |
+        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      break;
+    case BENCH_L2_MISSES:
+      if (!bench_raw_event(&attr, "VICTOR_BENCH_L2_MISSES_EVENT", 0x3f24, 0x0964))
+        return -1;
+      break;
+    case BENCH_BRANCH_MISSES:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case BENCH_COUNTERS:
+    default:
+      return -1;
+  }
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  /* If there are more events than counters the kernel multiplexes
+     them; these let us scale the counts back up. */
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+int bench_counters_open(void) {
+  int i, opened = 0;
+
+  for (i = 0 ; i < BENCH_COUNTERS ; i++) {
+    bench_counter_fds[i] = bench_counter_open((enum bench_counter) i);
+    if (bench_counter_fds[i] >= 0)
+      opened++;
+  }
+  return opened;
+}
+
+void bench_counters_close(void) {
+  int i;
+
+  for (i = 0 ; i < BENCH_COUNTERS ; i++) {
+    if (bench_counter_fds[i] >= 0)
+      close(bench_counter_fds[i]);
+    bench_counter_fds[i] = -1;
+  }
+}
+
+void bench_counters_start(void) {
+  int i;
+
+  for (i = 0 ; i < BENCH_COUNTERS ; i++) {
+    if (bench_counter_fds[i] >= 0) {
+      ioctl(bench_counter_fds[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(bench_counter_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+void bench_counters_stop(struct bench_counts* counts) {
+  uint64_t data[3];
+  int i;
+
+  for (i = 0 ; i < BENCH_COUNTERS ; i++)
+    if (bench_counter_fds[i] >= 0)
+      ioctl(bench_counter_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+
+  for (i = 0 ; i < BENCH_COUNTERS ; i++) {
+    counts->value[i] = BENCH_COUNTER_UNAVAILABLE;
+    if (bench_counter_fds[i] < 0)
+      continue;
+    if (read(bench_counter_fds[i], data, sizeof(data)) != (ssize_t) sizeof(data) || data[2] == 0)
+      continue;
+    counts->value[i] = (data[2] == data[1]) ?
+      data[0] :
+      (uint64_t) ((double) data[0] * ((double) data[1] / (double) data[2]));
+  }
+}
+
+#else
+
+int bench_counters_open(void) {
+  return 0;
+}
+
+void bench_counters_close(void) {
+}
+
+void bench_counters_start(void) {
+}
+
+void bench_counters_stop(struct bench_counts* counts) {
+  int i;
+
+  for (i = 0 ; i < BENCH_COUNTERS ; i++)
+    counts->value[i] = BENCH_COUNTER_UNAVAILABLE;
+}
+
+#endif
@@ -0,0 +1,56 @@
+/* Hardware performance counters for victor-bench, through Linux's
+ * perf_event_open.
+ *
+ * Each counter is opened on its own rather than as a group, so one the
+ * CPU (or the container, or perf_event_paranoid) won't give us doesn't
+ * take the rest down with it; bench_counters_open() returns how many
+ * it got, and a counter which isn't available reads as
+ * BENCH_COUNTER_UNAVAILABLE.  Elsewhere, or with none available, the
+ * caller falls back to wall-clock time from bench_now_ns().
+ *
+ * Only cycles, instructions, L1D misses and branch misses are generic
+ * events.  uops and L2 misses are model-specific; we know the Intel
+ * (UOPS_ISSUED.ANY, L2_RQSTS.MISS) and AMD Zen (retired ops, L2 misses
+ * from PMCx064) encodings, and VICTOR_BENCH_UOPS_EVENT or
+ * VICTOR_BENCH_L2_MISSES_EVENT can be set to a raw event code (as
+ * accepted by "perf stat -e r<code>") for anything else. */
+
+#if !defined(VICTOR_BENCH_PERF_H)
+#define VICTOR_BENCH_PERF_H
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+enum bench_counter {
+  BENCH_CYCLES,
+  BENCH_INSTRUCTIONS,
+  BENCH_UOPS,
+  BENCH_L1D_MISSES,
+  BENCH_L2_MISSES,
+  BENCH_BRANCH_MISSES,
+  BENCH_COUNTERS
+};
+
+#define BENCH_COUNTER_UNAVAILABLE UINT64_MAX
+
+struct bench_counts {
+  uint64_t value[BENCH_COUNTERS];
+};
+
+const char* bench_counter_name(enum bench_counter counter);
+
+int bench_counters_open(void);
+void bench_counters_close(void);
+void bench_counters_start(void);
+void bench_counters_stop(struct bench_counts* counts);
+
+uint64_t bench_now_ns(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* !defined(VICTOR_BENCH_PERF_H) */
@@ -0,0 +1,266 @@
+/* victor-sweep: bytes per cycle of Victor's array kernels as the working
+ * set grows from L1 out to DRAM, for finding block sizes and the point
+ * where non-temporal stores start to pay off.
+ *
+ *   victor-sweep [-m MAX] [-s STEPS] [-r REPEATS] [-p] [-c] [FILTER...]
+ *
+ * Working sets go from 4 KiB to MAX (default 1G; K, M and G suffixes
+ * are accepted), with STEPS sizes per doubling (default 1).  The
+ * working set is every array the kernel touches, so dot and the
+ * copying kernels use two arrays of half the size each:
+ *
+ *   sum           Victor::sum(a, n)
+ *   dot           Victor::dot(a, b, n)
+ *   transform     Victor::transform<V>(a, b, n, x + 1)
+ *   store         V::load_aligned(a + i).store_aligned(b + i)
+ *   store_stream  V::load_aligned(a + i).store_stream(b + i)
+ *
+ * each over f32x4, i32x4 and i8x16.  Small working sets are run enough
+ * times to move at least 256 MiB, the fastest of REPEATS runs is kept,
+ * and bytes per cycle counts bytes read plus bytes written (not the
+ * extra read a normal store does to bring its line in).  Cycles are
+ * TSC ticks, or core cycles with -p if perf counters are available.
+ * The output is JSON, or with -c CSV for plotting bytes_per_cycle
+ * against bytes on a log scale; FILTERs match "kernel/type", e.g.
+ * "store" or "/i8x16". */
+
+#include "victor/victor.h"
+#include "bench.h"
+#include "perf.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace Victor;
+
+namespace {
+  volatile double sweep_sink;
+
+  template <typename V>
+  struct add_one {
+    typedef typename vector_traits<V>::value_type T;
+    V operator()(V x) const { return x + V(T(1)); }
+  };
+
+  template <typename V>
+  void sweep_sum(void* a, void*, size_t n) {
+    typedef typename vector_traits<V>::value_type T;
+    sweep_sink = static_cast<double>(sum(static_cast<const T*>(a), n));
+  }
+
+  template <typename V>
+  void sweep_dot(void* a, void* b, size_t n) {
+    typedef typename vector_traits<V>::value_type T;
+    sweep_sink = static_cast<double>(dot(static_cast<const T*>(a), static_cast<const T*>(b), n));
+  }
+
+  template <typename V>
+  void sweep_transform(void* a, void* b, size_t n) {
+    typedef typename vector_traits<V>::value_type T;
+    transform<V>(static_cast<const T*>(a), static_cast<T*>(b), n, add_one<V>());
+  }
+
+  template <typename V>
+  void sweep_store(void* a, void* b, size_t n) {
+    typedef typename vector_traits<V>::value_type T;
+    const T* src = static_cast<const T*>(a);
+    T* dest = static_cast<T*>(b);
+    for (size_t i = 0 ; i < n ; i += vector_traits<V>::lanes)
+      V::load_aligned(src + i).store_aligned(dest + i);
+  }
+
+  template <typename V>
+  void sweep_store_stream(void* a, void* b, size_t n) {
+    typedef typename vector_traits<V>::value_type T;
+    const T* src = static_cast<const T*>(a);
+    T* dest = static_cast<T*>(b);
+    for (size_t i = 0 ; i < n ; i += vector_traits<V>::lanes)
+      V::load_aligned(src + i).store_stream(dest + i);
+    _mm_sfence();
+  }
+
+  struct sweep_kernel {
+    const char* name;
+    const char* type;
+    size_t element_size;
+    int arrays;
+    void (*run)(void* a, void* b, size_t n);
+  };
+
+  #define SWEEP_KERNELS(V) \
+    { "sum", #V, sizeof(vector_traits<V>::value_type), 1, sweep_sum<V> }, \
+    { "dot", #V, sizeof(vector_traits<V>::value_type), 2, sweep_dot<V> }, \
+    { "transform", #V, sizeof(vector_traits<V>::value_type), 2, sweep_transform<V> }, \
+    { "store", #V, sizeof(vector_traits<V>::value_type), 2, sweep_store<V> }, \
+    { "store_stream", #V, sizeof(vector_traits<V>::value_type), 2, sweep_store_stream<V> }
+
+  const sweep_kernel sweep_kernels[] = {
+    SWEEP_KERNELS(f32x4),
+    SWEEP_KERNELS(i32x4),
+    SWEEP_KERNELS(i8x16)
+  };
+
+  const size_t sweep_min_bytes = 4096;
+  const size_t sweep_min_traffic = 256 << 20;
+
+  bool sweep_parse_size(const char* arg, size_t* size) {
+    char* end;
+    unsigned long long v = strtoull(arg, &end, 0);
+
+    switch (*end) {
+      case 'G': case 'g': v <<= 10; /* fall through */
+      case 'M': case 'm': v <<= 10; /* fall through */
+      case 'K': case 'k': v <<= 10; end++; break;
+      default: break;
+    }
+    if (*end != '\0' || v < sweep_min_bytes)
+      return false;
+    *size = static_cast<size_t>(v);
+    return true;
+  }
+
+  bool sweep_selected(const sweep_kernel& k, int nfilters, char** filters) {
+    char id[64];
+
+    if (nfilters == 0)
+      return true;
+    snprintf(id, sizeof(id), "%s/%s", k.name, k.type);
+    for (int i = 0 ; i < nfilters ; i++)
+      if (strstr(id, filters[i]) != NULL)
+        return true;
+    return false;
+  }
+
+  void sweep_usage(FILE* stream, const char* argv0) {
+    fprintf(stream, "usage: %s [-m MAX] [-s STEPS] [-r REPEATS] [-p] [-c] [FILTER...]\n", argv0);
+  }
+}
+
+int main(int argc, char** argv) {
+  size_t max_bytes = static_cast<size_t>(1) << 30;
+  int steps = 1;
+  int repeats = 5;
+  bool counters = false;
+  bool csv = false;
+  int argi;
+
+  for (argi = 1 ; argi < argc && argv[argi][0] == '-' ; argi++) {
+    if (strcmp(argv[argi], "-m") == 0 && argi + 1 < argc) {
+      if (!sweep_parse_size(argv[++argi], &max_bytes)) {
+        sweep_usage(stderr, argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else if (strcmp(argv[argi], "-s") == 0 && argi + 1 < argc) {
+      steps = atoi(argv[++argi]);
+    } else if (strcmp(argv[argi], "-r") == 0 && argi + 1 < argc) {
+      repeats = atoi(argv[++argi]);
+    } else if (strcmp(argv[argi], "-p") == 0) {
+      counters = true;
+    } else if (strcmp(argv[argi], "-c") == 0) {
+      csv = true;
+    } else if (strcmp(argv[argi], "-h") == 0) {
+      sweep_usage(stdout, argv[0]);
+      return EXIT_SUCCESS;
+    } else {
+      sweep_usage(stderr, argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (steps < 1 || repeats < 1) {
+    sweep_usage(stderr, argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  /* One allocation for both arrays, so the largest working set is
+     MAX. */
+  void* a = NULL;
+  if (posix_memalign(&a, 4096, max_bytes) != 0) {
+    fprintf(stderr, "%s: unable to allocate %lu bytes\n", argv[0], static_cast<unsigned long>(max_bytes));
+    return EXIT_FAILURE;
+  }
+  /* Small values, so transform can't overflow (0x01010101 is a normal
+     float); writing every page also gets the page faults out of the
+     way. */
+  memset(a, 1, max_bytes);
+
+  if (counters && bench_counters_open() == 0) {
+    fprintf(stderr, "%s: no hardware counters available, using TSC ticks\n", argv[0]);
+    counters = false;
+  }
+
+  const char* sep = "";
+  if (csv) {
+    printf("kernel,type,bytes,bytes_per_cycle\n");
+  } else {
+    printf("{\n");
+    printf("  \"cycles\": \"%s\",\n", counters ? "core" : "tsc");
+    printf("  \"repeats\": %d,\n", repeats);
+    printf("  \"results\": [");
+  }
+
+  for (size_t k = 0 ; k < sizeof(sweep_kernels) / sizeof(sweep_kernels[0]) ; k++) {
+    const sweep_kernel& kernel = sweep_kernels[k];
+    if (!sweep_selected(kernel, argc - argi, argv + argi))
+      continue;
+
+    size_t last = 0;
+    for (int step = 0 ; ; step++) {
+      /* STEPS sizes per doubling, each a whole number of vectors per
+         array and a multiple of 64 so the second array stays aligned
+         for store_stream. */
+      const double scale = exp2(static_cast<double>(step) / steps);
+      const size_t array_bytes = (static_cast<size_t>(sweep_min_bytes * scale) / kernel.arrays) & ~static_cast<size_t>(63);
+      const size_t bytes = array_bytes * kernel.arrays;
+      if (bytes > max_bytes)
+        break;
+      if (bytes == last)
+        continue;
+      last = bytes;
+
+      void* b = static_cast<char*>(a) + array_bytes;
+      const size_t n = array_bytes / kernel.element_size;
+      const size_t reps = (bytes >= sweep_min_traffic) ? 1 : sweep_min_traffic / bytes;
+      uint64_t best = UINT64_MAX;
+
+      kernel.run(a, b, n);
+      for (int r = 0 ; r < repeats ; r++) {
+        struct bench_counts counts;
+        uint64_t begin, cycles;
+
+        if (counters)
+          bench_counters_start();
+        begin = bench_ticks_begin();
+        for (size_t i = 0 ; i < reps ; i++)
+          kernel.run(a, b, n);
+        cycles = bench_ticks_end() - begin;
+        if (counters) {
+          bench_counters_stop(&counts);
+          if (counts.value[BENCH_CYCLES] != BENCH_COUNTER_UNAVAILABLE)
+            cycles = counts.value[BENCH_CYCLES];
+        }
+        if (cycles < best)
+          best = cycles;
+      }
+
+      const double bytes_per_cycle = static_cast<double>(bytes) * static_cast<double>(reps) / static_cast<double>(best);
+      if (csv) {
+        printf("%s,%s,%lu,%.4f\n", kernel.name, kernel.type, static_cast<unsigned long>(bytes), bytes_per_cycle);
+      } else {
+        printf("%s\n    { \"kernel\": \"%s\", \"type\": \"%s\", \"bytes\": %lu, \"bytes_per_cycle\": %.4f }",
+          sep, kernel.name, kernel.type, static_cast<unsigned long>(bytes), bytes_per_cycle);
+        sep = ",";
+      }
+      fflush(stdout);
+    }
+  }
+
+  if (!csv)
+    printf("\n  ]\n}\n");
+
+  if (counters)
+    bench_counters_close();
+  free(a);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,203 @@
+/* Each pair below defines wrap_NAME, which uses Victor's C API, and
+ * raw_NAME, which does the same thing with the Intel intrinsics;
+ * compare.sh checks that they compile to the same instructions.  The
+ * raw versions use whatever Victor uses for the target, so some pairs
+ * only exist for some ISA extensions. */
+
+#include "victor/victor.h"
+
+#define BINARY(name, V, N, victor_fn, raw_expr) \
+  V wrap_##name(V a, V b) { return victor_fn(a, b); } \
+  N raw_##name(N a, N b) { return raw_expr; }
+
+#define UNARY(name, V, N, W, M, victor_fn, raw_expr) \
+  W wrap_##name(V a) { return victor_fn(a); } \
+  M raw_##name(N a) { return raw_expr; }
+
+#define TERNARY(name, V, N, victor_fn, raw_expr) \
+  V wrap_##name(V a, V b, V c) { return victor_fn(a, b, c); } \
+  N raw_##name(N a, N b, N c) { return raw_expr; }
+
+#define SHIFT(name, V, N, victor_fn, raw_expr) \
+  V wrap_##name(V a, int count) { return victor_fn(a, count); } \
+  N raw_##name(N a, int count) { return raw_expr; }
+
+#define LOAD(name, T, V, N, victor_fn, raw_expr) \
+  V wrap_##name(const T* src) { return victor_fn(src); } \
+  N raw_##name(const T* src) { return raw_expr; }
+
+#define STORE(name, T, V, N, victor_fn, raw_stmt) \
+  void wrap_##name(T* dest, V a) { victor_fn(dest, a); } \
+  void raw_##name(T* dest, N a) { raw_stmt; }
+
+#define COMPARE(name, V, N, M, victor_fn, raw_expr) \
+  M wrap_##name(V a, V b) { return victor_fn(a, b); } \
+  __m128i raw_##name(N a, N b) { return raw_expr; }
+
+#define SELECT(name, V, N, victor_fn, raw_expr) \
+  V wrap_##name(victor_mask32x4 mask, V a, V b) { return victor_fn(mask, a, b); } \
+  N raw_##name(__m128i mask, N a, N b) { return raw_expr; }
+
+/* f32x4 */
+BINARY(f32x4_add, victor_f32x4, __m128, victor_f32x4_add, _mm_add_ps(a, b))
+BINARY(f32x4_sub, victor_f32x4, __m128, victor_f32x4_sub, _mm_sub_ps(a, b))
+BINARY(f32x4_mul, victor_f32x4, __m128, victor_f32x4_mul, _mm_mul_ps(a, b))
+BINARY(f32x4_div, victor_f32x4, __m128, victor_f32x4_div, _mm_div_ps(a, b))
+BINARY(f32x4_and, victor_f32x4, __m128, victor_f32x4_and, _mm_and_ps(a, b))
+BINARY(f32x4_and_not, victor_f32x4, __m128, victor_f32x4_and_not, _mm_andnot_ps(b, a))
+BINARY(f32x4_or, victor_f32x4, __m128, victor_f32x4_or, _mm_or_ps(a, b))
+BINARY(f32x4_xor, victor_f32x4, __m128, victor_f32x4_xor, _mm_xor_ps(a, b))
+UNARY(f32x4_not, victor_f32x4, __m128, victor_f32x4, __m128, victor_f32x4_not, _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))))
+COMPARE(f32x4_cmplt, victor_f32x4, __m128, victor_mask32x4, victor_f32x4_cmplt, _mm_castps_si128(_mm_cmplt_ps(a, b)))
+COMPARE(f32x4_cmpge, victor_f32x4, __m128, victor_mask32x4, victor_f32x4_cmpge, _mm_castps_si128(_mm_cmpge_ps(a, b)))
+UNARY(f32x4_to_i32x4_trunc, victor_f32x4, __m128, victor_i32x4, __m128i, victor_f32x4_to_i32x4_trunc, _mm_cvttps_epi32(a))
+UNARY(f32x4_as_i32x4, victor_f32x4, __m128, victor_i32x4, __m128i, victor_f32x4_as_i32x4, _mm_castps_si128(a))
+UNARY(f32x4_to_f64x2, victor_f32x4, __m128, victor_f64x2, __m128d, victor_f32x4_to_f64x2, _mm_cvtps_pd(a))
+LOAD(f32x4_load, float, victor_f32x4, __m128, victor_f32x4_load, _mm_loadu_ps(src))
+LOAD(f32x4_load_aligned, float, victor_f32x4, __m128, victor_f32x4_load_aligned, _mm_load_ps(src))
+STORE(f32x4_store, float, victor_f32x4, __m128, victor_f32x4_store, _mm_storeu_ps(dest, a))
+STORE(f32x4_store_aligned, float, victor_f32x4, __m128, victor_f32x4_store_aligned, _mm_store_ps(dest, a))
+STORE(f32x4_store_stream, float, victor_f32x4, __m128, victor_f32x4_store_stream, _mm_stream_ps(dest, a))
+victor_f32x4 wrap_f32x4_set1(float value) { return victor_f32x4_set1(value); }
+__m128 raw_f32x4_set1(float value) { return _mm_set1_ps(value); }
+victor_f32x4 wrap_f32x4_set(float e0, float e1, float e2, float e3) { return victor_f32x4_set(e0, e1, e2, e3); }
+__m128 raw_f32x4_set(float e0, float e1, float e2, float e3) { return _mm_setr_ps(e0, e1, e2, e3); }
+#if defined(VICTOR_ENABLE_SSE4_1)
+  UNARY(f32x4_floor, victor_f32x4, __m128, victor_f32x4, __m128, victor_f32x4_floor, _mm_round_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC))
+  UNARY(f32x4_ceil, victor_f32x4, __m128, victor_f32x4, __m128, victor_f32x4_ceil, _mm_round_ps(a, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC))
+  SELECT(f32x4_select, victor_f32x4, __m128, victor_f32x4_select, _mm_blendv_ps(b, a, _mm_castsi128_ps(mask)))
+#endif
+#if defined(VICTOR_ENABLE_FMA)
+  TERNARY(f32x4_fmadd, victor_f32x4, __m128, victor_f32x4_fmadd, _mm_fmadd_ps(a, b, c))
+  TERNARY(f32x4_fnmsub, victor_f32x4, __m128, victor_f32x4_fnmsub, _mm_fnmsub_ps(a, b, c))
+#endif
+
+/* i32x4 */
+BINARY(i32x4_add, victor_i32x4, __m128i, victor_i32x4_add, _mm_add_epi32(a, b))
+BINARY(i32x4_sub, victor_i32x4, __m128i, victor_i32x4_sub, _mm_sub_epi32(a, b))
+BINARY(i32x4_and, victor_i32x4, __m128i, victor_i32x4_and, _mm_and_si128(a, b))
+BINARY(i32x4_and_not, victor_i32x4, __m128i, victor_i32x4_and_not, _mm_andnot_si128(b, a))
+BINARY(i32x4_or, victor_i32x4, __m128i, victor_i32x4_or, _mm_or_si128(a, b))
+BINARY(i32x4_xor, victor_i32x4, __m128i, victor_i32x4_xor, _mm_xor_si128(a, b))
+UNARY(i32x4_not, victor_i32x4, __m128i, victor_i32x4, __m128i, victor_i32x4_not, _mm_andnot_si128(a, _mm_set1_epi32(-1)))
+SHIFT(i32x4_shl, victor_i32x4, __m128i, victor_i32x4_shl, _mm_slli_epi32(a, count))
+SHIFT(i32x4_shr, victor_i32x4, __m128i, victor_i32x4_shr, _mm_srai_epi32(a, count))
+COMPARE(i32x4_cmpeq, victor_i32x4, __m128i, victor_mask32x4, victor_i32x4_cmpeq, _mm_cmpeq_epi32(a, b))
+COMPARE(i32x4_cmpgt, victor_i32x4, __m128i, victor_mask32x4, victor_i32x4_cmpgt, _mm_cmpgt_epi32(a, b))
+UNARY(i32x4_to_f32x4, victor_i32x4, __m128i, victor_f32x4, __m128, victor_i32x4_to_f32x4, _mm_cvtepi32_ps(a))
+UNARY(i32x4_as_f32x4, victor_i32x4, __m128i, victor_f32x4, __m128, victor_i32x4_as_f32x4, _mm_castsi128_ps(a))
+UNARY(i32x4_as_i8x16, victor_i32x4, __m128i, victor_i8x16, __m128i, victor_i32x4_as_i8x16, a)
+LOAD(i32x4_load, int32_t, victor_i32x4, __m128i, victor_i32x4_load, _mm_loadu_si128((const __m128i*) src))
+LOAD(i32x4_load_aligned, int32_t, victor_i32x4, __m128i, victor_i32x4_load_aligned, _mm_load_si128((const __m128i*) src))
+STORE(i32x4_store, int32_t, victor_i32x4, __m128i, victor_i32x4_store, _mm_storeu_si128((__m128i*) dest, a))
+STORE(i32x4_store_aligned, int32_t, victor_i32x4, __m128i, victor_i32x4_store_aligned, _mm_store_si128((__m128i*) dest, a))
+victor_i32x4 wrap_i32x4_set1(int32_t value) { return victor_i32x4_set1(value); }
+__m128i raw_i32x4_set1(int32_t value) { return _mm_set1_epi32(value); }
+#if defined(VICTOR_ENABLE_SSE4_1)
+  BINARY(i32x4_mul, victor_i32x4, __m128i, victor_i32x4_mul, _mm_mullo_epi32(a, b))
+  SELECT(i32x4_select, victor_i32x4, __m128i, victor_i32x4_select, _mm_blendv_epi8(b, a, mask))
+  LOAD(i32x4_load_stream, int32_t, victor_i32x4, __m128i, victor_i32x4_load_stream, _mm_stream_load_si128((__m128i*) src))
+#endif
+#if defined(VICTOR_ENABLE_AVX2)
+  BINARY(i32x4_shlv, victor_i32x4, __m128i, victor_i32x4_shlv, _mm_sllv_epi32(a, b))
+  BINARY(i32x4_shrv, victor_i32x4, __m128i, victor_i32x4_shrv, _mm_srav_epi32(a, b))
+  victor_i32x4 wrap_i32x4_gather(const int32_t* base, victor_i32x4 indices) { return victor_i32x4_gather(base, indices); }
+  __m128i raw_i32x4_gather(const int32_t* base, __m128i indices) { return _mm_i32gather_epi32(base, indices, 4); }
+#endif
+
+/* i8x16 */
+BINARY(i8x16_add, victor_i8x16, __m128i, victor_i8x16_add, _mm_add_epi8(a, b))
+BINARY(i8x16_sub, victor_i8x16, __m128i, victor_i8x16_sub, _mm_sub_epi8(a, b))
+BINARY(i8x16_and, victor_i8x16, __m128i, victor_i8x16_and, _mm_and_si128(a, b))
+BINARY(i8x16_and_not, victor_i8x16, __m128i, victor_i8x16_and_not, _mm_andnot_si128(b, a))
+BINARY(i8x16_or, victor_i8x16, __m128i, victor_i8x16_or, _mm_or_si128(a, b))
+BINARY(i8x16_xor, victor_i8x16, __m128i, victor_i8x16_xor, _mm_xor_si128(a, b))
+BINARY(i8x16_adds, victor_i8x16, __m128i, victor_i8x16_adds, _mm_adds_epi8(a, b))
+BINARY(i8x16_subs, victor_i8x16, __m128i, victor_i8x16_subs, _mm_subs_epi8(a, b))
+COMPARE(i8x16_cmpgt, victor_i8x16, __m128i, victor_mask8x16, victor_i8x16_cmpgt, _mm_cmpgt_epi8(a, b))
+UNARY(i8x16_as_i32x4, victor_i8x16, __m128i, victor_i32x4, __m128i, victor_i8x16_as_i32x4, a)
+UNARY(i8x16_as_f32x4, victor_i8x16, __m128i, victor_f32x4, __m128, victor_i8x16_as_f32x4, _mm_castsi128_ps(a))
+LOAD(i8x16_load, int8_t, victor_i8x16, __m128i, victor_i8x16_load, _mm_loadu_si128((const __m128i*) src))
+STORE(i8x16_store, int8_t, victor_i8x16, __m128i, victor_i8x16_store, _mm_storeu_si128((__m128i*) dest, a))
+victor_i8x16 wrap_i8x16_set1(int8_t value) { return victor_i8x16_set1(value); }
+__m128i raw_i8x16_set1(int8_t value) { return _mm_set1_epi8(value); }
+#if defined(VICTOR_ENABLE_SSE4_1)
+  UNARY(i8x16_abs, victor_i8x16, __m128i, victor_i8x16, __m128i, victor_i8x16_abs, _mm_abs_epi8(a))
+  UNARY(i8x16_to_i16x8, victor_i8x16, __m128i, victor_i16x8, __m128i, victor_i8x16_to_i16x8, _mm_cvtepi8_epi16(a))
+#endif
+
+/* 256-bit */
+#if defined(VICTOR_ENABLE_AVX)
+  BINARY(f32x8_add, victor_f32x8, __m256, victor_f32x8_add, _mm256_add_ps(a, b))
+  BINARY(f32x8_and, victor_f32x8, __m256, victor_f32x8_and, _mm256_and_ps(a, b))
+  BINARY(f32x8_and_not, victor_f32x8, __m256, victor_f32x8_and_not, _mm256_andnot_ps(b, a))
+  LOAD(f32x8_load, float, victor_f32x8, __m256, victor_f32x8_load, _mm256_loadu_ps(src))
+  STORE(f32x8_store_aligned, float, victor_f32x8, __m256, victor_f32x8_store_aligned, _mm256_store_ps(dest, a))
+#endif
+#if defined(VICTOR_ENABLE_FMA)
+  TERNARY(f32x8_fmadd, victor_f32x8, __m256, victor_f32x8_fmadd, _mm256_fmadd_ps(a, b, c))
+#endif
+#if defined(VICTOR_ENABLE_AVX2)
+  BINARY(i32x8_add, victor_i32x8, __m256i, victor_i32x8_add, _mm256_add_epi32(a, b))
+  BINARY(i32x8_and, victor_i32x8, __m256i, victor_i32x8_and, _mm256_and_si256(a, b))
+  BINARY(i32x8_and_not, victor_i32x8, __m256i, victor_i32x8_and_not, _mm256_andnot_si256(b, a))
+  UNARY(f32x8_to_i32x8, victor_f32x8, __m256, victor_i32x8, __m256i, victor_f32x8_to_i32x8, _mm256_cvtps_epi32(a))
+  UNARY(i32x8_to_f32x8, victor_i32x8, __m256i, victor_f32x8, __m256, victor_i32x8_to_f32x8, _mm256_cvtepi32_ps(a))
+  LOAD(i32x8_load, int32_t, victor_i32x8, __m256i, victor_i32x8_load, _mm256_loadu_si256((const __m256i*) src))
+  STORE(i32x8_store, int32_t, victor_i32x8, __m256i, victor_i32x8_store, _mm256_storeu_si256((__m256i*) dest, a))
+  victor_i32x8 wrap_i32x8_gather(const int32_t* base, victor_i32x8 indices) { return victor_i32x8_gather(base, indices); }
+  __m256i raw_i32x8_gather(const int32_t* base, __m256i indices) { return _mm256_i32gather_epi32(base, indices, 4); }
+  BINARY(i8x32_add, victor_i8x32, __m256i, victor_i8x32_add, _mm256_add_epi8(a, b))
+  BINARY(i8x32_and_not, victor_i8x32, __m256i, victor_i8x32_and_not, _mm256_andnot_si256(b, a))
+#endif
+
+/* 512-bit */
+#if defined(VICTOR_ENABLE_AVX512F)
+  BINARY(f32x16_add, victor_f32x16, __m512, victor_f32x16_add, _mm512_add_ps(a, b))
+  #if defined(VICTOR_ENABLE_AVX512DQ)
+    BINARY(f32x16_and_not, victor_f32x16, __m512, victor_f32x16_and_not, _mm512_andnot_ps(b, a))
+  #else
+    BINARY(f32x16_and_not, victor_f32x16, __m512, victor_f32x16_and_not, _mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(b), _mm512_castps_si512(a))))
+  #endif
+  TERNARY(f32x16_fmadd, victor_f32x16, __m512, victor_f32x16_fmadd, _mm512_fmadd_ps(a, b, c))
+  UNARY(f32x16_to_i32x16, victor_f32x16, __m512, victor_i32x16, __m512i, victor_f32x16_to_i32x16, _mm512_cvtps_epi32(a))
+  LOAD(f32x16_load, float, victor_f32x16, __m512, victor_f32x16_load, _mm512_loadu_ps(src))
+  STORE(f32x16_store_aligned, float, victor_f32x16, __m512, victor_f32x16_store_aligned, _mm512_store_ps(dest, a))
+  victor_mask16 wrap_f32x16_cmplt(victor_f32x16 a, victor_f32x16 b) { return victor_f32x16_cmplt(a, b); }
+  __mmask16 raw_f32x16_cmplt(__m512 a, __m512 b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+  victor_f32x16 wrap_f32x16_maskz_add(victor_mask16 k, victor_f32x16 a, victor_f32x16 b) { return victor_f32x16_maskz_add(k, a, b); }
+  __m512 raw_f32x16_maskz_add(__mmask16 k, __m512 a, __m512 b) { return _mm512_maskz_add_ps(k, a, b); }
+  BINARY(i32x16_add, victor_i32x16, __m512i, victor_i32x16_add, _mm512_add_epi32(a, b))
+  BINARY(i32x16_and_not, victor_i32x16, __m512i, victor_i32x16_and_not, _mm512_andnot_si512(b, a))
+  victor_mask16 wrap_i32x16_cmplt(victor_i32x16 a, victor_i32x16 b) { return victor_i32x16_cmplt(a, b); }
+  __mmask16 raw_i32x16_cmplt(__m512i a, __m512i b) { return _mm512_cmplt_epi32_mask(a, b); }
+  victor_i32x16 wrap_i32x16_gather(const int32_t* base, victor_i32x16 indices) { return victor_i32x16_gather(base, indices); }
+  __m512i raw_i32x16_gather(const int32_t* base, __m512i indices) { return _mm512_i32gather_epi32(indices, base, 4); }
+#endif
+#if defined(VICTOR_ENABLE_AVX512BW)
+  BINARY(i8x64_add, victor_i8x64, __m512i, victor_i8x64_add, _mm512_add_epi8(a, b))
+  BINARY(i8x64_and_not, victor_i8x64, __m512i, victor_i8x64_and_not, _mm512_andnot_si512(b, a))
+#endif
+
+/* A few operations strung together, so the values have to stay in
+   registers between calls. */
+victor_f32x4 wrap_f32x4_chain(victor_f32x4 a, victor_f32x4 b) {
+  return victor_f32x4_mul(victor_f32x4_add(a, b), victor_f32x4_sub(a, b));
+}
+__m128 raw_f32x4_chain(__m128 a, __m128 b) {
+  return _mm_mul_ps(_mm_add_ps(a, b), _mm_sub_ps(a, b));
+}
+
+victor_i32x4 wrap_i32x4_chain(victor_i32x4 a, victor_i32x4 b) {
+  return victor_i32x4_xor(victor_i32x4_shl(victor_i32x4_add(a, b), 3), victor_i32x4_and_not(a, b));
+}
+__m128i raw_i32x4_chain(__m128i a, __m128i b) {
+  return _mm_xor_si128(_mm_slli_epi32(_mm_add_epi32(a, b), 3), _mm_andnot_si128(b, a));
+}
+
+void wrap_f32x4_saxpy(float* y, const float* x, float a) {
+  victor_f32x4_store(y, victor_f32x4_add(victor_f32x4_mul(victor_f32x4_set1(a), victor_f32x4_load(x)), victor_f32x4_load(y)));
+}
+void raw_f32x4_saxpy(float* y, const float* x, float a) {
+  _mm_storeu_ps(y, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a), _mm_loadu_ps(x)), _mm_loadu_ps(y)));
+}
@@ -0,0 +1,100 @@
+#!/bin/sh
+# usage: compare.sh OBJECT [EXPECTED]
+#
+# Disassembles OBJECT and checks that every wrap_NAME function has the
+# same instructions as raw_NAME.  Addresses, comments, padding nops
+# and the names of constant pool entries are ignored; branches within
+# the function are compared by offset, the two register sources of
+# commutative AVX instructions are sorted, and relocations are shown so
+# a call which didn't get inlined shows up as a difference.
+#
+# EXPECTED, if given, is a file with one NAME per line whose pair is
+# known to differ.  Those pairs must still differ (so a fix doesn't go
+# unnoticed), and every one of them must exist.
+
+set -e
+
+obj="$1"
+expected="${2:-/dev/null}"
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT INT TERM
+
+${OBJDUMP:-objdump} -d -r -C --no-show-raw-insn "$obj" | awk -v dir="$tmp" '
+  /^[0-9a-f]+ <.*>:$/ {
+    name = $0
+    sub(/^[0-9a-f]+ </, "", name)
+    sub(/[(>].*$/, "", name)
+    if (out != "")
+      close(out)
+    out = (name ~ /^(wrap|raw)_/) ? dir "/" name : ""
+    next
+  }
+  /^$/ { next }
+  out != "" {
+    line = $0
+    sub(/^ *[0-9a-f]+:[ \t]*/, "", line)
+    sub(/[ \t]*#.*$/, "", line)
+    gsub(/[0-9a-f]+ <(wrap|raw)_[^>+]*/, "<", line)
+    gsub(/\.LC[0-9]+|\.rodata[.a-z0-9]*/, ".LC", line)
+    gsub(/\.LC[-+]0x[0-9a-f]+/, ".LC", line)
+    gsub(/[ \t]+/, " ", line)
+    # A register copy is the same whichever domain or element size the
+    # mnemonic names, and with AVX-512 GCC picks the EVEX vmovdqu8 for
+    # byte vectors.
+    if (line ~ /^v?mov(aps|apd|dqa|dqa32|dqa64) %[xyz]mm[0-9]+,%[xyz]mm[0-9]+$/)
+      sub(/mov(aps|apd|dqa32|dqa64|dqa)/, "movdqa", line)
+    sub(/^vmovdqu(8|16|32|64) /, "vmovdqu ", line)
+    # GCC is free to swap the sources of a commutative instruction, so
+    # put two register sources in a fixed order.
+    if (match(line, /^v(add|mul|and|or|xor)p[sd] |^vp(add|mullo|and|or|xor|cmpeq)[bwdq]* /) &&
+        split(substr(line, RLENGTH + 1), op, ",") == 3 && op[1] > op[2] && op[1] op[2] !~ /[(]/)
+      line = substr(line, 1, RLENGTH) op[2] "," op[1] "," op[3]
+    if (line ~ /^(cs |ds |data16 )*(nop|xchg %ax,%ax|int3)/ || line == "")
+      next
+    print line > out
+  }
+'
+
+status=0
+count=0
+known=0
+for raw in "$tmp"/raw_*; do
+  [ -e "$raw" ] || break
+  name=${raw##*/raw_}
+  count=$((count + 1))
+  if [ ! -e "$tmp/wrap_$name" ]; then
+    echo "$obj: wrap_$name is missing"
+    status=1
+  elif grep -qx "$name" "$expected"; then
+    known=$((known + 1))
+    if diff "$raw" "$tmp/wrap_$name" > /dev/null; then
+      echo "$obj: wrap_$name is expected to differ from raw_$name, but matches it"
+      status=1
+    fi
+  elif ! diff -u "$raw" "$tmp/wrap_$name" > "$tmp/diff"; then
+    echo "$obj: wrap_$name differs from raw_$name:"
+    sed -n '3,$p' "$tmp/diff"
+    status=1
+  fi
+done
+
+for name in $(cat "$expected"); do
+  if [ ! -e "$tmp/raw_$name" ]; then
+    echo "$obj: $expected lists $name, but there is no raw_$name"
+    status=1
+  fi
+done
+
+if [ "$count" -eq 0 ]; then
+  echo "$obj: no raw_* functions found"
+  exit 1
+fi
+
+if [ $status -eq 0 ]; then
+  if [ $known -eq 0 ]; then
+    echo "$obj: $count pairs match"
+  else
+    echo "$obj: $((count - known)) pairs match, $known differ as expected"
+  fi
+fi
+exit $status
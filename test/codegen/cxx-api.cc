@@ -0,0 +1,147 @@
+/* The C++ API counterpart of c-api.c: wrap_NAME uses Victor's classes
+ * and operators, raw_NAME the Intel intrinsics. */
+
+#include "victor/victor.h"
+
+using namespace Victor;
+
+#define BINARY(name, V, N, victor_expr, raw_expr) \
+  V wrap_##name(V a, V b) { return victor_expr; } \
+  N raw_##name(N a, N b) { return raw_expr; }
+
+#define UNARY(name, V, N, W, M, victor_expr, raw_expr) \
+  W wrap_##name(V a) { return victor_expr; } \
+  M raw_##name(N a) { return raw_expr; }
+
+#define COMPARE(name, V, N, victor_expr, raw_expr) \
+  mask32x4 wrap_##name(V a, V b) { return victor_expr; } \
+  __m128i raw_##name(N a, N b) { return raw_expr; }
+
+#define SHIFT(name, V, N, victor_expr, raw_expr) \
+  V wrap_##name(V a, int count) { return victor_expr; } \
+  N raw_##name(N a, int count) { return raw_expr; }
+
+/* f32x4 */
+BINARY(f32x4_add, f32x4, __m128, a + b, _mm_add_ps(a, b))
+BINARY(f32x4_sub, f32x4, __m128, a - b, _mm_sub_ps(a, b))
+BINARY(f32x4_mul, f32x4, __m128, a * b, _mm_mul_ps(a, b))
+BINARY(f32x4_div, f32x4, __m128, a / b, _mm_div_ps(a, b))
+BINARY(f32x4_and, f32x4, __m128, a & b, _mm_and_ps(a, b))
+BINARY(f32x4_or, f32x4, __m128, a | b, _mm_or_ps(a, b))
+BINARY(f32x4_xor, f32x4, __m128, a ^ b, _mm_xor_ps(a, b))
+BINARY(f32x4_add_assign, f32x4, __m128, a += b, a = _mm_add_ps(a, b))
+COMPARE(f32x4_lt, f32x4, __m128, a < b, _mm_castps_si128(_mm_cmplt_ps(a, b)))
+COMPARE(f32x4_eq, f32x4, __m128, a == b, _mm_castps_si128(_mm_cmpeq_ps(a, b)))
+UNARY(f32x4_to_i32x4_trunc, f32x4, __m128, i32x4, __m128i, a.to_i32x4_trunc(), _mm_cvttps_epi32(a))
+UNARY(f32x4_as_i32x4, f32x4, __m128, i32x4, __m128i, a.as_i32x4(), _mm_castps_si128(a))
+UNARY(f32x4_as_i8x16, f32x4, __m128, i8x16, __m128i, a.as_i8x16(), _mm_castps_si128(a))
+f32x4 wrap_f32x4_load(const float* src) { return f32x4::load(src); }
+__m128 raw_f32x4_load(const float* src) { return _mm_loadu_ps(src); }
+f32x4 wrap_f32x4_load_aligned(const float* src) { return f32x4::load_aligned(src); }
+__m128 raw_f32x4_load_aligned(const float* src) { return _mm_load_ps(src); }
+void wrap_f32x4_store(float* dest, f32x4 a) { a.store(dest); }
+void raw_f32x4_store(float* dest, __m128 a) { _mm_storeu_ps(dest, a); }
+void wrap_f32x4_store_stream(float* dest, f32x4 a) { a.store_stream(dest); }
+void raw_f32x4_store_stream(float* dest, __m128 a) { _mm_stream_ps(dest, a); }
+f32x4 wrap_f32x4_broadcast(float value) { return f32x4(value); }
+__m128 raw_f32x4_broadcast(float value) { return _mm_set1_ps(value); }
+f32x4 wrap_f32x4_set(float e0, float e1, float e2, float e3) { return f32x4(e0, e1, e2, e3); }
+__m128 raw_f32x4_set(float e0, float e1, float e2, float e3) { return _mm_setr_ps(e0, e1, e2, e3); }
+#if defined(VICTOR_ENABLE_SSE4_1)
+  UNARY(f32x4_floor, f32x4, __m128, f32x4, __m128, a.floor(), _mm_round_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC))
+#endif
+#if defined(VICTOR_ENABLE_FMA)
+  f32x4 wrap_f32x4_fmadd(f32x4 a, f32x4 b, f32x4 c) { return fmadd(a, b, c); }
+  __m128 raw_f32x4_fmadd(__m128 a, __m128 b, __m128 c) { return _mm_fmadd_ps(a, b, c); }
+#endif
+
+/* i32x4 */
+BINARY(i32x4_add, i32x4, __m128i, a + b, _mm_add_epi32(a, b))
+BINARY(i32x4_sub, i32x4, __m128i, a - b, _mm_sub_epi32(a, b))
+BINARY(i32x4_and, i32x4, __m128i, a & b, _mm_and_si128(a, b))
+BINARY(i32x4_or, i32x4, __m128i, a | b, _mm_or_si128(a, b))
+BINARY(i32x4_xor, i32x4, __m128i, a ^ b, _mm_xor_si128(a, b))
+BINARY(i32x4_and_not, i32x4, __m128i, a.and_not(b), _mm_andnot_si128(b, a))
+SHIFT(i32x4_shl, i32x4, __m128i, a << count, _mm_slli_epi32(a, count))
+SHIFT(i32x4_shr, i32x4, __m128i, a >> count, _mm_srai_epi32(a, count))
+COMPARE(i32x4_gt, i32x4, __m128i, a > b, _mm_cmpgt_epi32(a, b))
+UNARY(i32x4_to_f32x4, i32x4, __m128i, f32x4, __m128, a.to_f32x4(), _mm_cvtepi32_ps(a))
+UNARY(i32x4_as_i8x16, i32x4, __m128i, i8x16, __m128i, a.as_i8x16(), a)
+i32x4 wrap_i32x4_load(const int32_t* src) { return i32x4::load(src); }
+__m128i raw_i32x4_load(const int32_t* src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+void wrap_i32x4_store(int32_t* dest, i32x4 a) { a.store(dest); }
+void raw_i32x4_store(int32_t* dest, __m128i a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), a); }
+#if defined(VICTOR_ENABLE_SSE4_1)
+  BINARY(i32x4_mul, i32x4, __m128i, a * b, _mm_mullo_epi32(a, b))
+#endif
+#if defined(VICTOR_ENABLE_AVX2)
+  BINARY(i32x4_shlv, i32x4, __m128i, a << b, _mm_sllv_epi32(a, b))
+  BINARY(i32x4_shrv, i32x4, __m128i, a >> b, _mm_srav_epi32(a, b))
+#endif
+
+/* i8x16 */
+BINARY(i8x16_add, i8x16, __m128i, a + b, _mm_add_epi8(a, b))
+BINARY(i8x16_sub, i8x16, __m128i, a - b, _mm_sub_epi8(a, b))
+BINARY(i8x16_and, i8x16, __m128i, a & b, _mm_and_si128(a, b))
+BINARY(i8x16_or, i8x16, __m128i, a | b, _mm_or_si128(a, b))
+BINARY(i8x16_xor, i8x16, __m128i, a ^ b, _mm_xor_si128(a, b))
+UNARY(i8x16_as_i32x4, i8x16, __m128i, i32x4, __m128i, a.as_i32x4(), a)
+UNARY(i8x16_as_f64x2, i8x16, __m128i, f64x2, __m128d, a.as_f64x2(), _mm_castsi128_pd(a))
+i8x16 wrap_i8x16_load(const int8_t* src) { return i8x16::load(src); }
+__m128i raw_i8x16_load(const int8_t* src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+
+/* 256-bit */
+#if defined(VICTOR_ENABLE_AVX)
+  BINARY(f32x8_add, f32x8, __m256, a + b, _mm256_add_ps(a, b))
+  BINARY(f32x8_and, f32x8, __m256, a & b, _mm256_and_ps(a, b))
+  BINARY(f32x8_and_not, f32x8, __m256, a.and_not(b), _mm256_andnot_ps(b, a))
+  f32x8 wrap_f32x8_load(const float* src) { return f32x8::load(src); }
+  __m256 raw_f32x8_load(const float* src) { return _mm256_loadu_ps(src); }
+  void wrap_f32x8_store_aligned(float* dest, f32x8 a) { a.store_aligned(dest); }
+  void raw_f32x8_store_aligned(float* dest, __m256 a) { _mm256_store_ps(dest, a); }
+#endif
+#if defined(VICTOR_ENABLE_FMA)
+  f32x8 wrap_f32x8_fmadd(f32x8 a, f32x8 b, f32x8 c) { return fmadd(a, b, c); }
+  __m256 raw_f32x8_fmadd(__m256 a, __m256 b, __m256 c) { return _mm256_fmadd_ps(a, b, c); }
+#endif
+#if defined(VICTOR_ENABLE_AVX2)
+  BINARY(i32x8_add, i32x8, __m256i, a + b, _mm256_add_epi32(a, b))
+  BINARY(i32x8_and_not, i32x8, __m256i, a.and_not(b), _mm256_andnot_si256(b, a))
+  UNARY(i32x8_to_f32x8, i32x8, __m256i, f32x8, __m256, a.to_f32x8(), _mm256_cvtepi32_ps(a))
+  i32x8 wrap_i32x8_gather(const int32_t* base, i32x8 indices) { return i32x8::gather(base, indices); }
+  __m256i raw_i32x8_gather(const int32_t* base, __m256i indices) { return _mm256_i32gather_epi32(base, indices, 4); }
+  BINARY(i8x32_add, i8x32, __m256i, a + b, _mm256_add_epi8(a, b))
+#endif
+
+/* 512-bit */
+#if defined(VICTOR_ENABLE_AVX512F)
+  BINARY(f32x16_add, f32x16, __m512, a + b, _mm512_add_ps(a, b))
+  f32x16 wrap_f32x16_fmadd(f32x16 a, f32x16 b, f32x16 c) { return fmadd(a, b, c); }
+  __m512 raw_f32x16_fmadd(__m512 a, __m512 b, __m512 c) { return _mm512_fmadd_ps(a, b, c); }
+  mask16 wrap_f32x16_lt(f32x16 a, f32x16 b) { return a < b; }
+  __mmask16 raw_f32x16_lt(__m512 a, __m512 b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+  f32x16 wrap_f32x16_load(const float* src) { return f32x16::load(src); }
+  __m512 raw_f32x16_load(const float* src) { return _mm512_loadu_ps(src); }
+  BINARY(i32x16_add, i32x16, __m512i, a + b, _mm512_add_epi32(a, b))
+  BINARY(i32x16_and, i32x16, __m512i, a & b, _mm512_and_si512(a, b))
+  mask16 wrap_i32x16_gt(i32x16 a, i32x16 b) { return a > b; }
+  __mmask16 raw_i32x16_gt(__m512i a, __m512i b) { return _mm512_cmpgt_epi32_mask(a, b); }
+  void wrap_i32x16_store(int32_t* dest, i32x16 a) { a.store(dest); }
+  void raw_i32x16_store(int32_t* dest, __m512i a) { _mm512_storeu_si512(dest, a); }
+#endif
+#if defined(VICTOR_ENABLE_AVX512BW)
+  BINARY(i8x64_add, i8x64, __m512i, a + b, _mm512_add_epi8(a, b))
+#endif
+
+/* Operators strung together, as in c-api.c.  GCC evaluates the object
+   of a member operator before its argument but function arguments
+   right to left, so the raw version names the left operand first to get
+   the same schedule. */
+f32x4 wrap_f32x4_chain(f32x4 a, f32x4 b) { return (a + b) * (a - b); }
+__m128 raw_f32x4_chain(__m128 a, __m128 b) { const __m128 s = _mm_add_ps(a, b); return _mm_mul_ps(s, _mm_sub_ps(a, b)); }
+
+i32x4 wrap_i32x4_chain(i32x4 a, i32x4 b) { return ((a + b) << 3) ^ a.and_not(b); }
+__m128i raw_i32x4_chain(__m128i a, __m128i b) { return _mm_xor_si128(_mm_slli_epi32(_mm_add_epi32(a, b), 3), _mm_andnot_si128(b, a)); }
+
+void wrap_f32x4_saxpy(float* y, const float* x, float a) { (f32x4(a) * f32x4::load(x) + f32x4::load(y)).store(y); }
+void raw_f32x4_saxpy(float* y, const float* x, float a) { _mm_storeu_ps(y, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a), _mm_loadu_ps(x)), _mm_loadu_ps(y))); }
@@ -0,0 +1,56 @@
+#!/bin/sh
+# usage: check.sh PROGRAM FUNCTION
+#
+# Disassembles PROGRAM and fails if FUNCTION, or anything it calls
+# (directly or indirectly, other than through the PLT), uses a VEX or
+# EVEX instruction.  Those are the ones that need AVX, so they are what
+# makes the SSE2 tier crash with SIGILL on an older CPU.  Every VEX and
+# EVEX mnemonic starts with "v" (vmovaps, vpaddd, vzeroupper, ...), and
+# the AVX-512 mask instructions start with "k".  Functions are tracked
+# by address, since each tier has its own copy of Victor's static
+# helpers under the same name.
+
+${OBJDUMP:-objdump} -d --no-show-raw-insn "$1" | awk -v root="$2" '
+  /^[0-9a-f]+ <.*>:$/ {
+    fn = $1
+    sub(/^0+/, "", fn)
+    name[fn] = substr($0, index($0, "<") + 1)
+    sub(/>:$/, "", name[fn])
+    if (name[fn] == root)
+      start = fn
+    next
+  }
+  fn != "" && /^ *[0-9a-f]+:/ {
+    line = $0
+    sub(/^ *[0-9a-f]+:[ \t]*/, "", line)
+    if (line ~ /^(v|k)[a-z0-9]+ /)
+      avx[fn] = avx[fn] "\n    " line
+    if (line ~ /^(call|jmp)[a-z]* +[0-9a-f]+ <[^>+]*>$/ && line !~ /@plt>$/) {
+      split(line, op, " ")
+      if (op[2] != fn)
+        calls[fn] = calls[fn] " " op[2]
+    }
+  }
+  END {
+    if (start == "") {
+      printf("%s: not found\n", root)
+      exit 1
+    }
+    queue[0] = start; n = 1; seen[start] = 1; bad = 0
+    for (i = 0 ; i < n ; i++) {
+      f = queue[i]
+      if (f in avx) {
+        printf("%s uses AVX:%s\n", name[f], avx[f])
+        bad = 1
+      }
+      m = split(calls[f], c, " ")
+      for (j = 1 ; j <= m ; j++)
+        if (!(c[j] in seen)) {
+          seen[c[j]] = 1
+          queue[n++] = c[j]
+        }
+    }
+    if (!bad)
+      printf("%s: %d functions, no AVX\n", root, n)
+    exit bad
+  }'
@@ -0,0 +1,11 @@
+/* Compiled once per tier.  Everything here comes from the C++ API's
+   inline functions and templates, which is what the linker used to
+   merge across tiers. */
+
+#include "victor/victor.h"
+#include "victor/dispatch.h"
+
+extern "C" float VICTOR_DISPATCH_NAME(kernel)(const float* x, size_t n) {
+  const Victor::blocked<Victor::f32x4, 2> b = Victor::blocked<Victor::f32x4, 2>::load(x);
+  return Victor::sum_kahan(x, n) + Victor::dot(x, x, n) + Victor::math::exp(b.fold_add()).reduce_add();
+}
@@ -0,0 +1,28 @@
+#include "victor/victor.h"
+#include "victor/dispatch.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+extern "C" float kernel_sse2(const float* x, size_t n);
+extern "C" float kernel_avx2(const float* x, size_t n);
+
+int main(void) {
+  float x[100];
+  for (size_t i = 0 ; i < sizeof(x) / sizeof(x[0]) ; i++)
+    x[i] = static_cast<float>(i % 7) * 0.25f;
+
+  /* The SSE2 version runs everywhere; the AVX2 one only if the CPU
+     has it.  check.sh is what makes sure the SSE2 one would also run
+     on a CPU without AVX. */
+  const float low = kernel_sse2(x, sizeof(x) / sizeof(x[0]));
+  if (victor_dispatch_tier() >= VICTOR_TIER_AVX2) {
+    const float high = kernel_avx2(x, sizeof(x) / sizeof(x[0]));
+    if (fabsf(low - high) > 1e-3f * fabsf(low)) {
+      fprintf(stderr, "sse2 %g != avx2 %g\n", low, high);
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,603 @@
+/* algorithm.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+/* Loops over arrays.
+ *
+ * Victor::transform<V>(in, out, n, op) sets out[i] = op(in[i]) for the
+ * first n elements, and Victor::zip_transform<V>(a, b, out, n, op)
+ * sets out[i] = op(a[i], b[i]); op is a function or function object
+ * (such as a lambda) taking and returning V:
+ *
+ *   Victor::transform<Victor::f32x4>(x, y, n,
+ *     [](Victor::f32x4 v) { return v * v + 1.0f; });
+ *
+ * The main loop is unrolled four times and stores to aligned memory.
+ * Rather than finishing with a scalar loop (which op couldn't run
+ * anyway), the unaligned head and the tail are each done with one
+ * full vector which overlaps the main loop, so op can be applied to
+ * some elements twice, but always to the original input; in-place
+ * transforms (out == in) are fine, other overlap between inputs and
+ * output isn't.  Arrays shorter than a single vector are read with
+ * load_partial and written with store_partial, so op also sees some
+ * zeros (in the lanes past the end), but only n elements are stored.
+ *
+ * There are also reductions over float, int32_t and int8_t arrays:
+ * Victor::sum (plus sum_pairwise and sum_kahan for floats), dot, norm2,
+ * min_element and max_element.
+ *
+ * Victor::vector_traits<V> gives the element type (value_type), native
+ * type (native_type) and number of lanes (lanes) for each vector
+ * type, and whether fmadd() and friends are really fused for it
+ * (fma_is_fused). */
+
+#if !defined(VICTOR_ALGORITHM_H)
+#define VICTOR_ALGORITHM_H
+
+#include <math.h>
+
+#if defined(VICTOR_ENABLE_CXX_API) && defined(VICTOR_ENABLE_SSE2)
+  VICTOR_X_BEGIN_NAMESPACE
+    template <typename V> struct vector_traits;
+
+    #define VICTOR_X_VECTOR_TRAITS(V, T, N, Native, Fused) \
+      template <> struct vector_traits<V> { \
+        typedef T value_type; \
+        typedef Native native_type; \
+        enum { lanes = N, fma_is_fused = Fused }; \
+      }
+
+    VICTOR_X_VECTOR_TRAITS(i8x16, int8_t, 16, __m128i, 0);
+    VICTOR_X_VECTOR_TRAITS(u8x16, uint8_t, 16, __m128i, 0);
+    VICTOR_X_VECTOR_TRAITS(i16x8, int16_t, 8, __m128i, 0);
+    VICTOR_X_VECTOR_TRAITS(u16x8, uint16_t, 8, __m128i, 0);
+    VICTOR_X_VECTOR_TRAITS(i32x4, int32_t, 4, __m128i, 0);
+    VICTOR_X_VECTOR_TRAITS(u32x4, uint32_t, 4, __m128i, 0);
+    VICTOR_X_VECTOR_TRAITS(i64x2, int64_t, 2, __m128i, 0);
+    VICTOR_X_VECTOR_TRAITS(u64x2, uint64_t, 2, __m128i, 0);
+    VICTOR_X_VECTOR_TRAITS(f32x4, float, 4, __m128, VICTOR_FMA_IS_FUSED_f32x4);
+    VICTOR_X_VECTOR_TRAITS(f64x2, double, 2, __m128d, VICTOR_FMA_IS_FUSED_f64x2);
+    #if defined(VICTOR_ENABLE_AVX)
+      VICTOR_X_VECTOR_TRAITS(f32x8, float, 8, __m256, VICTOR_FMA_IS_FUSED_f32x8);
+      VICTOR_X_VECTOR_TRAITS(f64x4, double, 4, __m256d, VICTOR_FMA_IS_FUSED_f64x4);
+    #endif
+    #if defined(VICTOR_ENABLE_AVX2)
+      VICTOR_X_VECTOR_TRAITS(i8x32, int8_t, 32, __m256i, 0);
+      VICTOR_X_VECTOR_TRAITS(i32x8, int32_t, 8, __m256i, 0);
+    #endif
+    #if defined(VICTOR_ENABLE_AVX512F)
+      VICTOR_X_VECTOR_TRAITS(i32x16, int32_t, 16, __m512i, 0);
+      VICTOR_X_VECTOR_TRAITS(f32x16, float, 16, __m512, VICTOR_FMA_IS_FUSED_f32x16);
+    #endif
+    #if defined(VICTOR_ENABLE_AVX512BW)
+      VICTOR_X_VECTOR_TRAITS(i8x64, int8_t, 64, __m512i, 0);
+    #endif
+
+    #undef VICTOR_X_VECTOR_TRAITS
+
+    namespace algorithm_detail {
+      template <bool Aligned> struct store;
+      template <> struct store<true> {
+        template <typename V, typename T>
+        static inline void apply(T* dest, V v) VICTOR_NOEXCEPT { v.store_aligned(dest); }
+      };
+      template <> struct store<false> {
+        template <typename V, typename T>
+        static inline void apply(T* dest, V v) VICTOR_NOEXCEPT { v.store(dest); }
+      };
+
+      /* The inputs of a transform; f(i) is the result for elements
+         [i, i + lanes), and f.partial(n) the result for the first n
+         elements padded with zeros. */
+      template <typename V, typename Op>
+      struct unary {
+        typedef typename vector_traits<V>::value_type T;
+        const T* in;
+        Op& op;
+
+        unary(const T* in_, Op& op_) : in(in_), op(op_) { }
+        inline V operator()(size_t i) const { return op(V::load(in + i)); }
+        inline V partial(size_t n) const { return op(V::load_partial(in, n)); }
+      };
+
+      template <typename V, typename Op>
+      struct binary {
+        typedef typename vector_traits<V>::value_type T;
+        const T* a;
+        const T* b;
+        Op& op;
+
+        binary(const T* a_, const T* b_, Op& op_) : a(a_), b(b_), op(op_) { }
+        inline V operator()(size_t i) const { return op(V::load(a + i), V::load(b + i)); }
+        inline V partial(size_t n) const { return op(V::load_partial(a, n), V::load_partial(b, n)); }
+      };
+
+      /* out[i, end) = f(...); end - i must be a multiple of lanes.
+         Each group of four is computed before any of it is stored. */
+      template <typename V, bool Aligned, typename F>
+      inline void transform_body(const F& f, typename vector_traits<V>::value_type* out, size_t i, size_t end) {
+        const size_t N = vector_traits<V>::lanes;
+
+        for ( ; i + 4 * N <= end ; i += 4 * N) {
+          const V r0 = f(i);
+          const V r1 = f(i + N);
+          const V r2 = f(i + 2 * N);
+          const V r3 = f(i + 3 * N);
+          store<Aligned>::apply(out + i, r0);
+          store<Aligned>::apply(out + i + N, r1);
+          store<Aligned>::apply(out + i + 2 * N, r2);
+          store<Aligned>::apply(out + i + 3 * N, r3);
+        }
+        for ( ; i < end ; i += N)
+          store<Aligned>::apply(out + i, f(i));
+      }
+
+      template <typename V, typename F>
+      inline void transform(const F& f, typename vector_traits<V>::value_type* out, size_t n) {
+        typedef typename vector_traits<V>::value_type T;
+        const size_t N = vector_traits<V>::lanes;
+
+        if (n < N) {
+          if (n != 0)
+            f.partial(n).store_partial(out, n);
+          return;
+        }
+
+        /* Skip ahead to the first element of out which is aligned to
+           the vector size; if out isn't even aligned to the element
+           size we can't, so just use unaligned stores. */
+        const size_t misalign = HEDLEY_REINTERPRET_CAST(uintptr_t, out) % sizeof(V);
+        const bool aligned = (misalign % sizeof(T)) == 0;
+        const size_t start = aligned ? ((sizeof(V) - misalign) % sizeof(V)) / sizeof(T) : 0;
+        const size_t end = start + ((n - start) / N) * N;
+
+        /* The head and tail are computed before the body is stored so
+           that they see the original input if out == in. */
+        const V head = f(0);
+        const V tail = f(n - N);
+
+        if (aligned)
+          transform_body<V, true>(f, out, start, end);
+        else
+          transform_body<V, false>(f, out, start, end);
+
+        if (end != n)
+          tail.store(out + n - N);
+        if (start != 0)
+          head.store(out);
+      }
+    }
+
+    template <typename V, typename Op>
+    inline void transform(const typename vector_traits<V>::value_type* in, typename vector_traits<V>::value_type* out, size_t n, Op op) {
+      algorithm_detail::transform<V>(algorithm_detail::unary<V, Op>(in, op), out, n);
+    }
+
+    template <typename V, typename Op>
+    inline void zip_transform(const typename vector_traits<V>::value_type* a, const typename vector_traits<V>::value_type* b, typename vector_traits<V>::value_type* out, size_t n, Op op) {
+      algorithm_detail::transform<V>(algorithm_detail::binary<V, Op>(a, b, op), out, n);
+    }
+
+    /* Reductions over arrays.  Each loop keeps four independent
+       accumulators so consecutive adds don't wait on each other; the
+       tail goes through a zero-padded vector (min and max just reload
+       the last full vector, since repeating elements doesn't matter).
+       Integer sums and dot products are exact, in 64 bits. */
+    namespace algorithm_detail {
+      template <typename V>
+      inline V load_padded(const typename vector_traits<V>::value_type* src, size_t n) VICTOR_NOEXCEPT {
+        return V::load_partial(src, n);
+      }
+
+      /* Sign-extend the 32-bit lanes and add all four to the two
+         64-bit lanes of acc. */
+      inline __m128i add_epi32_to_epi64(__m128i acc, __m128i v) VICTOR_NOEXCEPT {
+        const __m128i sign = _mm_srai_epi32(v, 31);
+        return _mm_add_epi64(acc, _mm_add_epi64(_mm_unpacklo_epi32(v, sign), _mm_unpackhi_epi32(v, sign)));
+      }
+
+      inline int64_t reduce_add_epi64(__m128i v) VICTOR_NOEXCEPT {
+        int64_t r[2];
+        _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, r), v);
+        return r[0] + r[1];
+      }
+
+      /* Pairwise dot product of sixteen int8 lanes, as four int32
+         lanes; each is at most 2^16 in magnitude. */
+      inline __m128i dot_epi8(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+        return _mm_add_epi32(
+          _mm_madd_epi16(victor_x_mm_cvtepi8_epi16(a), victor_x_mm_cvtepi8_epi16(b)),
+          _mm_madd_epi16(victor_x_mm_cvtepi8hi_epi16(a), victor_x_mm_cvtepi8hi_epi16(b)));
+      }
+
+      /* Index of the first element equal to value, given that there is
+         one; used to turn the minimum or maximum into a position. */
+      template <typename T>
+      inline size_t find_first(const T* x, size_t n, T value) VICTOR_NOEXCEPT {
+        size_t i = 0;
+        while (i < n && !(x[i] == value))
+          i++;
+        return i;
+      }
+
+      inline size_t find_first(const float* x, size_t n, float value) VICTOR_NOEXCEPT {
+        const __m128 v = _mm_set1_ps(value);
+        size_t i = 0;
+        for ( ; i + 4 <= n ; i += 4) {
+          int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(x + i), v));
+          if (mask != 0) {
+            for ( ; !(mask & 1) ; mask >>= 1)
+              i++;
+            return i;
+          }
+        }
+        return i + find_first<float>(x + i, n - i, value);
+      }
+
+      inline size_t find_first(const int32_t* x, size_t n, int32_t value) VICTOR_NOEXCEPT {
+        const __m128i v = _mm_set1_epi32(value);
+        size_t i = 0;
+        for ( ; i + 4 <= n ; i += 4) {
+          int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, x + i)), v)));
+          if (mask != 0) {
+            for ( ; !(mask & 1) ; mask >>= 1)
+              i++;
+            return i;
+          }
+        }
+        return i + find_first<int32_t>(x + i, n - i, value);
+      }
+
+      inline size_t find_first(const int8_t* x, size_t n, int8_t value) VICTOR_NOEXCEPT {
+        const __m128i v = _mm_set1_epi8(value);
+        size_t i = 0;
+        for ( ; i + 16 <= n ; i += 16) {
+          int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, x + i)), v));
+          if (mask != 0) {
+            for ( ; !(mask & 1) ; mask >>= 1)
+              i++;
+            return i;
+          }
+        }
+        return i + find_first<int8_t>(x + i, n - i, value);
+      }
+
+      /* Minimum (Max = false) or maximum of x[0, n), n >= lanes.  NaNs
+         are skipped: minps returns its second operand if either is NaN,
+         so the accumulator always goes second. */
+      template <bool Max>
+      inline float extreme(const float* x, size_t n) VICTOR_NOEXCEPT {
+        #define VICTOR_X_EXTREME_PS(a, b) (Max ? _mm_max_ps((a), (b)) : _mm_min_ps((a), (b)))
+        const __m128 init = _mm_set1_ps(Max ? -HUGE_VALF : HUGE_VALF);
+        __m128 m0 = init, m1 = init, m2 = init, m3 = init;
+        size_t i = 0;
+        for ( ; i + 16 <= n ; i += 16) {
+          m0 = VICTOR_X_EXTREME_PS(_mm_loadu_ps(x + i), m0);
+          m1 = VICTOR_X_EXTREME_PS(_mm_loadu_ps(x + i + 4), m1);
+          m2 = VICTOR_X_EXTREME_PS(_mm_loadu_ps(x + i + 8), m2);
+          m3 = VICTOR_X_EXTREME_PS(_mm_loadu_ps(x + i + 12), m3);
+        }
+        for ( ; i + 4 <= n ; i += 4)
+          m0 = VICTOR_X_EXTREME_PS(_mm_loadu_ps(x + i), m0);
+        m1 = VICTOR_X_EXTREME_PS(_mm_loadu_ps(x + n - 4), m1);
+        m0 = VICTOR_X_EXTREME_PS(VICTOR_X_EXTREME_PS(m0, m1), VICTOR_X_EXTREME_PS(m2, m3));
+        #undef VICTOR_X_EXTREME_PS
+        return Max ? f32x4(m0).reduce_max() : f32x4(m0).reduce_min();
+      }
+
+      template <bool Max>
+      inline int32_t extreme(const int32_t* x, size_t n) VICTOR_NOEXCEPT {
+        #define VICTOR_X_EXTREME_EPI32(a, b) (Max ? victor_x_mm_max_epi32((a), (b)) : victor_x_mm_min_epi32((a), (b)))
+        __m128i m0 = i32x4::load(x).to_native(), m1 = m0, m2 = m0, m3 = i32x4::load(x + n - 4).to_native();
+        size_t i = 0;
+        for ( ; i + 16 <= n ; i += 16) {
+          m0 = VICTOR_X_EXTREME_EPI32(m0, i32x4::load(x + i).to_native());
+          m1 = VICTOR_X_EXTREME_EPI32(m1, i32x4::load(x + i + 4).to_native());
+          m2 = VICTOR_X_EXTREME_EPI32(m2, i32x4::load(x + i + 8).to_native());
+          m3 = VICTOR_X_EXTREME_EPI32(m3, i32x4::load(x + i + 12).to_native());
+        }
+        for ( ; i + 4 <= n ; i += 4)
+          m0 = VICTOR_X_EXTREME_EPI32(m0, i32x4::load(x + i).to_native());
+        m0 = VICTOR_X_EXTREME_EPI32(VICTOR_X_EXTREME_EPI32(m0, m1), VICTOR_X_EXTREME_EPI32(m2, m3));
+        #undef VICTOR_X_EXTREME_EPI32
+        return Max ? i32x4(m0).reduce_max() : i32x4(m0).reduce_min();
+      }
+
+      template <bool Max>
+      inline int8_t extreme(const int8_t* x, size_t n) VICTOR_NOEXCEPT {
+        #define VICTOR_X_EXTREME_EPI8(a, b) (Max ? victor_x_mm_max_epi8((a), (b)) : victor_x_mm_min_epi8((a), (b)))
+        __m128i m0 = i8x16::load(x).to_native(), m1 = m0, m2 = m0, m3 = i8x16::load(x + n - 16).to_native();
+        size_t i = 0;
+        for ( ; i + 64 <= n ; i += 64) {
+          m0 = VICTOR_X_EXTREME_EPI8(m0, i8x16::load(x + i).to_native());
+          m1 = VICTOR_X_EXTREME_EPI8(m1, i8x16::load(x + i + 16).to_native());
+          m2 = VICTOR_X_EXTREME_EPI8(m2, i8x16::load(x + i + 32).to_native());
+          m3 = VICTOR_X_EXTREME_EPI8(m3, i8x16::load(x + i + 48).to_native());
+        }
+        for ( ; i + 16 <= n ; i += 16)
+          m0 = VICTOR_X_EXTREME_EPI8(m0, i8x16::load(x + i).to_native());
+        m0 = VICTOR_X_EXTREME_EPI8(VICTOR_X_EXTREME_EPI8(m0, m1), VICTOR_X_EXTREME_EPI8(m2, m3));
+        #undef VICTOR_X_EXTREME_EPI8
+        return Max ? i8x16(m0).reduce_max() : i8x16(m0).reduce_min();
+      }
+
+      template <bool Max, typename T>
+      inline const T* extreme_element(const T* x, size_t n) VICTOR_NOEXCEPT {
+        const size_t N = 16 / sizeof(T);
+        size_t i;
+
+        if (n < N) {
+          /* Too short for a vector.  For floats this skips NaNs too,
+             since comparisons with NaN are false. */
+          size_t best = 0;
+          for (i = 1 ; i < n ; i++) {
+            if (x[i] == x[i] && (!(x[best] == x[best]) || (Max ? x[i] > x[best] : x[i] < x[best])))
+              best = i;
+          }
+          return x + (n == 0 ? 0 : best);
+        }
+
+        i = find_first(x, n, extreme<Max>(x, n));
+        /* Only possible if every element is NaN. */
+        return x + (i == n ? 0 : i);
+      }
+    }
+
+    /* Sum of x[0, n).  The float version rounds differently from a
+       sequential loop; sum_pairwise() and sum_kahan() are more
+       accurate, at some cost.  Integer sums are exact. */
+    inline float sum(const float* x, size_t n) VICTOR_NOEXCEPT {
+      f32x4 s0, s1, s2, s3;
+      size_t i = 0;
+      for ( ; i + 16 <= n ; i += 16) {
+        s0 += f32x4::load(x + i);
+        s1 += f32x4::load(x + i + 4);
+        s2 += f32x4::load(x + i + 8);
+        s3 += f32x4::load(x + i + 12);
+      }
+      for ( ; i + 4 <= n ; i += 4)
+        s0 += f32x4::load(x + i);
+      if (i != n)
+        s1 += algorithm_detail::load_padded<f32x4>(x + i, n - i);
+      return ((s0 + s1) + (s2 + s3)).reduce_add();
+    }
+
+    /* Splits the array in half until the pieces are small enough for
+       sum(), so the error grows with log(n) rather than n. */
+    inline float sum_pairwise(const float* x, size_t n) VICTOR_NOEXCEPT {
+      if (n <= 256)
+        return sum(x, n);
+      const size_t half = ((n / 2) + 15) & ~HEDLEY_STATIC_CAST(size_t, 15);
+      return sum_pairwise(x, half) + sum_pairwise(x + half, n - half);
+    }
+
+    /* Compensated (Kahan) summation in each lane, with the lanes
+       combined by Neumaier's variant.  The error doesn't grow with n.
+       Like any compensated sum this falls apart if the compiler is
+       allowed to reassociate floating-point math (-ffast-math, /fp:fast). */
+    inline float sum_kahan(const float* x, size_t n) VICTOR_NOEXCEPT {
+      f32x4 s[4], c[4];
+      float lanes[32];
+      size_t i = 0;
+      int k;
+
+      #define VICTOR_X_KAHAN_STEP(k, v) \
+        do { \
+          const f32x4 y_ = (v) - c[k]; \
+          const f32x4 t_ = s[k] + y_; \
+          c[k] = (t_ - s[k]) - y_; \
+          s[k] = t_; \
+        } while (0)
+      for ( ; i + 16 <= n ; i += 16) {
+        VICTOR_X_KAHAN_STEP(0, f32x4::load(x + i));
+        VICTOR_X_KAHAN_STEP(1, f32x4::load(x + i + 4));
+        VICTOR_X_KAHAN_STEP(2, f32x4::load(x + i + 8));
+        VICTOR_X_KAHAN_STEP(3, f32x4::load(x + i + 12));
+      }
+      for ( ; i + 4 <= n ; i += 4)
+        VICTOR_X_KAHAN_STEP(0, f32x4::load(x + i));
+      if (i != n)
+        VICTOR_X_KAHAN_STEP(1, algorithm_detail::load_padded<f32x4>(x + i, n - i));
+      #undef VICTOR_X_KAHAN_STEP
+
+      for (k = 0 ; k < 4 ; k++) {
+        s[k].store(lanes + 8 * k);
+        (f32x4() - c[k]).store(lanes + 8 * k + 4);
+      }
+
+      float total = 0.0f, comp = 0.0f;
+      for (k = 0 ; k < 32 ; k++) {
+        const float t = total + lanes[k];
+        if (fabsf(total) >= fabsf(lanes[k]))
+          comp += (total - t) + lanes[k];
+        else
+          comp += (lanes[k] - t) + total;
+        total = t;
+      }
+      return total + comp;
+    }
+
+    inline int64_t sum(const int32_t* x, size_t n) VICTOR_NOEXCEPT {
+      __m128i s0 = _mm_setzero_si128(), s1 = s0, s2 = s0, s3 = s0;
+      size_t i = 0;
+      for ( ; i + 16 <= n ; i += 16) {
+        s0 = algorithm_detail::add_epi32_to_epi64(s0, i32x4::load(x + i).to_native());
+        s1 = algorithm_detail::add_epi32_to_epi64(s1, i32x4::load(x + i + 4).to_native());
+        s2 = algorithm_detail::add_epi32_to_epi64(s2, i32x4::load(x + i + 8).to_native());
+        s3 = algorithm_detail::add_epi32_to_epi64(s3, i32x4::load(x + i + 12).to_native());
+      }
+      for ( ; i + 4 <= n ; i += 4)
+        s0 = algorithm_detail::add_epi32_to_epi64(s0, i32x4::load(x + i).to_native());
+      if (i != n)
+        s1 = algorithm_detail::add_epi32_to_epi64(s1, algorithm_detail::load_padded<i32x4>(x + i, n - i).to_native());
+      return algorithm_detail::reduce_add_epi64(_mm_add_epi64(_mm_add_epi64(s0, s1), _mm_add_epi64(s2, s3)));
+    }
+
+    /* psadbw sums each group of eight bytes into a 64-bit lane; as in
+       i8x16::reduce_add we flip the sign bits first and take the bias
+       back out at the end. */
+    inline int64_t sum(const int8_t* x, size_t n) VICTOR_NOEXCEPT {
+      const __m128i bias = _mm_set1_epi8(-128);
+      const __m128i zero = _mm_setzero_si128();
+      __m128i s0 = zero, s1 = zero, s2 = zero, s3 = zero;
+      size_t i = 0;
+      for ( ; i + 64 <= n ; i += 64) {
+        s0 = _mm_add_epi64(s0, _mm_sad_epu8(_mm_xor_si128(i8x16::load(x + i).to_native(), bias), zero));
+        s1 = _mm_add_epi64(s1, _mm_sad_epu8(_mm_xor_si128(i8x16::load(x + i + 16).to_native(), bias), zero));
+        s2 = _mm_add_epi64(s2, _mm_sad_epu8(_mm_xor_si128(i8x16::load(x + i + 32).to_native(), bias), zero));
+        s3 = _mm_add_epi64(s3, _mm_sad_epu8(_mm_xor_si128(i8x16::load(x + i + 48).to_native(), bias), zero));
+      }
+      for ( ; i + 16 <= n ; i += 16)
+        s0 = _mm_add_epi64(s0, _mm_sad_epu8(_mm_xor_si128(i8x16::load(x + i).to_native(), bias), zero));
+      if (i != n) {
+        s1 = _mm_add_epi64(s1, _mm_sad_epu8(_mm_xor_si128(algorithm_detail::load_padded<i8x16>(x + i, n - i).to_native(), bias), zero));
+        i += 16;
+      }
+      return algorithm_detail::reduce_add_epi64(_mm_add_epi64(_mm_add_epi64(s0, s1), _mm_add_epi64(s2, s3))) - HEDLEY_STATIC_CAST(int64_t, i) * 128;
+    }
+
+    /* Dot product of a[0, n) and b[0, n), using FMA when it's
+       available. */
+    inline float dot(const float* a, const float* b, size_t n) VICTOR_NOEXCEPT {
+      __m128 s0 = _mm_setzero_ps(), s1 = s0, s2 = s0, s3 = s0;
+      size_t i = 0;
+      for ( ; i + 16 <= n ; i += 16) {
+        s0 = victor_x_mm_fmadd_ps(f32x4::load(a + i).to_native(), f32x4::load(b + i).to_native(), s0);
+        s1 = victor_x_mm_fmadd_ps(f32x4::load(a + i + 4).to_native(), f32x4::load(b + i + 4).to_native(), s1);
+        s2 = victor_x_mm_fmadd_ps(f32x4::load(a + i + 8).to_native(), f32x4::load(b + i + 8).to_native(), s2);
+        s3 = victor_x_mm_fmadd_ps(f32x4::load(a + i + 12).to_native(), f32x4::load(b + i + 12).to_native(), s3);
+      }
+      for ( ; i + 4 <= n ; i += 4)
+        s0 = victor_x_mm_fmadd_ps(f32x4::load(a + i).to_native(), f32x4::load(b + i).to_native(), s0);
+      if (i != n)
+        s1 = victor_x_mm_fmadd_ps(algorithm_detail::load_padded<f32x4>(a + i, n - i).to_native(), algorithm_detail::load_padded<f32x4>(b + i, n - i).to_native(), s1);
+      return f32x4(_mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3))).reduce_add();
+    }
+
+    inline int64_t dot(const int32_t* a, const int32_t* b, size_t n) VICTOR_NOEXCEPT {
+      __m128i s0 = _mm_setzero_si128(), s1 = s0;
+      size_t i = 0;
+      #define VICTOR_X_DOT_EPI32(va, vb) \
+        do { \
+          const __m128i a_ = (va), b_ = (vb); \
+          s0 = _mm_add_epi64(s0, victor_x_mm_mul_epi32(a_, b_)); \
+          s1 = _mm_add_epi64(s1, victor_x_mm_mul_epi32(_mm_srli_epi64(a_, 32), _mm_srli_epi64(b_, 32))); \
+        } while (0)
+      for ( ; i + 4 <= n ; i += 4)
+        VICTOR_X_DOT_EPI32(i32x4::load(a + i).to_native(), i32x4::load(b + i).to_native());
+      if (i != n)
+        VICTOR_X_DOT_EPI32(algorithm_detail::load_padded<i32x4>(a + i, n - i).to_native(), algorithm_detail::load_padded<i32x4>(b + i, n - i).to_native());
+      #undef VICTOR_X_DOT_EPI32
+      return algorithm_detail::reduce_add_epi64(_mm_add_epi64(s0, s1));
+    }
+
+    /* pmaddwd products are summed in 32-bit lanes, which is safe for
+       2^14 vectors at a time, then widened. */
+    inline int64_t dot(const int8_t* a, const int8_t* b, size_t n) VICTOR_NOEXCEPT {
+      __m128i total = _mm_setzero_si128();
+      size_t i = 0;
+      while (i + 16 <= n) {
+        const size_t block_end = (n - i) / 16 > 16384 ? i + 16384 * 16 : n;
+        __m128i s0 = _mm_setzero_si128(), s1 = s0, s2 = s0, s3 = s0;
+        for ( ; i + 64 <= block_end ; i += 64) {
+          s0 = _mm_add_epi32(s0, algorithm_detail::dot_epi8(i8x16::load(a + i).to_native(), i8x16::load(b + i).to_native()));
+          s1 = _mm_add_epi32(s1, algorithm_detail::dot_epi8(i8x16::load(a + i + 16).to_native(), i8x16::load(b + i + 16).to_native()));
+          s2 = _mm_add_epi32(s2, algorithm_detail::dot_epi8(i8x16::load(a + i + 32).to_native(), i8x16::load(b + i + 32).to_native()));
+          s3 = _mm_add_epi32(s3, algorithm_detail::dot_epi8(i8x16::load(a + i + 48).to_native(), i8x16::load(b + i + 48).to_native()));
+        }
+        for ( ; i + 16 <= block_end ; i += 16)
+          s0 = _mm_add_epi32(s0, algorithm_detail::dot_epi8(i8x16::load(a + i).to_native(), i8x16::load(b + i).to_native()));
+        total = algorithm_detail::add_epi32_to_epi64(total, _mm_add_epi32(s0, s1));
+        total = algorithm_detail::add_epi32_to_epi64(total, _mm_add_epi32(s2, s3));
+      }
+      if (i != n)
+        total = algorithm_detail::add_epi32_to_epi64(total, algorithm_detail::dot_epi8(algorithm_detail::load_padded<i8x16>(a + i, n - i).to_native(), algorithm_detail::load_padded<i8x16>(b + i, n - i).to_native()));
+      return algorithm_detail::reduce_add_epi64(total);
+    }
+
+    /* Euclidean norm.  The squares are summed in double, so nothing
+       overflows or underflows before the final square root. */
+    inline float norm2(const float* x, size_t n) VICTOR_NOEXCEPT {
+      __m128d s0 = _mm_setzero_pd(), s1 = s0, s2 = s0, s3 = s0;
+      size_t i = 0;
+      #define VICTOR_X_NORM2_PS(v, lo, hi) \
+        do { \
+          const __m128 v_ = (v); \
+          const __m128d l_ = _mm_cvtps_pd(v_); \
+          const __m128d h_ = _mm_cvtps_pd(_mm_movehl_ps(v_, v_)); \
+          lo = victor_x_mm_fmadd_pd(l_, l_, lo); \
+          hi = victor_x_mm_fmadd_pd(h_, h_, hi); \
+        } while (0)
+      for ( ; i + 8 <= n ; i += 8) {
+        VICTOR_X_NORM2_PS(f32x4::load(x + i).to_native(), s0, s1);
+        VICTOR_X_NORM2_PS(f32x4::load(x + i + 4).to_native(), s2, s3);
+      }
+      for ( ; i + 4 <= n ; i += 4)
+        VICTOR_X_NORM2_PS(f32x4::load(x + i).to_native(), s0, s1);
+      if (i != n)
+        VICTOR_X_NORM2_PS(algorithm_detail::load_padded<f32x4>(x + i, n - i).to_native(), s2, s3);
+      #undef VICTOR_X_NORM2_PS
+      s0 = _mm_add_pd(_mm_add_pd(s0, s1), _mm_add_pd(s2, s3));
+      return HEDLEY_STATIC_CAST(float, sqrt(_mm_cvtsd_f64(_mm_add_sd(s0, _mm_unpackhi_pd(s0, s0)))));
+    }
+
+    inline double norm2(const int32_t* x, size_t n) VICTOR_NOEXCEPT {
+      __m128d s0 = _mm_setzero_pd(), s1 = s0;
+      size_t i = 0;
+      #define VICTOR_X_NORM2_EPI32(v) \
+        do { \
+          const __m128i v_ = (v); \
+          const __m128d l_ = _mm_cvtepi32_pd(v_); \
+          const __m128d h_ = _mm_cvtepi32_pd(_mm_unpackhi_epi64(v_, v_)); \
+          s0 = victor_x_mm_fmadd_pd(l_, l_, s0); \
+          s1 = victor_x_mm_fmadd_pd(h_, h_, s1); \
+        } while (0)
+      for ( ; i + 4 <= n ; i += 4)
+        VICTOR_X_NORM2_EPI32(i32x4::load(x + i).to_native());
+      if (i != n)
+        VICTOR_X_NORM2_EPI32(algorithm_detail::load_padded<i32x4>(x + i, n - i).to_native());
+      #undef VICTOR_X_NORM2_EPI32
+      s0 = _mm_add_pd(s0, s1);
+      return sqrt(_mm_cvtsd_f64(_mm_add_sd(s0, _mm_unpackhi_pd(s0, s0))));
+    }
+
+    inline double norm2(const int8_t* x, size_t n) VICTOR_NOEXCEPT {
+      return sqrt(HEDLEY_STATIC_CAST(double, dot(x, x, n)));
+    }
+
+    /* Pointer to the first smallest (or largest) element, or x + n if
+       n is 0.  NaNs are ignored unless there is nothing else. */
+    inline const float* min_element(const float* x, size_t n) VICTOR_NOEXCEPT { return algorithm_detail::extreme_element<false>(x, n); }
+    inline const float* max_element(const float* x, size_t n) VICTOR_NOEXCEPT { return algorithm_detail::extreme_element<true>(x, n); }
+    inline const int32_t* min_element(const int32_t* x, size_t n) VICTOR_NOEXCEPT { return algorithm_detail::extreme_element<false>(x, n); }
+    inline const int32_t* max_element(const int32_t* x, size_t n) VICTOR_NOEXCEPT { return algorithm_detail::extreme_element<true>(x, n); }
+    inline const int8_t* min_element(const int8_t* x, size_t n) VICTOR_NOEXCEPT { return algorithm_detail::extreme_element<false>(x, n); }
+    inline const int8_t* max_element(const int8_t* x, size_t n) VICTOR_NOEXCEPT { return algorithm_detail::extreme_element<true>(x, n); }
+  VICTOR_X_END_NAMESPACE
+#endif /* defined(VICTOR_ENABLE_CXX_API) && defined(VICTOR_ENABLE_SSE2) */
+
+#endif /* !defined(VICTOR_ALGORITHM_H) */
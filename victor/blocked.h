@@ -0,0 +1,352 @@
+/* blocked.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+/* Register blocking.
+ *
+ * Victor::blocked<V, N> holds N vectors of type V and applies every
+ * operator to each of them, so with
+ *
+ *   typedef Victor::blocked<Victor::f32x4, 4> f32x4x4;
+ *   f32x4x4 acc(0.0f);
+ *   for (i = 0 ; i + 16 <= n ; i += 16)
+ *     acc += f32x4x4::load(x + i) * f32x4x4::load(y + i);
+ *   return acc.fold_add().reduce_add();
+ *
+ * each += and * is N independent instructions rather than one long
+ * dependency chain; it's the same code as unrolling by hand, without
+ * the typing.  The per-vector loops are unrolled with templates rather
+ * than left to the optimizer, so you get N instructions even at -O0.
+ *
+ * Operators (and fmadd() and friends) are only instantiated when you
+ * use them, so blocked<V, N> has whatever subset V has.  loads and
+ * stores cover N * lanes consecutive elements, and vector_traits is
+ * defined for it, so it can also be used as the vector type for
+ * Victor::transform. */
+
+#if !defined(VICTOR_BLOCKED_H)
+#define VICTOR_BLOCKED_H
+
+#if defined(VICTOR_ENABLE_CXX_API) && defined(VICTOR_ENABLE_SSE2)
+  VICTOR_X_BEGIN_NAMESPACE
+    namespace blocked_detail {
+      /* Calls f(0), f(1), ..., f(N - 1). */
+      template <int N> struct each {
+        template <typename F>
+        static VICTOR_INLINE void apply(F& f) VICTOR_NOEXCEPT { each<N - 1>::apply(f); f(N - 1); }
+      };
+      template <> struct each<0> {
+        template <typename F>
+        static VICTOR_INLINE void apply(F&) VICTOR_NOEXCEPT { }
+      };
+
+      #define VICTOR_X_BLOCKED_OP(name, op) \
+        struct name { \
+          template <typename V> \
+          static VICTOR_INLINE V apply(V a, V b) VICTOR_NOEXCEPT { return a op b; } \
+        }
+      VICTOR_X_BLOCKED_OP(add, +);
+      VICTOR_X_BLOCKED_OP(sub, -);
+      VICTOR_X_BLOCKED_OP(mul, *);
+      VICTOR_X_BLOCKED_OP(div, /);
+      VICTOR_X_BLOCKED_OP(bit_and, &);
+      VICTOR_X_BLOCKED_OP(bit_or, |);
+      VICTOR_X_BLOCKED_OP(bit_xor, ^);
+      #undef VICTOR_X_BLOCKED_OP
+
+      template <typename V, typename Op>
+      struct binary {
+        typedef typename vector_traits<V>::native_type native;
+        native* r;
+        const native* a;
+        const native* b;
+        VICTOR_INLINE binary(native* r_, const native* a_, const native* b_) : r(r_), a(a_), b(b_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT { r[k] = Op::apply(V(a[k]), V(b[k])).to_native(); }
+      };
+
+      #define VICTOR_X_BLOCKED_FMA(name) \
+        struct name { \
+          template <typename V> \
+          static VICTOR_INLINE V apply(V a, V b, V c) VICTOR_NOEXCEPT { return Victor::name(a, b, c); } \
+        }
+      VICTOR_X_BLOCKED_FMA(fmadd);
+      VICTOR_X_BLOCKED_FMA(fmsub);
+      VICTOR_X_BLOCKED_FMA(fnmadd);
+      VICTOR_X_BLOCKED_FMA(fnmsub);
+      #undef VICTOR_X_BLOCKED_FMA
+
+      /* Works through operator[] and set() since it's used from free
+         functions. */
+      template <typename B, typename Op>
+      struct ternary {
+        B* r;
+        const B* a;
+        const B* b;
+        const B* c;
+        VICTOR_INLINE ternary(B* r_, const B* a_, const B* b_, const B* c_) : r(r_), a(a_), b(b_), c(c_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT { r->set(k, Op::apply((*a)[k], (*b)[k], (*c)[k])); }
+      };
+
+      template <typename Op, typename B>
+      VICTOR_INLINE B apply_ternary(const B& a, const B& b, const B& c) VICTOR_NOEXCEPT {
+        B r;
+        ternary<B, Op> f(&r, &a, &b, &c);
+        each<B::size>::apply(f);
+        return r;
+      }
+
+      template <typename V, bool Left>
+      struct shift {
+        typedef typename vector_traits<V>::native_type native;
+        native* r;
+        const native* a;
+        int count;
+        VICTOR_INLINE shift(native* r_, const native* a_, int count_) : r(r_), a(a_), count(count_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT { r[k] = (Left ? (V(a[k]) << count) : (V(a[k]) >> count)).to_native(); }
+      };
+
+      template <typename V>
+      struct bit_not {
+        typedef typename vector_traits<V>::native_type native;
+        native* r;
+        const native* a;
+        VICTOR_INLINE bit_not(native* r_, const native* a_) : r(r_), a(a_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT { r[k] = (~V(a[k])).to_native(); }
+      };
+
+      template <typename V>
+      struct broadcast {
+        typedef typename vector_traits<V>::native_type native;
+        native* r;
+        native value;
+        VICTOR_INLINE broadcast(native* r_, native value_) : r(r_), value(value_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT { r[k] = value; }
+      };
+
+      template <typename V, bool Aligned>
+      struct load {
+        typedef typename vector_traits<V>::native_type native;
+        typedef typename vector_traits<V>::value_type T;
+        native* r;
+        const T* src;
+        VICTOR_INLINE load(native* r_, const T* src_) : r(r_), src(src_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT {
+          const T* p = src + k * vector_traits<V>::lanes;
+          r[k] = (Aligned ? V::load_aligned(p) : V::load(p)).to_native();
+        }
+      };
+
+      template <typename V, bool Aligned>
+      struct store {
+        typedef typename vector_traits<V>::native_type native;
+        typedef typename vector_traits<V>::value_type T;
+        const native* a;
+        T* dest;
+        VICTOR_INLINE store(const native* a_, T* dest_) : a(a_), dest(dest_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT {
+          T* p = dest + k * vector_traits<V>::lanes;
+          if (Aligned)
+            V(a[k]).store_aligned(p);
+          else
+            V(a[k]).store(p);
+        }
+      };
+
+      /* The first count elements; vectors which start past the end
+         are zero (or not stored). */
+      template <typename V>
+      struct load_partial {
+        typedef typename vector_traits<V>::native_type native;
+        typedef typename vector_traits<V>::value_type T;
+        native* r;
+        const T* src;
+        size_t count;
+        VICTOR_INLINE load_partial(native* r_, const T* src_, size_t count_) : r(r_), src(src_), count(count_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT {
+          const size_t first = HEDLEY_STATIC_CAST(size_t, k) * vector_traits<V>::lanes;
+          r[k] = (first < count ? V::load_partial(src + first, count - first) : V(T(0))).to_native();
+        }
+      };
+
+      template <typename V>
+      struct store_partial {
+        typedef typename vector_traits<V>::native_type native;
+        typedef typename vector_traits<V>::value_type T;
+        const native* a;
+        T* dest;
+        size_t count;
+        VICTOR_INLINE store_partial(const native* a_, T* dest_, size_t count_) : a(a_), dest(dest_), count(count_) { }
+        VICTOR_INLINE void operator()(int k) VICTOR_NOEXCEPT {
+          const size_t first = HEDLEY_STATIC_CAST(size_t, k) * vector_traits<V>::lanes;
+          if (first < count)
+            V(a[k]).store_partial(dest + first, count - first);
+        }
+      };
+
+      /* Sum of a[Lo, Lo + Count) as a balanced tree. */
+      template <typename V, int Lo, int Count> struct fold_add {
+        static VICTOR_INLINE V apply(const typename vector_traits<V>::native_type* a) VICTOR_NOEXCEPT {
+          return fold_add<V, Lo, Count / 2>::apply(a) + fold_add<V, Lo + Count / 2, Count - Count / 2>::apply(a);
+        }
+      };
+      template <typename V, int Lo> struct fold_add<V, Lo, 1> {
+        static VICTOR_INLINE V apply(const typename vector_traits<V>::native_type* a) VICTOR_NOEXCEPT { return V(a[Lo]); }
+      };
+    }
+
+    template <typename V, int N>
+    class blocked {
+      public:
+        typedef V vector_type;
+        typedef typename vector_traits<V>::value_type value_type;
+        typedef typename vector_traits<V>::native_type native_type;
+        enum { size = N, lanes = N * vector_traits<V>::lanes };
+
+      private:
+        native_type n[N];
+
+        template <typename Op>
+        VICTOR_INLINE blocked apply(const blocked& b) const VICTOR_NOEXCEPT {
+          blocked r;
+          blocked_detail::binary<V, Op> f(r.n, n, b.n);
+          blocked_detail::each<N>::apply(f);
+          return r;
+        }
+
+      public:
+        /* Uninitialized, like a native vector. */
+        VICTOR_INLINE blocked(void) VICTOR_NOEXCEPT { }
+        VICTOR_INLINE blocked(V value) VICTOR_NOEXCEPT {
+          blocked_detail::broadcast<V> f(n, value.to_native());
+          blocked_detail::each<N>::apply(f);
+        }
+        VICTOR_INLINE blocked(value_type value) VICTOR_NOEXCEPT {
+          blocked_detail::broadcast<V> f(n, V(value).to_native());
+          blocked_detail::each<N>::apply(f);
+        }
+
+        VICTOR_INLINE V operator[](int k) const VICTOR_NOEXCEPT { return V(n[k]); }
+        VICTOR_INLINE void set(int k, V value) VICTOR_NOEXCEPT { n[k] = value.to_native(); }
+
+        static VICTOR_INLINE blocked load(const value_type* src) VICTOR_NOEXCEPT {
+          blocked r;
+          blocked_detail::load<V, false> f(r.n, src);
+          blocked_detail::each<N>::apply(f);
+          return r;
+        }
+        static VICTOR_INLINE blocked load_aligned(const value_type* src) VICTOR_NOEXCEPT {
+          blocked r;
+          blocked_detail::load<V, true> f(r.n, src);
+          blocked_detail::each<N>::apply(f);
+          return r;
+        }
+        static VICTOR_INLINE blocked load_partial(const value_type* src, size_t count) VICTOR_NOEXCEPT {
+          blocked r;
+          blocked_detail::load_partial<V> f(r.n, src, count);
+          blocked_detail::each<N>::apply(f);
+          return r;
+        }
+        VICTOR_INLINE void store(value_type* dest) const VICTOR_NOEXCEPT {
+          blocked_detail::store<V, false> f(n, dest);
+          blocked_detail::each<N>::apply(f);
+        }
+        VICTOR_INLINE void store_aligned(value_type* dest) const VICTOR_NOEXCEPT {
+          blocked_detail::store<V, true> f(n, dest);
+          blocked_detail::each<N>::apply(f);
+        }
+        VICTOR_INLINE void store_partial(value_type* dest, size_t count) const VICTOR_NOEXCEPT {
+          blocked_detail::store_partial<V> f(n, dest, count);
+          blocked_detail::each<N>::apply(f);
+        }
+
+        VICTOR_INLINE blocked operator+(const blocked& b) const VICTOR_NOEXCEPT { return apply<blocked_detail::add>(b); }
+        VICTOR_INLINE blocked operator-(const blocked& b) const VICTOR_NOEXCEPT { return apply<blocked_detail::sub>(b); }
+        VICTOR_INLINE blocked operator*(const blocked& b) const VICTOR_NOEXCEPT { return apply<blocked_detail::mul>(b); }
+        VICTOR_INLINE blocked operator/(const blocked& b) const VICTOR_NOEXCEPT { return apply<blocked_detail::div>(b); }
+        VICTOR_INLINE blocked operator&(const blocked& b) const VICTOR_NOEXCEPT { return apply<blocked_detail::bit_and>(b); }
+        VICTOR_INLINE blocked operator|(const blocked& b) const VICTOR_NOEXCEPT { return apply<blocked_detail::bit_or>(b); }
+        VICTOR_INLINE blocked operator^(const blocked& b) const VICTOR_NOEXCEPT { return apply<blocked_detail::bit_xor>(b); }
+        VICTOR_INLINE blocked operator~(void) const VICTOR_NOEXCEPT {
+          blocked r;
+          blocked_detail::bit_not<V> f(r.n, n);
+          blocked_detail::each<N>::apply(f);
+          return r;
+        }
+        VICTOR_INLINE blocked operator<<(int count) const VICTOR_NOEXCEPT {
+          blocked r;
+          blocked_detail::shift<V, true> f(r.n, n, count);
+          blocked_detail::each<N>::apply(f);
+          return r;
+        }
+        VICTOR_INLINE blocked operator>>(int count) const VICTOR_NOEXCEPT {
+          blocked r;
+          blocked_detail::shift<V, false> f(r.n, n, count);
+          blocked_detail::each<N>::apply(f);
+          return r;
+        }
+
+        VICTOR_INLINE blocked& operator+=(const blocked& b) VICTOR_NOEXCEPT { return *this = *this + b; }
+        VICTOR_INLINE blocked& operator-=(const blocked& b) VICTOR_NOEXCEPT { return *this = *this - b; }
+        VICTOR_INLINE blocked& operator*=(const blocked& b) VICTOR_NOEXCEPT { return *this = *this * b; }
+        VICTOR_INLINE blocked& operator/=(const blocked& b) VICTOR_NOEXCEPT { return *this = *this / b; }
+        VICTOR_INLINE blocked& operator&=(const blocked& b) VICTOR_NOEXCEPT { return *this = *this & b; }
+        VICTOR_INLINE blocked& operator|=(const blocked& b) VICTOR_NOEXCEPT { return *this = *this | b; }
+        VICTOR_INLINE blocked& operator^=(const blocked& b) VICTOR_NOEXCEPT { return *this = *this ^ b; }
+        VICTOR_INLINE blocked& operator<<=(int count) VICTOR_NOEXCEPT { return *this = *this << count; }
+        VICTOR_INLINE blocked& operator>>=(int count) VICTOR_NOEXCEPT { return *this = *this >> count; }
+
+        /* The N vectors added together pairwise, e.g. to finish off a
+           set of accumulators. */
+        VICTOR_INLINE V fold_add(void) const VICTOR_NOEXCEPT { return blocked_detail::fold_add<V, 0, N>::apply(n); }
+    };
+
+    template <typename V, int N>
+    VICTOR_INLINE blocked<V, N> fmadd(const blocked<V, N>& a, const blocked<V, N>& b, const blocked<V, N>& c) VICTOR_NOEXCEPT {
+      return blocked_detail::apply_ternary<blocked_detail::fmadd>(a, b, c);
+    }
+    template <typename V, int N>
+    VICTOR_INLINE blocked<V, N> fmsub(const blocked<V, N>& a, const blocked<V, N>& b, const blocked<V, N>& c) VICTOR_NOEXCEPT {
+      return blocked_detail::apply_ternary<blocked_detail::fmsub>(a, b, c);
+    }
+    template <typename V, int N>
+    VICTOR_INLINE blocked<V, N> fnmadd(const blocked<V, N>& a, const blocked<V, N>& b, const blocked<V, N>& c) VICTOR_NOEXCEPT {
+      return blocked_detail::apply_ternary<blocked_detail::fnmadd>(a, b, c);
+    }
+    template <typename V, int N>
+    VICTOR_INLINE blocked<V, N> fnmsub(const blocked<V, N>& a, const blocked<V, N>& b, const blocked<V, N>& c) VICTOR_NOEXCEPT {
+      return blocked_detail::apply_ternary<blocked_detail::fnmsub>(a, b, c);
+    }
+
+    template <typename V, int N>
+    struct vector_traits< blocked<V, N> > {
+      typedef typename vector_traits<V>::value_type value_type;
+      enum { lanes = N * vector_traits<V>::lanes, fma_is_fused = vector_traits<V>::fma_is_fused };
+    };
+  VICTOR_X_END_NAMESPACE
+#endif /* defined(VICTOR_ENABLE_CXX_API) && defined(VICTOR_ENABLE_SSE2) */
+
+#endif /* !defined(VICTOR_BLOCKED_H) */
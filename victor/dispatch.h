@@ -0,0 +1,317 @@
+/* dispatch.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+/* Runtime dispatch.
+ *
+ * Everything else in Victor is selected at compile time from the
+ * VICTOR_ENABLE_* ladder, so a binary built for SSE2 never uses AVX2
+ * even when the CPU has it.  This (opt-in) header lets you build a
+ * kernel once per tier and pick the best one at run time:
+ *
+ *   tier     compile with                                  CPU must have
+ *   sse2     -msse2                                        SSE2
+ *   sse4.1   -msse4.1                                      SSE4.1
+ *   avx2     -mavx2 -mfma                                  AVX2, FMA, OS support
+ *   avx512   -mavx512f -mavx512bw -mavx512dq -mavx512vl    AVX-512F/BW/DQ/VL, OS support
+ *
+ * Since Victor's types are chosen by the preprocessor, each tier has to
+ * be its own translation unit; compile the same source file once per
+ * tier (with the flags above, or /arch: for MSVC) and name the kernel
+ * with VICTOR_DISPATCH_NAME, which appends the suffix for whatever tier
+ * the file is being compiled for:
+ *
+ *   // saxpy.h
+ *   VICTOR_DISPATCH_DECLARE(void, saxpy, (float a, const float* x, float* y, size_t n))
+ *
+ *   // saxpy.c, compiled four times
+ *   void VICTOR_DISPATCH_NAME(saxpy)(float a, const float* x, float* y, size_t n) { ... }
+ *
+ *   // caller, built for the baseline
+ *   saxpy_dispatch()(a, x, y, n);
+ *
+ * The C++ API can be used in these files too.  Its inline functions
+ * and templates are in a namespace named after the instruction sets
+ * (Victor::sse2, Victor::avx2_fma, ...), so the linker doesn't merge
+ * the SSE2 copy of, say, Victor::math::exp with the AVX2 one;
+ * test/dispatch checks that.
+ *
+ * saxpy_dispatch() returns a cached pointer to saxpy_avx512,
+ * saxpy_avx2, saxpy_sse4_1 or saxpy_sse2; look it up once outside of
+ * hot loops.  saxpy_resolve() does the same without the cache, so it
+ * can be used to fill in your own function pointer.  If you don't
+ * build every tier, define VICTOR_DISPATCH_TIERS to a mask of the
+ * ones you do (SSE2 is always required):
+ *
+ *   #define VICTOR_DISPATCH_TIERS (VICTOR_DISPATCH_MASK(VICTOR_TIER_AVX2))
+ *
+ * The tier is detected once, with cpuid and xgetbv (so a CPU whose OS
+ * doesn't save the AVX or AVX-512 state isn't treated as having it).
+ * Set the VICTOR_DISPATCH_TIER environment variable to "sse2",
+ * "sse4.1", "avx2" or "avx512" to use a lower tier, for example to
+ * compare tiers on the same machine; asking for a tier the CPU doesn't
+ * support gets you the best one it does. */
+
+#if !defined(VICTOR_DISPATCH_H)
+#define VICTOR_DISPATCH_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_M_IX86) || defined(_M_X64)
+  #include <intrin.h>
+#elif (defined(__i386__) || defined(__x86_64__)) && (defined(__GNUC__) || defined(__clang__))
+  #include <cpuid.h>
+#endif
+
+#define VICTOR_TIER_NONE   0
+#define VICTOR_TIER_SSE2   1
+#define VICTOR_TIER_SSE4_1 2
+#define VICTOR_TIER_AVX2   3
+#define VICTOR_TIER_AVX512 4
+
+/* The tier the current translation unit is compiled for. */
+#if defined(VICTOR_ENABLE_AVX512F)
+  #define VICTOR_TIER VICTOR_TIER_AVX512
+  #define VICTOR_TIER_SUFFIX _avx512
+#elif defined(VICTOR_ENABLE_AVX2)
+  #define VICTOR_TIER VICTOR_TIER_AVX2
+  #define VICTOR_TIER_SUFFIX _avx2
+#elif defined(VICTOR_ENABLE_SSE4_1)
+  #define VICTOR_TIER VICTOR_TIER_SSE4_1
+  #define VICTOR_TIER_SUFFIX _sse4_1
+#elif defined(VICTOR_ENABLE_SSE2)
+  #define VICTOR_TIER VICTOR_TIER_SSE2
+  #define VICTOR_TIER_SUFFIX _sse2
+#else
+  #define VICTOR_TIER VICTOR_TIER_NONE
+#endif
+
+#if defined(VICTOR_TIER_SUFFIX)
+  #define VICTOR_DISPATCH_NAME(name) HEDLEY_CONCAT(name, VICTOR_TIER_SUFFIX)
+#endif
+
+#define VICTOR_DISPATCH_MASK(tier) (1 << (tier))
+
+#if !defined(VICTOR_DISPATCH_TIERS)
+  #define VICTOR_DISPATCH_TIERS \
+    (VICTOR_DISPATCH_MASK(VICTOR_TIER_SSE4_1) | \
+     VICTOR_DISPATCH_MASK(VICTOR_TIER_AVX2) | \
+     VICTOR_DISPATCH_MASK(VICTOR_TIER_AVX512))
+#endif
+
+#if (VICTOR_DISPATCH_TIERS) & VICTOR_DISPATCH_MASK(VICTOR_TIER_SSE4_1)
+  #define VICTOR_DISPATCH_IF_SSE4_1_(code) code
+#else
+  #define VICTOR_DISPATCH_IF_SSE4_1_(code)
+#endif
+#if (VICTOR_DISPATCH_TIERS) & VICTOR_DISPATCH_MASK(VICTOR_TIER_AVX2)
+  #define VICTOR_DISPATCH_IF_AVX2_(code) code
+#else
+  #define VICTOR_DISPATCH_IF_AVX2_(code)
+#endif
+#if (VICTOR_DISPATCH_TIERS) & VICTOR_DISPATCH_MASK(VICTOR_TIER_AVX512)
+  #define VICTOR_DISPATCH_IF_AVX512_(code) code
+#else
+  #define VICTOR_DISPATCH_IF_AVX512_(code)
+#endif
+
+#if defined(_M_IX86) || defined(_M_X64)
+  static inline void victor_x_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t r[4]) {
+    int regs[4];
+    __cpuidex(regs, HEDLEY_STATIC_CAST(int, leaf), HEDLEY_STATIC_CAST(int, subleaf));
+    r[0] = HEDLEY_STATIC_CAST(uint32_t, regs[0]);
+    r[1] = HEDLEY_STATIC_CAST(uint32_t, regs[1]);
+    r[2] = HEDLEY_STATIC_CAST(uint32_t, regs[2]);
+    r[3] = HEDLEY_STATIC_CAST(uint32_t, regs[3]);
+  }
+
+  static inline uint64_t victor_x_xgetbv(void) {
+    return HEDLEY_STATIC_CAST(uint64_t, _xgetbv(0));
+  }
+
+  #define VICTOR_X_HAVE_CPUID
+#elif (defined(__i386__) || defined(__x86_64__)) && (defined(__GNUC__) || defined(__clang__))
+  static inline void victor_x_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t r[4]) {
+    unsigned int a, b, c, d;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    r[0] = a; r[1] = b; r[2] = c; r[3] = d;
+  }
+
+  /* _xgetbv needs -mxsave, which the baseline build won't have. */
+  static inline uint64_t victor_x_xgetbv(void) {
+    uint32_t lo, hi;
+    __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0" : "=a" (lo), "=d" (hi) : "c" (0));
+    return (HEDLEY_STATIC_CAST(uint64_t, hi) << 32) | lo;
+  }
+
+  #define VICTOR_X_HAVE_CPUID
+#endif
+
+/* The lazily-filled caches below may be written by several threads at
+   once, so they are read and written with relaxed atomics.  On
+   compilers with neither the GCC builtins nor MSVC's interlocked
+   intrinsics, call victor_dispatch_tier() and each name_dispatch()
+   once before starting any threads. */
+#if defined(__ATOMIC_RELAXED)
+  #define VICTOR_X_ATOMIC_LOAD_INT(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+  #define VICTOR_X_ATOMIC_STORE_INT(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+  #define VICTOR_X_ATOMIC_LOAD_PTR(T, p) __atomic_load_n((p), __ATOMIC_RELAXED)
+  #define VICTOR_X_ATOMIC_STORE_PTR(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#elif defined(_M_IX86) || defined(_M_X64)
+  #define VICTOR_X_ATOMIC_LOAD_INT(p) \
+    HEDLEY_STATIC_CAST(int, _InterlockedCompareExchange(HEDLEY_REINTERPRET_CAST(long volatile*, (p)), 0, 0))
+  #define VICTOR_X_ATOMIC_STORE_INT(p, v) \
+    ((void) _InterlockedExchange(HEDLEY_REINTERPRET_CAST(long volatile*, (p)), HEDLEY_STATIC_CAST(long, (v))))
+  #define VICTOR_X_ATOMIC_LOAD_PTR(T, p) \
+    HEDLEY_REINTERPRET_CAST(T, _InterlockedCompareExchangePointer(HEDLEY_REINTERPRET_CAST(void* volatile*, (p)), NULL, NULL))
+  #define VICTOR_X_ATOMIC_STORE_PTR(p, v) \
+    ((void) _InterlockedExchangePointer(HEDLEY_REINTERPRET_CAST(void* volatile*, (p)), HEDLEY_REINTERPRET_CAST(void*, (v))))
+#else
+  #define VICTOR_X_ATOMIC_LOAD_INT(p) (*(p))
+  #define VICTOR_X_ATOMIC_STORE_INT(p, v) ((void) (*(p) = (v)))
+  #define VICTOR_X_ATOMIC_LOAD_PTR(T, p) (*(p))
+  #define VICTOR_X_ATOMIC_STORE_PTR(p, v) ((void) (*(p) = (v)))
+#endif
+
+/* The best tier the CPU (and OS) supports.  This runs cpuid every
+   time; victor_dispatch_tier() caches it. */
+static inline int victor_cpu_tier(void) {
+#if defined(VICTOR_X_HAVE_CPUID)
+  uint32_t r[4];
+  uint32_t max_leaf;
+  uint64_t xcr0 = 0;
+  int tier = VICTOR_TIER_NONE;
+
+  victor_x_cpuid(0, 0, r);
+  max_leaf = r[0];
+  if (max_leaf < 1)
+    return tier;
+
+  victor_x_cpuid(1, 0, r);
+  if (!(r[3] & (UINT32_C(1) << 26)))
+    return tier;
+  tier = VICTOR_TIER_SSE2;
+
+  if (!(r[2] & (UINT32_C(1) << 19)))
+    return tier;
+  tier = VICTOR_TIER_SSE4_1;
+
+  /* AVX and FMA, and OSXSAVE so we can ask which register state the
+     OS saves: XMM and YMM for AVX2, plus the opmask and ZMM state for
+     AVX-512. */
+  if ((r[2] & UINT32_C(0x18001000)) != UINT32_C(0x18001000) || max_leaf < 7)
+    return tier;
+  xcr0 = victor_x_xgetbv();
+  if ((xcr0 & 0x06) != 0x06)
+    return tier;
+
+  victor_x_cpuid(7, 0, r);
+  if (!(r[1] & (UINT32_C(1) << 5)))
+    return tier;
+  tier = VICTOR_TIER_AVX2;
+
+  /* AVX512F (16), DQ (17), BW (30), VL (31) */
+  if ((r[1] & UINT32_C(0xc0030000)) != UINT32_C(0xc0030000) || (xcr0 & 0xe6) != 0xe6)
+    return tier;
+  return VICTOR_TIER_AVX512;
+#else
+  return VICTOR_TIER_NONE;
+#endif
+}
+
+/* Parse a tier name as used by the VICTOR_DISPATCH_TIER environment
+   variable; returns -1 if it isn't one. */
+static inline int victor_tier_from_name(const char* name) {
+  if (strcmp(name, "sse2") == 0)
+    return VICTOR_TIER_SSE2;
+  else if (strcmp(name, "sse4.1") == 0)
+    return VICTOR_TIER_SSE4_1;
+  else if (strcmp(name, "avx2") == 0)
+    return VICTOR_TIER_AVX2;
+  else if (strcmp(name, "avx512") == 0)
+    return VICTOR_TIER_AVX512;
+  return -1;
+}
+
+/* The tier dispatched functions will use: the CPU's, lowered by the
+   VICTOR_DISPATCH_TIER environment variable if it is set.  Worked out
+   on the first call and cached. */
+static inline int victor_dispatch_tier(void) {
+  static int cache = -1;
+  int tier = VICTOR_X_ATOMIC_LOAD_INT(&cache);
+
+  if (tier < 0) {
+    const char* env;
+    int t = victor_cpu_tier();
+
+    HEDLEY_DIAGNOSTIC_PUSH
+    HEDLEY_DIAGNOSTIC_DISABLE_DEPRECATED
+    env = getenv("VICTOR_DISPATCH_TIER");
+    HEDLEY_DIAGNOSTIC_POP
+
+    if (env != NULL) {
+      const int requested = victor_tier_from_name(env);
+      if (requested >= 0 && requested < t)
+        t = requested;
+    }
+    VICTOR_X_ATOMIC_STORE_INT(&cache, t);
+    tier = t;
+  }
+
+  return tier;
+}
+
+/* Declares name_sse2, name_sse4_1, name_avx2 and name_avx512 (minus
+   any tiers left out of VICTOR_DISPATCH_TIERS), plus
+   name_resolve() and name_dispatch() as described above.  params is
+   the parenthesized parameter list. */
+#define VICTOR_DISPATCH_DECLARE(ret, name, params) \
+  ret name##_sse2 params; \
+  VICTOR_DISPATCH_IF_SSE4_1_(ret name##_sse4_1 params;) \
+  VICTOR_DISPATCH_IF_AVX2_(ret name##_avx2 params;) \
+  VICTOR_DISPATCH_IF_AVX512_(ret name##_avx512 params;) \
+  typedef ret (* name##_fn) params; \
+  static inline name##_fn name##_resolve(void) { \
+    const int tier = victor_dispatch_tier(); \
+    VICTOR_DISPATCH_IF_AVX512_(if (tier >= VICTOR_TIER_AVX512) return name##_avx512;) \
+    VICTOR_DISPATCH_IF_AVX2_(if (tier >= VICTOR_TIER_AVX2) return name##_avx2;) \
+    VICTOR_DISPATCH_IF_SSE4_1_(if (tier >= VICTOR_TIER_SSE4_1) return name##_sse4_1;) \
+    (void) tier; \
+    return name##_sse2; \
+  } \
+  static inline name##_fn name##_dispatch(void) { \
+    static name##_fn cache = NULL; \
+    name##_fn fn = VICTOR_X_ATOMIC_LOAD_PTR(name##_fn, &cache); \
+    if (fn == NULL) { \
+      fn = name##_resolve(); \
+      VICTOR_X_ATOMIC_STORE_PTR(&cache, fn); \
+    } \
+    return fn; \
+  }
+
+#endif /* !defined(VICTOR_DISPATCH_H) */
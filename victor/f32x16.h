@@ -0,0 +1,376 @@
+/* f32x16.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX512F)
+  #if !defined(VICTOR_F32X16_H_FORWARD_DECLARE)
+    #define VICTOR_F32X16_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class f32x16;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_F32X16_H_DECLARE)
+    #define VICTOR_F32X16_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class f32x16 {
+          private:
+            __m512 n;
+
+          public:
+            VICTOR_INLINE f32x16(__m512 value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m512 to_native(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x16(float value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x16(float  e0, float  e1, float  e2, float  e3, float  e4, float  e5, float  e6, float  e7,
+                          float  e8, float  e9, float e10, float e11, float e12, float e13, float e14, float e15) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x16(f32x8 low, f32x8 high) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x16 operator+(f32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x16 operator&(f32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x16 and_not(f32x16 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x16 load(const float src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x16 load_aligned(const float src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x16 load_stream(const float src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(float values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(float values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(float values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x16 load_partial(const float src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(float dest[], size_t count) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x16 gather(const float base[], i32x16 indices) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x16 gather_masked(mask16 mask, const float base[], i32x16 indices) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void scatter(float base[], i32x16 indices) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE mask16 operator==(f32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator!=(f32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator<(f32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator<=(f32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator>(f32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator>=(f32x16 a) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x16 mask_add(f32x16 src, mask16 k, f32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x16 maskz_add(mask16 k, f32x16 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x16 load_masked(mask16 k, const float src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_masked(float values[HEDLEY_ARRAY_PARAM(16)], mask16 k) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x8 low(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x8 high(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i32x16 to_i32x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x16 as_i32x16(void) const VICTOR_NOEXCEPT;
+        };
+
+        VICTOR_INLINE f32x16 fmadd(f32x16 a, f32x16 b, f32x16 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x16 fmsub(f32x16 a, f32x16 b, f32x16 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x16 fnmadd(f32x16 a, f32x16 b, f32x16 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x16 fnmsub(f32x16 a, f32x16 b, f32x16 c) VICTOR_NOEXCEPT;
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef float victor_f32x16 __attribute__((__vector_size__(64),__aligned__(64)));
+
+        static VICTOR_INLINE victor_f32x16 victor_f32x16_from_native(__m512 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_f32x16, v);
+          #else
+            union {
+              __m512 from;
+              victor_f32x16 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m512 victor_f32x16_to_native(victor_f32x16 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m512, v);
+          #else
+            union {
+              victor_f32x16 from;
+              __m512 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m512 victor_f32x16;
+        #define victor_f32x16_to_native(v) (v)
+        #define victor_f32x16_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_F32X16_H_DEFINE)
+    #define VICTOR_F32X16_H_DEFINE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE f32x16::f32x16(__m512 value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m512 f32x16::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE f32x16::f32x16(float value) VICTOR_NOEXCEPT :n(_mm512_set1_ps(value)) { };
+        VICTOR_INLINE f32x16::f32x16(float  e0, float  e1, float  e2, float  e3, float  e4, float  e5, float  e6, float  e7,
+                              float  e8, float  e9, float e10, float e11, float e12, float e13, float e14, float e15) VICTOR_NOEXCEPT
+          :n(_mm512_setr_ps(e0, e1,  e2,  e3,  e4,  e5,  e6,  e7,
+                            e8, e9, e10, e11, e12, e13, e14, e15)) { };
+        #if defined(VICTOR_ENABLE_AVX512DQ)
+          VICTOR_INLINE f32x16::f32x16(f32x8 low, f32x8 high) VICTOR_NOEXCEPT
+            :n(_mm512_insertf32x8(_mm512_castps256_ps512(low.to_native()), high.to_native(), 1)) { };
+        #else
+          VICTOR_INLINE f32x16::f32x16(f32x8 low, f32x8 high) VICTOR_NOEXCEPT
+            :n(_mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(low.to_native())), _mm256_castps_pd(high.to_native()), 1))) { };
+        #endif
+        VICTOR_INLINE f32x16 f32x16::operator+(f32x16 a) const VICTOR_NOEXCEPT { return f32x16(_mm512_add_ps(n, a.to_native())); };
+        #if defined(VICTOR_ENABLE_AVX512DQ)
+          VICTOR_INLINE f32x16 f32x16::operator&(f32x16 a) const VICTOR_NOEXCEPT { return f32x16(_mm512_and_ps(n, a.to_native())); };
+          VICTOR_INLINE f32x16 f32x16::and_not(f32x16 a) const VICTOR_NOEXCEPT { return f32x16(_mm512_andnot_ps(a.to_native(), n)); };
+        #else
+          VICTOR_INLINE f32x16 f32x16::operator&(f32x16 a) const VICTOR_NOEXCEPT { return f32x16(_mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(n), _mm512_castps_si512(a.to_native())))); };
+          VICTOR_INLINE f32x16 f32x16::and_not(f32x16 a) const VICTOR_NOEXCEPT { return f32x16(_mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(a.to_native()), _mm512_castps_si512(n)))); };
+        #endif
+        VICTOR_INLINE f32x16 f32x16::load(const float src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT { return f32x16(_mm512_loadu_ps(src)); }
+        VICTOR_INLINE f32x16 f32x16::load_aligned(const float src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 64);
+          return f32x16(_mm512_load_ps(src));
+        }
+        VICTOR_INLINE f32x16 f32x16::load_stream(const float src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 64);
+          return f32x16(_mm512_castsi512_ps(_mm512_stream_load_si512(HEDLEY_CONST_CAST(float*, src))));
+        }
+        VICTOR_INLINE void f32x16::store(float dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT { _mm512_storeu_ps(dest, n); }
+        VICTOR_INLINE void f32x16::store_aligned(float dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 64);
+          _mm512_store_ps(dest, n);
+        }
+        VICTOR_INLINE void f32x16::store_stream(float dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 64);
+          _mm512_stream_ps(dest, n);
+        }
+        VICTOR_INLINE f32x16 f32x16::load_partial(const float src[], size_t count) VICTOR_NOEXCEPT { return f32x16(_mm512_maskz_loadu_ps(HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - VICTOR_X_PARTIAL_COUNT(count, 16))), src)); }
+        VICTOR_INLINE void f32x16::store_partial(float dest[], size_t count) const VICTOR_NOEXCEPT { _mm512_mask_storeu_ps(dest, HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - VICTOR_X_PARTIAL_COUNT(count, 16))), n); }
+        VICTOR_INLINE f32x16 f32x16::gather(const float base[], i32x16 indices) VICTOR_NOEXCEPT { return f32x16(_mm512_i32gather_ps(indices.to_native(), base, 4)); }
+        VICTOR_INLINE f32x16 f32x16::gather_masked(mask16 mask, const float base[], i32x16 indices) VICTOR_NOEXCEPT { return f32x16(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask.to_native(), indices.to_native(), base, 4)); }
+        VICTOR_INLINE void f32x16::scatter(float base[], i32x16 indices) const VICTOR_NOEXCEPT { _mm512_i32scatter_ps(base, indices.to_native(), n, 4); }
+
+        VICTOR_INLINE mask16 f32x16::operator==(f32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmp_ps_mask(n, a.to_native(), _CMP_EQ_OQ)); }
+        VICTOR_INLINE mask16 f32x16::operator!=(f32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmp_ps_mask(n, a.to_native(), _CMP_NEQ_UQ)); }
+        VICTOR_INLINE mask16 f32x16::operator<(f32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmp_ps_mask(n, a.to_native(), _CMP_LT_OQ)); }
+        VICTOR_INLINE mask16 f32x16::operator<=(f32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmp_ps_mask(n, a.to_native(), _CMP_LE_OQ)); }
+        VICTOR_INLINE mask16 f32x16::operator>(f32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmp_ps_mask(n, a.to_native(), _CMP_GT_OQ)); }
+        VICTOR_INLINE mask16 f32x16::operator>=(f32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmp_ps_mask(n, a.to_native(), _CMP_GE_OQ)); }
+
+        VICTOR_INLINE f32x16 f32x16::mask_add(f32x16 src, mask16 k, f32x16 a) const VICTOR_NOEXCEPT { return f32x16(_mm512_mask_add_ps(src.to_native(), k.to_native(), n, a.to_native())); }
+        VICTOR_INLINE f32x16 f32x16::maskz_add(mask16 k, f32x16 a) const VICTOR_NOEXCEPT { return f32x16(_mm512_maskz_add_ps(k.to_native(), n, a.to_native())); }
+        VICTOR_INLINE f32x16 f32x16::load_masked(mask16 k, const float src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT { return f32x16(_mm512_maskz_loadu_ps(k.to_native(), src)); }
+        VICTOR_INLINE void f32x16::store_masked(float dest[HEDLEY_ARRAY_PARAM(16)], mask16 k) const VICTOR_NOEXCEPT { _mm512_mask_storeu_ps(dest, k.to_native(), n); }
+
+        VICTOR_INLINE f32x8 f32x16::low(void) const VICTOR_NOEXCEPT { return f32x8(_mm512_castps512_ps256(n)); };
+        #if defined(VICTOR_ENABLE_AVX512DQ)
+          VICTOR_INLINE f32x8 f32x16::high(void) const VICTOR_NOEXCEPT { return f32x8(_mm512_extractf32x8_ps(n, 1)); };
+        #else
+          VICTOR_INLINE f32x8 f32x16::high(void) const VICTOR_NOEXCEPT { return f32x8(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(n), 1))); };
+        #endif
+
+        VICTOR_INLINE i32x16 f32x16::to_i32x16(void) const VICTOR_NOEXCEPT { return i32x16(_mm512_cvtps_epi32(n)); };
+        VICTOR_INLINE i32x16 f32x16::as_i32x16(void) const VICTOR_NOEXCEPT { return i32x16(_mm512_castps_si512(n)); };
+
+        VICTOR_INLINE f32x16 fmadd(f32x16 a, f32x16 b, f32x16 c) VICTOR_NOEXCEPT { return f32x16(_mm512_fmadd_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x16 fmsub(f32x16 a, f32x16 b, f32x16 c) VICTOR_NOEXCEPT { return f32x16(_mm512_fmsub_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x16 fnmadd(f32x16 a, f32x16 b, f32x16 c) VICTOR_NOEXCEPT { return f32x16(_mm512_fnmadd_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x16 fnmsub(f32x16 a, f32x16 b, f32x16 c) VICTOR_NOEXCEPT { return f32x16(_mm512_fnmsub_ps(a.to_native(), b.to_native(), c.to_native())); }
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_add(victor_f32x16 a, victor_f32x16 b) {
+        return victor_f32x16_from_native(_mm512_add_ps(victor_f32x16_to_native(a), victor_f32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_and(victor_f32x16 a, victor_f32x16 b) {
+        #if defined(VICTOR_ENABLE_AVX512DQ)
+          return victor_f32x16_from_native(_mm512_and_ps(victor_f32x16_to_native(a), victor_f32x16_to_native(b)));
+        #else
+          return victor_f32x16_from_native(_mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(victor_f32x16_to_native(a)), _mm512_castps_si512(victor_f32x16_to_native(b)))));
+        #endif
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_and_not(victor_f32x16 a, victor_f32x16 b) {
+        #if defined(VICTOR_ENABLE_AVX512DQ)
+          return victor_f32x16_from_native(_mm512_andnot_ps(victor_f32x16_to_native(b), victor_f32x16_to_native(a)));
+        #else
+          return victor_f32x16_from_native(_mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(victor_f32x16_to_native(b)), _mm512_castps_si512(victor_f32x16_to_native(a)))));
+        #endif
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_set1(float value) {
+        return victor_f32x16_from_native(_mm512_set1_ps(value));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_set(float  e0, float  e1, float  e2, float  e3, float  e4, float  e5, float  e6, float  e7,
+                                                    float  e8, float  e9, float e10, float e11, float e12, float e13, float e14, float e15) {
+        return victor_f32x16_from_native(_mm512_setr_ps(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_load(const float src[HEDLEY_ARRAY_PARAM(16)]) {
+        return victor_f32x16_from_native(_mm512_loadu_ps(src));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_load_aligned(const float src[HEDLEY_ARRAY_PARAM(16)]) {
+        VICTOR_ASSERT_ALIGNED(src, 64);
+        return victor_f32x16_from_native(_mm512_load_ps(src));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_load_stream(const float src[HEDLEY_ARRAY_PARAM(16)]) {
+        VICTOR_ASSERT_ALIGNED(src, 64);
+        return victor_f32x16_from_native(_mm512_castsi512_ps(_mm512_stream_load_si512(HEDLEY_CONST_CAST(float*, src))));
+      }
+
+      static VICTOR_INLINE void victor_f32x16_store(float dest[HEDLEY_ARRAY_PARAM(16)], victor_f32x16 src) {
+        _mm512_storeu_ps(dest, victor_f32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f32x16_store_aligned(float dest[HEDLEY_ARRAY_PARAM(16)], victor_f32x16 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 64);
+        _mm512_store_ps(dest, victor_f32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f32x16_store_stream(float dest[HEDLEY_ARRAY_PARAM(16)], victor_f32x16 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 64);
+        _mm512_stream_ps(dest, victor_f32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_load_partial(const float src[], size_t count) {
+        return victor_f32x16_from_native(_mm512_maskz_loadu_ps(HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - VICTOR_X_PARTIAL_COUNT(count, 16))), src));
+      }
+
+      static VICTOR_INLINE void victor_f32x16_store_partial(float dest[], size_t count, victor_f32x16 src) {
+        _mm512_mask_storeu_ps(dest, HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - VICTOR_X_PARTIAL_COUNT(count, 16))), victor_f32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_gather(const float base[], victor_i32x16 indices) {
+        return victor_f32x16_from_native(_mm512_i32gather_ps(victor_i32x16_to_native(indices), base, 4));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_gather_masked(victor_mask16 mask, const float base[], victor_i32x16 indices) {
+        return victor_f32x16_from_native(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), victor_mask16_to_native(mask), victor_i32x16_to_native(indices), base, 4));
+      }
+
+      static VICTOR_INLINE void victor_f32x16_scatter(float base[], victor_i32x16 indices, victor_f32x16 src) {
+        _mm512_i32scatter_ps(base, victor_i32x16_to_native(indices), victor_f32x16_to_native(src), 4);
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_f32x16_cmpeq(victor_f32x16 a, victor_f32x16 b) {
+        return victor_mask16_from_native(_mm512_cmp_ps_mask(victor_f32x16_to_native(a), victor_f32x16_to_native(b), _CMP_EQ_OQ));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_f32x16_cmpne(victor_f32x16 a, victor_f32x16 b) {
+        return victor_mask16_from_native(_mm512_cmp_ps_mask(victor_f32x16_to_native(a), victor_f32x16_to_native(b), _CMP_NEQ_UQ));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_f32x16_cmplt(victor_f32x16 a, victor_f32x16 b) {
+        return victor_mask16_from_native(_mm512_cmp_ps_mask(victor_f32x16_to_native(a), victor_f32x16_to_native(b), _CMP_LT_OQ));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_f32x16_cmple(victor_f32x16 a, victor_f32x16 b) {
+        return victor_mask16_from_native(_mm512_cmp_ps_mask(victor_f32x16_to_native(a), victor_f32x16_to_native(b), _CMP_LE_OQ));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_f32x16_cmpgt(victor_f32x16 a, victor_f32x16 b) {
+        return victor_mask16_from_native(_mm512_cmp_ps_mask(victor_f32x16_to_native(a), victor_f32x16_to_native(b), _CMP_GT_OQ));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_f32x16_cmpge(victor_f32x16 a, victor_f32x16 b) {
+        return victor_mask16_from_native(_mm512_cmp_ps_mask(victor_f32x16_to_native(a), victor_f32x16_to_native(b), _CMP_GE_OQ));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_mask_add(victor_f32x16 src, victor_mask16 k, victor_f32x16 a, victor_f32x16 b) {
+        return victor_f32x16_from_native(_mm512_mask_add_ps(victor_f32x16_to_native(src), victor_mask16_to_native(k), victor_f32x16_to_native(a), victor_f32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_maskz_add(victor_mask16 k, victor_f32x16 a, victor_f32x16 b) {
+        return victor_f32x16_from_native(_mm512_maskz_add_ps(victor_mask16_to_native(k), victor_f32x16_to_native(a), victor_f32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_load_masked(victor_mask16 k, const float src[HEDLEY_ARRAY_PARAM(16)]) {
+        return victor_f32x16_from_native(_mm512_maskz_loadu_ps(victor_mask16_to_native(k), src));
+      }
+
+      static VICTOR_INLINE void victor_f32x16_store_masked(float dest[HEDLEY_ARRAY_PARAM(16)], victor_mask16 k, victor_f32x16 src) {
+        _mm512_mask_storeu_ps(dest, victor_mask16_to_native(k), victor_f32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_join(victor_f32x8 low, victor_f32x8 high) {
+        #if defined(VICTOR_ENABLE_AVX512DQ)
+          return victor_f32x16_from_native(_mm512_insertf32x8(_mm512_castps256_ps512(victor_f32x8_to_native(low)), victor_f32x8_to_native(high), 1));
+        #else
+          return victor_f32x16_from_native(_mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(victor_f32x8_to_native(low))), _mm256_castps_pd(victor_f32x8_to_native(high)), 1)));
+        #endif
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x16_low(victor_f32x16 src) {
+        return victor_f32x8_from_native(_mm512_castps512_ps256(victor_f32x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x16_high(victor_f32x16 src) {
+        #if defined(VICTOR_ENABLE_AVX512DQ)
+          return victor_f32x8_from_native(_mm512_extractf32x8_ps(victor_f32x16_to_native(src), 1));
+        #else
+          return victor_f32x8_from_native(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(victor_f32x16_to_native(src)), 1)));
+        #endif
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_f32x16_to_i32x16(victor_f32x16 src) {
+        return victor_i32x16_from_native(_mm512_cvtps_epi32(victor_f32x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_f32x16_as_i32x16(victor_f32x16 src) {
+        return victor_i32x16_from_native(_mm512_castps_si512(victor_f32x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_fmadd(victor_f32x16 a, victor_f32x16 b, victor_f32x16 c) {
+        return victor_f32x16_from_native(_mm512_fmadd_ps(victor_f32x16_to_native(a), victor_f32x16_to_native(b), victor_f32x16_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_fmsub(victor_f32x16 a, victor_f32x16 b, victor_f32x16 c) {
+        return victor_f32x16_from_native(_mm512_fmsub_ps(victor_f32x16_to_native(a), victor_f32x16_to_native(b), victor_f32x16_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_fnmadd(victor_f32x16 a, victor_f32x16 b, victor_f32x16 c) {
+        return victor_f32x16_from_native(_mm512_fnmadd_ps(victor_f32x16_to_native(a), victor_f32x16_to_native(b), victor_f32x16_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_f32x16_fnmsub(victor_f32x16 a, victor_f32x16 b, victor_f32x16 c) {
+        return victor_f32x16_from_native(_mm512_fnmsub_ps(victor_f32x16_to_native(a), victor_f32x16_to_native(b), victor_f32x16_to_native(c)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_F32X16_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX512F) */
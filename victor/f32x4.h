@@ -31,59 +31,145 @@
     #define VICTOR_F32X4_H_FORWARD_DECLARE
 
     #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
+      VICTOR_X_BEGIN_NAMESPACE
         class f32x4;
-      }
+      VICTOR_X_END_NAMESPACE
     #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
   #elif !defined(VICTOR_F32X4_H_DECLARE)
     #define VICTOR_F32X4_H_DECLARE
 
     #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
+      VICTOR_X_BEGIN_NAMESPACE
         class f32x4 {
           private:
             __m128 n;
 
           public:
-            inline f32x4(__m128 value);
-            inline __m128 to_native(void);
+            VICTOR_INLINE f32x4(__m128 value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128 to_native(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x4(void) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4(float value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4(float e0, float e1, float e2, float e3) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x4 operator+(f32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 operator&(f32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 and_not(f32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 operator-(f32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 operator*(f32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 operator/(f32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 operator|(f32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 operator^(f32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 operator~(void) const VICTOR_NOEXCEPT;
 
-            inline f32x4(float value);
-            inline f32x4(float e0, float e1, float e2, float e3);
+            VICTOR_INLINE f32x4& operator+=(f32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4& operator-=(f32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4& operator*=(f32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4& operator/=(f32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4& operator&=(f32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4& operator|=(f32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4& operator^=(f32x4 a) VICTOR_NOEXCEPT;
 
-            inline f32x4 operator+(f32x4 a);
-            inline f32x4 operator&(f32x4 a);
-            inline f32x4 and_not(f32x4 a);
-            inline void store(float values[HEDLEY_ARRAY_PARAM(4)]);
+            VICTOR_INLINE float reduce_add(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE float reduce_mul(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE float reduce_min(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE float reduce_max(void) const VICTOR_NOEXCEPT;
+
+            static VICTOR_INLINE f32x4 load(const float src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x4 load_aligned(const float src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x4 load_stream(const float src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(float values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(float values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(float values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x4 load_partial(const float src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(float dest[], size_t count) const VICTOR_NOEXCEPT;
 
             #if defined(VICTOR_ENABLE_SSE2)
-              inline i32x4 to_i32x4(void);
-              inline i32x4 as_i32x4(void);
+              /* round() rounds halfway cases to even, like roundps and
+                 nearbyint() in the default rounding mode (not like C's
+                 round()).  None of these depend on MXCSR. */
+              VICTOR_INLINE f32x4 floor(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE f32x4 ceil(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE f32x4 trunc(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE f32x4 round(void) const VICTOR_NOEXCEPT;
+
+              /* to_i32x4 uses the current MXCSR rounding mode (nearest
+                 unless you've changed it) and, like cvtps2dq, returns
+                 INT32_MIN for anything out of range.  The others always
+                 truncate or round to nearest; to_i32x4_saturate
+                 truncates, clamps to [INT32_MIN, INT32_MAX] and maps NaN
+                 to 0. */
+              VICTOR_INLINE i32x4 to_i32x4(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE i32x4 to_i32x4_trunc(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE i32x4 to_i32x4_nearest(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE i32x4 to_i32x4_saturate(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE i32x4 as_i32x4(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE f64x2 to_f64x2(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE f64x2 as_f64x2(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE i8x16 as_i8x16(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE u8x16 as_u8x16(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE i16x8 as_i16x8(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE u16x8 as_u16x8(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE u32x4 as_u32x4(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE i64x2 as_i64x2(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE u64x2 as_u64x2(void) const VICTOR_NOEXCEPT;
+
+              VICTOR_INLINE mask32x4 operator==(f32x4 a) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE mask32x4 operator!=(f32x4 a) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE mask32x4 operator<(f32x4 a) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE mask32x4 operator<=(f32x4 a) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE mask32x4 operator>(f32x4 a) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE mask32x4 operator>=(f32x4 a) const VICTOR_NOEXCEPT;
+
+              static VICTOR_INLINE f32x4 gather(const float base[], i32x4 indices) VICTOR_NOEXCEPT;
+              static VICTOR_INLINE f32x4 gather_masked(mask32x4 mask, const float base[], i32x4 indices) VICTOR_NOEXCEPT;
+              VICTOR_INLINE void scatter(float base[], i32x4 indices) const VICTOR_NOEXCEPT;
+            #endif
+
+            #if defined(VICTOR_ENABLE_AVX)
+              VICTOR_INLINE f64x4 to_f64x4(void) const VICTOR_NOEXCEPT;
             #endif
         };
-      }
+
+        #if defined(VICTOR_ENABLE_SSE2)
+          VICTOR_INLINE f32x4 select(mask32x4 mask, f32x4 a, f32x4 b) VICTOR_NOEXCEPT;
+        #endif
+
+        VICTOR_INLINE f32x4 fmadd(f32x4 a, f32x4 b, f32x4 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x4 fmsub(f32x4 a, f32x4 b, f32x4 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x4 fnmadd(f32x4 a, f32x4 b, f32x4 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x4 fnmsub(f32x4 a, f32x4 b, f32x4 c) VICTOR_NOEXCEPT;
+      VICTOR_X_END_NAMESPACE
     #endif /* defined(VICTOR_ENABLE_CXX_API) */
 
     #if defined(VICTOR_ENABLE_C_API)
       #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
         typedef float victor_f32x4 __attribute__((__vector_size__(16),__aligned__(16)));
 
-        static inline victor_f32x4 victor_f32x4_from_native(__m128 v) {
-          union {
-            __m128 from;
-            victor_f32x4 to;
-          } u;
-          u.from = v;
-          return u.to;
+        static VICTOR_INLINE victor_f32x4 victor_f32x4_from_native(__m128 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_f32x4, v);
+          #else
+            union {
+              __m128 from;
+              victor_f32x4 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
         }
 
-        static inline __m128 victor_f32x4_to_native(victor_f32x4 v) {
-          union {
-            victor_f32x4 from;
-            __m128 to;
-          } u;
-          u.from = v;
-          return u.to;
+        static VICTOR_INLINE __m128 victor_f32x4_to_native(victor_f32x4 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m128, v);
+          #else
+            union {
+              victor_f32x4 from;
+              __m128 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
         }
       #else
         typedef __m128 victor_f32x4;
@@ -95,58 +181,558 @@
   #elif !defined(VICTOR_F32X4_H_DEFINE)
     #define VICTOR_F32X4_H_DEFINE
 
+    /* Partial loads and stores; see victor_x_mm_load_partial_si128 in
+       i8x16.h.  Without SSE2 we always go through a buffer. */
+    static VICTOR_INLINE __m128 victor_x_mm_load_partial_ps(const float* src, size_t n) {
+      #if defined(VICTOR_ENABLE_SSE2)
+        return _mm_castsi128_ps(victor_x_mm_load_partial_epi32(src, n));
+      #else
+        float buf[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        memcpy(buf, src, n * sizeof(float));
+        return _mm_loadu_ps(buf);
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm_store_partial_ps(float* dest, size_t n, __m128 v) {
+      #if defined(VICTOR_ENABLE_SSE2)
+        victor_x_mm_store_partial_epi32(dest, n, _mm_castps_si128(v));
+      #else
+        float buf[4];
+        _mm_storeu_ps(buf, v);
+        memcpy(dest, buf, n * sizeof(float));
+      #endif
+    }
+
+    /* There is no "not" instruction; XOR with all bits set instead.
+       With SSE2 the compiler materializes the constant with pcmpeqd;
+       without it, 0 == 0 is the cheapest way to get all bits set. */
+    #if defined(VICTOR_ENABLE_SSE2)
+      #define victor_x_mm_not_ps(a) \
+        _mm_xor_ps((a), _mm_castsi128_ps(_mm_set1_epi32(-1)))
+    #else
+      #define victor_x_mm_not_ps(a) \
+        _mm_xor_ps((a), _mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps()))
+    #endif
+
+    /* Horizontal reductions.  We halve the vector twice instead of
+       using haddps, which is 3 uops and slower everywhere.  SSE3's
+       movshdup saves a register copy over shufps. */
+    static VICTOR_INLINE __m128 victor_x_mm_reduce_step_ps(__m128 v) {
+      #if defined(VICTOR_ENABLE_SSE3)
+        return _mm_movehdup_ps(v);
+      #else
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+      #endif
+    }
+
+    static VICTOR_INLINE float victor_x_mm_reduce_add_ps(__m128 v) {
+      v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+      return _mm_cvtss_f32(_mm_add_ss(v, victor_x_mm_reduce_step_ps(v)));
+    }
+
+    static VICTOR_INLINE float victor_x_mm_reduce_mul_ps(__m128 v) {
+      v = _mm_mul_ps(v, _mm_movehl_ps(v, v));
+      return _mm_cvtss_f32(_mm_mul_ss(v, victor_x_mm_reduce_step_ps(v)));
+    }
+
+    static VICTOR_INLINE float victor_x_mm_reduce_min_ps(__m128 v) {
+      v = _mm_min_ps(v, _mm_movehl_ps(v, v));
+      return _mm_cvtss_f32(_mm_min_ss(v, victor_x_mm_reduce_step_ps(v)));
+    }
+
+    static VICTOR_INLINE float victor_x_mm_reduce_max_ps(__m128 v) {
+      v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+      return _mm_cvtss_f32(_mm_max_ss(v, victor_x_mm_reduce_step_ps(v)));
+    }
+
+    /* Fused multiply-add: fmadd(a, b, c) is a * b + c, fmsub is
+       a * b - c, fnmadd is -(a * b) + c and fnmsub is -(a * b) - c.
+       Without FMA we multiply, round, then add and round again. */
+    static VICTOR_INLINE __m128 victor_x_mm_fmadd_ps(__m128 a, __m128 b, __m128 c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm_fmadd_ps(a, b, c);
+      #else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+      #endif
+    }
+
+    static VICTOR_INLINE __m128 victor_x_mm_fmsub_ps(__m128 a, __m128 b, __m128 c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm_fmsub_ps(a, b, c);
+      #else
+        return _mm_sub_ps(_mm_mul_ps(a, b), c);
+      #endif
+    }
+
+    static VICTOR_INLINE __m128 victor_x_mm_fnmadd_ps(__m128 a, __m128 b, __m128 c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm_fnmadd_ps(a, b, c);
+      #else
+        return _mm_sub_ps(c, _mm_mul_ps(a, b));
+      #endif
+    }
+
+    static VICTOR_INLINE __m128 victor_x_mm_fnmsub_ps(__m128 a, __m128 b, __m128 c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm_fnmsub_ps(a, b, c);
+      #else
+        return _mm_sub_ps(_mm_xor_ps(_mm_mul_ps(a, b), _mm_set1_ps(-0.0f)), c);
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_SSE2)
+      /* Rounding.  SSE4.1 has roundps.  On SSE2 we truncate with
+         cvttps2dq, which ignores MXCSR, and fix up the result; the
+         usual add-and-subtract-2^23 trick would round using whatever
+         mode MXCSR happens to be in.  Lanes with |x| >= 2^23 are
+         already integers (and may not fit in an int32_t), so they and
+         NaNs pass through unchanged, and x's sign is copied to the
+         result so that ceil(-0.5) is -0.0, as with roundps. */
+      static VICTOR_INLINE __m128 victor_x_mm_round_fixup_ps(__m128 x, __m128 r) {
+        const __m128 sign = _mm_set1_ps(-0.0f);
+        const __m128 big = _mm_cmpnlt_ps(_mm_andnot_ps(sign, x), _mm_set1_ps(8388608.0f));
+        r = _mm_or_ps(_mm_andnot_ps(sign, r), _mm_and_ps(x, sign));
+        return _mm_or_ps(_mm_and_ps(big, x), _mm_andnot_ps(big, r));
+      }
+
+      static VICTOR_INLINE __m128 victor_x_mm_trunc_ps(__m128 x) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return _mm_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        #else
+          return victor_x_mm_round_fixup_ps(x, _mm_cvtepi32_ps(_mm_cvttps_epi32(x)));
+        #endif
+      }
+
+      static VICTOR_INLINE __m128 victor_x_mm_floor_ps(__m128 x) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return _mm_round_ps(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        #else
+          const __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+          return victor_x_mm_round_fixup_ps(x, _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x), _mm_set1_ps(1.0f))));
+        #endif
+      }
+
+      static VICTOR_INLINE __m128 victor_x_mm_ceil_ps(__m128 x) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return _mm_round_ps(x, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        #else
+          const __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+          return victor_x_mm_round_fixup_ps(x, _mm_add_ps(t, _mm_and_ps(_mm_cmplt_ps(t, x), _mm_set1_ps(1.0f))));
+        #endif
+      }
+
+      /* x - trunc(x) is exact, so we can compare the fraction against
+         0.5 directly and use the low bit of the truncated integer to
+         break ties. */
+      static VICTOR_INLINE __m128 victor_x_mm_round_ps(__m128 x) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return _mm_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        #else
+          const __m128 sign = _mm_set1_ps(-0.0f);
+          const __m128 half = _mm_set1_ps(0.5f);
+          const __m128i ti = _mm_cvttps_epi32(x);
+          const __m128 t = _mm_cvtepi32_ps(ti);
+          const __m128 frac = _mm_andnot_ps(sign, _mm_sub_ps(x, t));
+          const __m128 odd = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(ti, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+          const __m128 away = _mm_or_ps(_mm_cmpgt_ps(frac, half), _mm_and_ps(_mm_cmpeq_ps(frac, half), odd));
+          const __m128 step = _mm_and_ps(away, _mm_or_ps(_mm_set1_ps(1.0f), _mm_and_ps(x, sign)));
+          return victor_x_mm_round_fixup_ps(x, _mm_add_ps(t, step));
+        #endif
+      }
+
+      /* cvttps2dq returns INT32_MIN for anything out of range, which is
+         already right for large negative values; flip it to INT32_MAX
+         for large positive ones and zero the NaNs. */
+      static VICTOR_INLINE __m128i victor_x_mm_cvttps_epi32_saturate(__m128 x) {
+        const __m128i r = _mm_cvttps_epi32(x);
+        const __m128 pos = _mm_cmpge_ps(x, _mm_set1_ps(2147483648.0f));
+        const __m128 ord = _mm_cmpord_ps(x, x);
+        return _mm_and_si128(_mm_xor_si128(r, _mm_castps_si128(pos)), _mm_castps_si128(ord));
+      }
+
+      /* Gather and scatter; see victor_x_mm_i32gather_epi32 in i32x4.h. */
+      static VICTOR_INLINE __m128 victor_x_mm_i32gather_ps(const float* base, __m128i vindex) {
+        #if defined(VICTOR_ENABLE_AVX2)
+          return _mm_i32gather_ps(base, vindex, 4);
+        #else
+          return _mm_setr_ps(
+            base[_mm_cvtsi128_si32(vindex)],
+            base[victor_x_mm_extract_epi32(vindex, 1)],
+            base[victor_x_mm_extract_epi32(vindex, 2)],
+            base[victor_x_mm_extract_epi32(vindex, 3)]);
+        #endif
+      }
+
+      static VICTOR_INLINE __m128 victor_x_mm_maskz_i32gather_ps(__m128i mask, const float* base, __m128i vindex) {
+        #if defined(VICTOR_ENABLE_AVX2)
+          return _mm_mask_i32gather_ps(_mm_setzero_ps(), base, vindex, _mm_castsi128_ps(mask), 4);
+        #else
+          const int m = _mm_movemask_ps(_mm_castsi128_ps(mask));
+          return _mm_setr_ps(
+            (m & 1) ? base[_mm_cvtsi128_si32(vindex)] : 0.0f,
+            (m & 2) ? base[victor_x_mm_extract_epi32(vindex, 1)] : 0.0f,
+            (m & 4) ? base[victor_x_mm_extract_epi32(vindex, 2)] : 0.0f,
+            (m & 8) ? base[victor_x_mm_extract_epi32(vindex, 3)] : 0.0f);
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_x_mm_i32scatter_ps(float* base, __m128i vindex, __m128 v) {
+        #if defined(VICTOR_ENABLE_AVX512VL)
+          _mm_i32scatter_ps(base, vindex, v, 4);
+        #else
+          base[_mm_cvtsi128_si32(vindex)] = _mm_cvtss_f32(v);
+          base[victor_x_mm_extract_epi32(vindex, 1)] = _mm_cvtss_f32(_mm_shuffle_ps(v, v, 1));
+          base[victor_x_mm_extract_epi32(vindex, 2)] = _mm_cvtss_f32(_mm_shuffle_ps(v, v, 2));
+          base[victor_x_mm_extract_epi32(vindex, 3)] = _mm_cvtss_f32(_mm_shuffle_ps(v, v, 3));
+        #endif
+      }
+    #endif
+
     #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
-        inline f32x4::f32x4(__m128 value) :n(value) { };
-        inline __m128 f32x4::to_native() { return n; }
-        inline f32x4::f32x4(float value) :n(_mm_set1_ps(value)) { };
-        inline f32x4::f32x4(float e0, float e1, float e2, float e3) :n(_mm_setr_ps(e0, e1, e2, e3)) { };
-        inline f32x4 f32x4::operator+(f32x4 a) { return f32x4(_mm_add_ps(n, a.to_native())); };
-        inline f32x4 f32x4::operator&(f32x4 a) { return f32x4(_mm_and_ps(n, a.to_native())); };
-        inline f32x4 f32x4::and_not(f32x4 a) { return f32x4(_mm_andnot_ps(a.to_native(), n)); };
-        inline void f32x4::store(float dest[HEDLEY_ARRAY_PARAM(4)]) { _mm_storeu_ps(dest, n); }
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE f32x4::f32x4(__m128 value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128 f32x4::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE f32x4::f32x4(void) VICTOR_NOEXCEPT :n(_mm_setzero_ps()) { };
+        VICTOR_INLINE f32x4::f32x4(float value) VICTOR_NOEXCEPT :n(_mm_set1_ps(value)) { };
+        VICTOR_INLINE f32x4::f32x4(float e0, float e1, float e2, float e3) VICTOR_NOEXCEPT :n(_mm_setr_ps(e0, e1, e2, e3)) { };
+        VICTOR_INLINE f32x4 f32x4::operator+(f32x4 a) const VICTOR_NOEXCEPT { return f32x4(_mm_add_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x4 f32x4::operator&(f32x4 a) const VICTOR_NOEXCEPT { return f32x4(_mm_and_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x4 f32x4::and_not(f32x4 a) const VICTOR_NOEXCEPT { return f32x4(_mm_andnot_ps(a.to_native(), n)); };
+        VICTOR_INLINE f32x4 f32x4::operator-(f32x4 a) const VICTOR_NOEXCEPT { return f32x4(_mm_sub_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x4 f32x4::operator*(f32x4 a) const VICTOR_NOEXCEPT { return f32x4(_mm_mul_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x4 f32x4::operator/(f32x4 a) const VICTOR_NOEXCEPT { return f32x4(_mm_div_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x4 f32x4::operator|(f32x4 a) const VICTOR_NOEXCEPT { return f32x4(_mm_or_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x4 f32x4::operator^(f32x4 a) const VICTOR_NOEXCEPT { return f32x4(_mm_xor_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x4 f32x4::operator~(void) const VICTOR_NOEXCEPT { return f32x4(victor_x_mm_not_ps(n)); };
+        VICTOR_INLINE f32x4& f32x4::operator+=(f32x4 a) VICTOR_NOEXCEPT { return *this = *this + a; };
+        VICTOR_INLINE f32x4& f32x4::operator-=(f32x4 a) VICTOR_NOEXCEPT { return *this = *this - a; };
+        VICTOR_INLINE f32x4& f32x4::operator*=(f32x4 a) VICTOR_NOEXCEPT { return *this = *this * a; };
+        VICTOR_INLINE f32x4& f32x4::operator/=(f32x4 a) VICTOR_NOEXCEPT { return *this = *this / a; };
+        VICTOR_INLINE f32x4& f32x4::operator&=(f32x4 a) VICTOR_NOEXCEPT { return *this = *this & a; };
+        VICTOR_INLINE f32x4& f32x4::operator|=(f32x4 a) VICTOR_NOEXCEPT { return *this = *this | a; };
+        VICTOR_INLINE f32x4& f32x4::operator^=(f32x4 a) VICTOR_NOEXCEPT { return *this = *this ^ a; };
+        VICTOR_INLINE float f32x4::reduce_add(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_add_ps(n); }
+        VICTOR_INLINE float f32x4::reduce_mul(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_mul_ps(n); }
+        VICTOR_INLINE float f32x4::reduce_min(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_min_ps(n); }
+        VICTOR_INLINE float f32x4::reduce_max(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_max_ps(n); }
+        VICTOR_INLINE f32x4 f32x4::load(const float src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT { return f32x4(_mm_loadu_ps(src)); }
+        VICTOR_INLINE f32x4 f32x4::load_aligned(const float src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          return f32x4(_mm_load_ps(src));
+        }
+        VICTOR_INLINE f32x4 f32x4::load_stream(const float src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return f32x4(_mm_castsi128_ps(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src)))));
+          #else
+            return f32x4(_mm_load_ps(src));
+          #endif
+        }
+        VICTOR_INLINE void f32x4::store(float dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT { _mm_storeu_ps(dest, n); }
+        VICTOR_INLINE void f32x4::store_aligned(float dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_store_ps(dest, n);
+        }
+        VICTOR_INLINE void f32x4::store_stream(float dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_stream_ps(dest, n);
+        }
+        VICTOR_INLINE f32x4 f32x4::load_partial(const float src[], size_t count) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_load_partial_ps(src, VICTOR_X_PARTIAL_COUNT(count, 4))); }
+        VICTOR_INLINE void f32x4::store_partial(float dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm_store_partial_ps(dest, VICTOR_X_PARTIAL_COUNT(count, 4), n); }
 
         #if defined(VICTOR_ENABLE_SSE2)
-          inline i32x4 f32x4::to_i32x4(void) { return i32x4(_mm_cvtps_epi32(n)); };
-          inline i32x4 f32x4::as_i32x4(void) { return i32x4(_mm_castps_si128(n)); };
+          VICTOR_INLINE f32x4 f32x4::floor(void) const VICTOR_NOEXCEPT { return f32x4(victor_x_mm_floor_ps(n)); };
+          VICTOR_INLINE f32x4 f32x4::ceil(void) const VICTOR_NOEXCEPT { return f32x4(victor_x_mm_ceil_ps(n)); };
+          VICTOR_INLINE f32x4 f32x4::trunc(void) const VICTOR_NOEXCEPT { return f32x4(victor_x_mm_trunc_ps(n)); };
+          VICTOR_INLINE f32x4 f32x4::round(void) const VICTOR_NOEXCEPT { return f32x4(victor_x_mm_round_ps(n)); };
+          VICTOR_INLINE i32x4 f32x4::to_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(_mm_cvtps_epi32(n)); };
+          VICTOR_INLINE i32x4 f32x4::to_i32x4_trunc(void) const VICTOR_NOEXCEPT { return i32x4(_mm_cvttps_epi32(n)); };
+          VICTOR_INLINE i32x4 f32x4::to_i32x4_nearest(void) const VICTOR_NOEXCEPT { return i32x4(_mm_cvttps_epi32(victor_x_mm_round_ps(n))); };
+          VICTOR_INLINE i32x4 f32x4::to_i32x4_saturate(void) const VICTOR_NOEXCEPT { return i32x4(victor_x_mm_cvttps_epi32_saturate(n)); };
+          VICTOR_INLINE i32x4 f32x4::as_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(_mm_castps_si128(n)); };
+          VICTOR_INLINE f64x2 f32x4::to_f64x2(void) const VICTOR_NOEXCEPT { return f64x2(_mm_cvtps_pd(n)); };
+          VICTOR_INLINE f64x2 f32x4::as_f64x2(void) const VICTOR_NOEXCEPT { return f64x2(_mm_castps_pd(n)); };
+          VICTOR_INLINE i8x16 f32x4::as_i8x16(void) const VICTOR_NOEXCEPT { return i8x16(_mm_castps_si128(n)); };
+          VICTOR_INLINE u8x16 f32x4::as_u8x16(void) const VICTOR_NOEXCEPT { return u8x16(_mm_castps_si128(n)); };
+          VICTOR_INLINE i16x8 f32x4::as_i16x8(void) const VICTOR_NOEXCEPT { return i16x8(_mm_castps_si128(n)); };
+          VICTOR_INLINE u16x8 f32x4::as_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(_mm_castps_si128(n)); };
+          VICTOR_INLINE u32x4 f32x4::as_u32x4(void) const VICTOR_NOEXCEPT { return u32x4(_mm_castps_si128(n)); };
+          VICTOR_INLINE i64x2 f32x4::as_i64x2(void) const VICTOR_NOEXCEPT { return i64x2(_mm_castps_si128(n)); };
+          VICTOR_INLINE u64x2 f32x4::as_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(_mm_castps_si128(n)); };
+
+          VICTOR_INLINE mask32x4 f32x4::operator==(f32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_castps_si128(_mm_cmpeq_ps(n, a.to_native()))); }
+          VICTOR_INLINE mask32x4 f32x4::operator!=(f32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_castps_si128(_mm_cmpneq_ps(n, a.to_native()))); }
+          VICTOR_INLINE mask32x4 f32x4::operator<(f32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_castps_si128(_mm_cmplt_ps(n, a.to_native()))); }
+          VICTOR_INLINE mask32x4 f32x4::operator<=(f32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_castps_si128(_mm_cmple_ps(n, a.to_native()))); }
+          VICTOR_INLINE mask32x4 f32x4::operator>(f32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_castps_si128(_mm_cmpgt_ps(n, a.to_native()))); }
+          VICTOR_INLINE mask32x4 f32x4::operator>=(f32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_castps_si128(_mm_cmpge_ps(n, a.to_native()))); }
+
+          VICTOR_INLINE f32x4 f32x4::gather(const float base[], i32x4 indices) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_i32gather_ps(base, indices.to_native())); }
+          VICTOR_INLINE f32x4 f32x4::gather_masked(mask32x4 mask, const float base[], i32x4 indices) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_maskz_i32gather_ps(mask.to_native(), base, indices.to_native())); }
+          VICTOR_INLINE void f32x4::scatter(float base[], i32x4 indices) const VICTOR_NOEXCEPT { victor_x_mm_i32scatter_ps(base, indices.to_native(), n); }
+
+          VICTOR_INLINE f32x4 select(mask32x4 mask, f32x4 a, f32x4 b) VICTOR_NOEXCEPT {
+            #if defined(VICTOR_ENABLE_SSE4_1)
+              return f32x4(_mm_blendv_ps(b.to_native(), a.to_native(), _mm_castsi128_ps(mask.to_native())));
+            #else
+              const f32x4 m(_mm_castsi128_ps(mask.to_native()));
+              return (a & m) | b.and_not(m);
+            #endif
+          }
         #endif
-      }
+
+        #if defined(VICTOR_ENABLE_AVX)
+          VICTOR_INLINE f64x4 f32x4::to_f64x4(void) const VICTOR_NOEXCEPT { return f64x4(_mm256_cvtps_pd(n)); };
+        #endif
+
+        VICTOR_INLINE f32x4 fmadd(f32x4 a, f32x4 b, f32x4 c) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_fmadd_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x4 fmsub(f32x4 a, f32x4 b, f32x4 c) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_fmsub_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x4 fnmadd(f32x4 a, f32x4 b, f32x4 c) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_fnmadd_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x4 fnmsub(f32x4 a, f32x4 b, f32x4 c) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_fnmsub_ps(a.to_native(), b.to_native(), c.to_native())); }
+      VICTOR_X_END_NAMESPACE
     #endif /* defined(VICTOR_ENABLE_CXX_API) */
 
     #if defined(VICTOR_ENABLE_C_API)
-      static inline victor_f32x4 victor_f32x4_add(victor_f32x4 a, victor_f32x4 b) {
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_add(victor_f32x4 a, victor_f32x4 b) {
         return victor_f32x4_from_native(_mm_add_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b)));
       }
 
-      static inline victor_f32x4 victor_f32x4_and(victor_f32x4 a, victor_f32x4 b) {
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_and(victor_f32x4 a, victor_f32x4 b) {
         return victor_f32x4_from_native(_mm_and_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b)));
       }
 
-      static inline victor_f32x4 victor_f32x4_and_not(victor_f32x4 a, victor_f32x4 b) {
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_and_not(victor_f32x4 a, victor_f32x4 b) {
         return victor_f32x4_from_native(_mm_andnot_ps(victor_f32x4_to_native(b), victor_f32x4_to_native(a)));
       }
 
-      static inline victor_f32x4 victor_f32x4_set1(float value) {
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_sub(victor_f32x4 a, victor_f32x4 b) {
+        return victor_f32x4_from_native(_mm_sub_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_mul(victor_f32x4 a, victor_f32x4 b) {
+        return victor_f32x4_from_native(_mm_mul_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_div(victor_f32x4 a, victor_f32x4 b) {
+        return victor_f32x4_from_native(_mm_div_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_or(victor_f32x4 a, victor_f32x4 b) {
+        return victor_f32x4_from_native(_mm_or_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_xor(victor_f32x4 a, victor_f32x4 b) {
+        return victor_f32x4_from_native(_mm_xor_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_not(victor_f32x4 a) {
+        return victor_f32x4_from_native(victor_x_mm_not_ps(victor_f32x4_to_native(a)));
+      }
+
+      static VICTOR_INLINE float victor_f32x4_reduce_add(victor_f32x4 a) {
+        return victor_x_mm_reduce_add_ps(victor_f32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE float victor_f32x4_reduce_mul(victor_f32x4 a) {
+        return victor_x_mm_reduce_mul_ps(victor_f32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE float victor_f32x4_reduce_min(victor_f32x4 a) {
+        return victor_x_mm_reduce_min_ps(victor_f32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE float victor_f32x4_reduce_max(victor_f32x4 a) {
+        return victor_x_mm_reduce_max_ps(victor_f32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_set1(float value) {
         return victor_f32x4_from_native(_mm_set1_ps(value));
       }
 
-      static inline victor_f32x4 victor_f32x4_set(float e0, float e1, float e2, float e3) {
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_set(float e0, float e1, float e2, float e3) {
         return victor_f32x4_from_native(_mm_setr_ps(e0, e1, e2, e3));
       }
 
-      static inline void victor_f32x4_store(float dest[HEDLEY_ARRAY_PARAM(4)], victor_f32x4 src) {
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_load(const float src[HEDLEY_ARRAY_PARAM(4)]) {
+        return victor_f32x4_from_native(_mm_loadu_ps(src));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_load_aligned(const float src[HEDLEY_ARRAY_PARAM(4)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        return victor_f32x4_from_native(_mm_load_ps(src));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_load_stream(const float src[HEDLEY_ARRAY_PARAM(4)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_f32x4_from_native(_mm_castsi128_ps(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src)))));
+        #else
+          return victor_f32x4_from_native(_mm_load_ps(src));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_f32x4_store(float dest[HEDLEY_ARRAY_PARAM(4)], victor_f32x4 src) {
         _mm_storeu_ps(dest, victor_f32x4_to_native(src));
       }
 
+      static VICTOR_INLINE void victor_f32x4_store_aligned(float dest[HEDLEY_ARRAY_PARAM(4)], victor_f32x4 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_store_ps(dest, victor_f32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f32x4_store_stream(float dest[HEDLEY_ARRAY_PARAM(4)], victor_f32x4 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_stream_ps(dest, victor_f32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_load_partial(const float src[], size_t count) {
+        return victor_f32x4_from_native(victor_x_mm_load_partial_ps(src, VICTOR_X_PARTIAL_COUNT(count, 4)));
+      }
+
+      static VICTOR_INLINE void victor_f32x4_store_partial(float dest[], size_t count, victor_f32x4 src) {
+        victor_x_mm_store_partial_ps(dest, VICTOR_X_PARTIAL_COUNT(count, 4), victor_f32x4_to_native(src));
+      }
+
       #if defined(VICTOR_ENABLE_SSE2)
-        static inline victor_i32x4 victor_f32x4_to_i32x4(victor_f32x4 src) {
+        static VICTOR_INLINE victor_f32x4 victor_f32x4_floor(victor_f32x4 src) {
+          return victor_f32x4_from_native(victor_x_mm_floor_ps(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_f32x4 victor_f32x4_ceil(victor_f32x4 src) {
+          return victor_f32x4_from_native(victor_x_mm_ceil_ps(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_f32x4 victor_f32x4_trunc(victor_f32x4 src) {
+          return victor_f32x4_from_native(victor_x_mm_trunc_ps(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_f32x4 victor_f32x4_round(victor_f32x4 src) {
+          return victor_f32x4_from_native(victor_x_mm_round_ps(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_i32x4 victor_f32x4_to_i32x4(victor_f32x4 src) {
           return victor_i32x4_from_native(_mm_cvtps_epi32(victor_f32x4_to_native(src)));
         }
 
-        static inline victor_i32x4 victor_f32x4_as_i32x4(victor_f32x4 src) {
+        static VICTOR_INLINE victor_i32x4 victor_f32x4_to_i32x4_trunc(victor_f32x4 src) {
+          return victor_i32x4_from_native(_mm_cvttps_epi32(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_i32x4 victor_f32x4_to_i32x4_nearest(victor_f32x4 src) {
+          return victor_i32x4_from_native(_mm_cvttps_epi32(victor_x_mm_round_ps(victor_f32x4_to_native(src))));
+        }
+
+        static VICTOR_INLINE victor_i32x4 victor_f32x4_to_i32x4_saturate(victor_f32x4 src) {
+          return victor_i32x4_from_native(victor_x_mm_cvttps_epi32_saturate(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_i32x4 victor_f32x4_as_i32x4(victor_f32x4 src) {
           return victor_i32x4_from_native(_mm_castps_si128(victor_f32x4_to_native(src)));
         }
+
+        static VICTOR_INLINE victor_f64x2 victor_f32x4_to_f64x2(victor_f32x4 src) {
+          return victor_f64x2_from_native(_mm_cvtps_pd(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_f64x2 victor_f32x4_as_f64x2(victor_f32x4 src) {
+          return victor_f64x2_from_native(_mm_castps_pd(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_i8x16 victor_f32x4_as_i8x16(victor_f32x4 src) {
+          return victor_i8x16_from_native(_mm_castps_si128(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_u8x16 victor_f32x4_as_u8x16(victor_f32x4 src) {
+          return victor_u8x16_from_native(_mm_castps_si128(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_i16x8 victor_f32x4_as_i16x8(victor_f32x4 src) {
+          return victor_i16x8_from_native(_mm_castps_si128(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_u16x8 victor_f32x4_as_u16x8(victor_f32x4 src) {
+          return victor_u16x8_from_native(_mm_castps_si128(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_u32x4 victor_f32x4_as_u32x4(victor_f32x4 src) {
+          return victor_u32x4_from_native(_mm_castps_si128(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_i64x2 victor_f32x4_as_i64x2(victor_f32x4 src) {
+          return victor_i64x2_from_native(_mm_castps_si128(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_u64x2 victor_f32x4_as_u64x2(victor_f32x4 src) {
+          return victor_u64x2_from_native(_mm_castps_si128(victor_f32x4_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_mask32x4 victor_f32x4_cmpeq(victor_f32x4 a, victor_f32x4 b) {
+          return victor_mask32x4_from_native(_mm_castps_si128(_mm_cmpeq_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b))));
+        }
+
+        static VICTOR_INLINE victor_mask32x4 victor_f32x4_cmpne(victor_f32x4 a, victor_f32x4 b) {
+          return victor_mask32x4_from_native(_mm_castps_si128(_mm_cmpneq_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b))));
+        }
+
+        static VICTOR_INLINE victor_mask32x4 victor_f32x4_cmplt(victor_f32x4 a, victor_f32x4 b) {
+          return victor_mask32x4_from_native(_mm_castps_si128(_mm_cmplt_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b))));
+        }
+
+        static VICTOR_INLINE victor_mask32x4 victor_f32x4_cmple(victor_f32x4 a, victor_f32x4 b) {
+          return victor_mask32x4_from_native(_mm_castps_si128(_mm_cmple_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b))));
+        }
+
+        static VICTOR_INLINE victor_mask32x4 victor_f32x4_cmpgt(victor_f32x4 a, victor_f32x4 b) {
+          return victor_mask32x4_from_native(_mm_castps_si128(_mm_cmpgt_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b))));
+        }
+
+        static VICTOR_INLINE victor_mask32x4 victor_f32x4_cmpge(victor_f32x4 a, victor_f32x4 b) {
+          return victor_mask32x4_from_native(_mm_castps_si128(_mm_cmpge_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b))));
+        }
+
+        static VICTOR_INLINE victor_f32x4 victor_f32x4_gather(const float base[], victor_i32x4 indices) {
+          return victor_f32x4_from_native(victor_x_mm_i32gather_ps(base, victor_i32x4_to_native(indices)));
+        }
+
+        static VICTOR_INLINE victor_f32x4 victor_f32x4_gather_masked(victor_mask32x4 mask, const float base[], victor_i32x4 indices) {
+          return victor_f32x4_from_native(victor_x_mm_maskz_i32gather_ps(victor_mask32x4_to_native(mask), base, victor_i32x4_to_native(indices)));
+        }
+
+        static VICTOR_INLINE void victor_f32x4_scatter(float base[], victor_i32x4 indices, victor_f32x4 src) {
+          victor_x_mm_i32scatter_ps(base, victor_i32x4_to_native(indices), victor_f32x4_to_native(src));
+        }
+
+        static VICTOR_INLINE victor_f32x4 victor_f32x4_select(victor_mask32x4 mask, victor_f32x4 a, victor_f32x4 b) {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return victor_f32x4_from_native(_mm_blendv_ps(victor_f32x4_to_native(b), victor_f32x4_to_native(a), _mm_castsi128_ps(victor_mask32x4_to_native(mask))));
+          #else
+            const victor_f32x4 m = victor_f32x4_from_native(_mm_castsi128_ps(victor_mask32x4_to_native(mask)));
+            return victor_f32x4_or(victor_f32x4_and(a, m), victor_f32x4_and_not(b, m));
+          #endif
+        }
       #endif /* defined(VICTOR_ENABLE_SSE2) */
+
+      #if defined(VICTOR_ENABLE_AVX)
+        static VICTOR_INLINE victor_f64x4 victor_f32x4_to_f64x4(victor_f32x4 src) {
+          return victor_f64x4_from_native(_mm256_cvtps_pd(victor_f32x4_to_native(src)));
+        }
+      #endif /* defined(VICTOR_ENABLE_AVX) */
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_fmadd(victor_f32x4 a, victor_f32x4 b, victor_f32x4 c) {
+        return victor_f32x4_from_native(victor_x_mm_fmadd_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b), victor_f32x4_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_fmsub(victor_f32x4 a, victor_f32x4 b, victor_f32x4 c) {
+        return victor_f32x4_from_native(victor_x_mm_fmsub_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b), victor_f32x4_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_fnmadd(victor_f32x4 a, victor_f32x4 b, victor_f32x4 c) {
+        return victor_f32x4_from_native(victor_x_mm_fnmadd_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b), victor_f32x4_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x4_fnmsub(victor_f32x4 a, victor_f32x4 b, victor_f32x4 c) {
+        return victor_f32x4_from_native(victor_x_mm_fnmsub_ps(victor_f32x4_to_native(a), victor_f32x4_to_native(b), victor_f32x4_to_native(c)));
+      }
     #endif /* defined(VICTOR_ENABLE_C_API) */
   #endif /* ? defined(VICTOR_F32X4_FORWARD_DECLARE_H) */
 #endif /* defined(VICTOR_ENABLE_SSE) */
@@ -0,0 +1,361 @@
+/* f32x8.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX)
+  #if !defined(VICTOR_F32X8_H_FORWARD_DECLARE)
+    #define VICTOR_F32X8_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class f32x8;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_F32X8_H_DECLARE)
+    #define VICTOR_F32X8_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class f32x8 {
+          private:
+            __m256 n;
+
+          public:
+            VICTOR_INLINE f32x8(__m256 value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m256 to_native(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x8(float value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x8(float e0, float e1, float e2, float e3, float e4, float e5, float e6, float e7) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x8(f32x4 low, f32x4 high) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x8 operator+(f32x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x8 operator&(f32x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x8 and_not(f32x8 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x8 load(const float src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x8 load_aligned(const float src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x8 load_stream(const float src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(float values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(float values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(float values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f32x8 load_partial(const float src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(float dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x4 low(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 high(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f64x4 as_f64x4(void) const VICTOR_NOEXCEPT;
+
+            #if defined(VICTOR_ENABLE_AVX2)
+              VICTOR_INLINE i32x8 to_i32x8(void) const VICTOR_NOEXCEPT;
+              VICTOR_INLINE i32x8 as_i32x8(void) const VICTOR_NOEXCEPT;
+              static VICTOR_INLINE f32x8 gather(const float base[], i32x8 indices) VICTOR_NOEXCEPT;
+              VICTOR_INLINE void scatter(float base[], i32x8 indices) const VICTOR_NOEXCEPT;
+            #endif
+        };
+
+        VICTOR_INLINE f32x8 fmadd(f32x8 a, f32x8 b, f32x8 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x8 fmsub(f32x8 a, f32x8 b, f32x8 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x8 fnmadd(f32x8 a, f32x8 b, f32x8 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f32x8 fnmsub(f32x8 a, f32x8 b, f32x8 c) VICTOR_NOEXCEPT;
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef float victor_f32x8 __attribute__((__vector_size__(32),__aligned__(32)));
+
+        static VICTOR_INLINE victor_f32x8 victor_f32x8_from_native(__m256 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_f32x8, v);
+          #else
+            union {
+              __m256 from;
+              victor_f32x8 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m256 victor_f32x8_to_native(victor_f32x8 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m256, v);
+          #else
+            union {
+              victor_f32x8 from;
+              __m256 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m256 victor_f32x8;
+        #define victor_f32x8_to_native(v) (v)
+        #define victor_f32x8_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_F32X8_H_DEFINE)
+    #define VICTOR_F32X8_H_DEFINE
+
+    /* Partial loads and stores of the first n lanes.  AVX has no
+       256-bit integer compare, so build the mask with a float one. */
+    static VICTOR_INLINE __m256i victor_x_mm256_partial_mask_ps(size_t n) {
+      return _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), _mm256_set1_ps(HEDLEY_STATIC_CAST(float, n)), _CMP_LT_OQ));
+    }
+
+    static VICTOR_INLINE __m256 victor_x_mm256_load_partial_ps(const float* src, size_t n) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        return _mm256_maskz_loadu_ps(HEDLEY_STATIC_CAST(__mmask8, 0xFFu >> (8 - n)), src);
+      #else
+        return _mm256_maskload_ps(src, victor_x_mm256_partial_mask_ps(n));
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm256_store_partial_ps(float* dest, size_t n, __m256 v) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        _mm256_mask_storeu_ps(dest, HEDLEY_STATIC_CAST(__mmask8, 0xFFu >> (8 - n)), v);
+      #else
+        _mm256_maskstore_ps(dest, victor_x_mm256_partial_mask_ps(n), v);
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_AVX2)
+      /* See victor_x_mm256_i32scatter_epi32 in i32x8.h. */
+      static VICTOR_INLINE void victor_x_mm256_i32scatter_ps(float* base, __m256i vindex, __m256 v) {
+        #if defined(VICTOR_ENABLE_AVX512VL)
+          _mm256_i32scatter_ps(base, vindex, v, 4);
+        #else
+          victor_x_mm_i32scatter_ps(base, _mm256_castsi256_si128(vindex), _mm256_castps256_ps128(v));
+          victor_x_mm_i32scatter_ps(base, _mm256_extracti128_si256(vindex, 1), _mm256_extractf128_ps(v, 1));
+        #endif
+      }
+    #endif
+
+    /* Multiply-add; see victor_x_mm_fmadd_ps in f32x4.h. */
+    static VICTOR_INLINE __m256 victor_x_mm256_fmadd_ps(__m256 a, __m256 b, __m256 c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm256_fmadd_ps(a, b, c);
+      #else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+      #endif
+    }
+
+    static VICTOR_INLINE __m256 victor_x_mm256_fmsub_ps(__m256 a, __m256 b, __m256 c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm256_fmsub_ps(a, b, c);
+      #else
+        return _mm256_sub_ps(_mm256_mul_ps(a, b), c);
+      #endif
+    }
+
+    static VICTOR_INLINE __m256 victor_x_mm256_fnmadd_ps(__m256 a, __m256 b, __m256 c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm256_fnmadd_ps(a, b, c);
+      #else
+        return _mm256_sub_ps(c, _mm256_mul_ps(a, b));
+      #endif
+    }
+
+    static VICTOR_INLINE __m256 victor_x_mm256_fnmsub_ps(__m256 a, __m256 b, __m256 c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm256_fnmsub_ps(a, b, c);
+      #else
+        return _mm256_sub_ps(_mm256_xor_ps(_mm256_mul_ps(a, b), _mm256_set1_ps(-0.0f)), c);
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE f32x8::f32x8(__m256 value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m256 f32x8::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE f32x8::f32x8(float value) VICTOR_NOEXCEPT :n(_mm256_set1_ps(value)) { };
+        VICTOR_INLINE f32x8::f32x8(float e0, float e1, float e2, float e3, float e4, float e5, float e6, float e7) VICTOR_NOEXCEPT
+          :n(_mm256_setr_ps(e0, e1, e2, e3, e4, e5, e6, e7)) { };
+        VICTOR_INLINE f32x8::f32x8(f32x4 low, f32x4 high) VICTOR_NOEXCEPT
+          :n(_mm256_insertf128_ps(_mm256_castps128_ps256(low.to_native()), high.to_native(), 1)) { };
+        VICTOR_INLINE f32x8 f32x8::operator+(f32x8 a) const VICTOR_NOEXCEPT { return f32x8(_mm256_add_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x8 f32x8::operator&(f32x8 a) const VICTOR_NOEXCEPT { return f32x8(_mm256_and_ps(n, a.to_native())); };
+        VICTOR_INLINE f32x8 f32x8::and_not(f32x8 a) const VICTOR_NOEXCEPT { return f32x8(_mm256_andnot_ps(a.to_native(), n)); };
+        VICTOR_INLINE f32x8 f32x8::load(const float src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT { return f32x8(_mm256_loadu_ps(src)); }
+        VICTOR_INLINE f32x8 f32x8::load_aligned(const float src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 32);
+          return f32x8(_mm256_load_ps(src));
+        }
+        VICTOR_INLINE f32x8 f32x8::load_stream(const float src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 32);
+          #if defined(VICTOR_ENABLE_AVX2)
+            return f32x8(_mm256_castsi256_ps(_mm256_stream_load_si256(HEDLEY_CONST_CAST(__m256i*, HEDLEY_REINTERPRET_CAST(const __m256i*, src)))));
+          #else
+            return f32x8(_mm256_load_ps(src));
+          #endif
+        }
+        VICTOR_INLINE void f32x8::store(float dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT { _mm256_storeu_ps(dest, n); }
+        VICTOR_INLINE void f32x8::store_aligned(float dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 32);
+          _mm256_store_ps(dest, n);
+        }
+        VICTOR_INLINE void f32x8::store_stream(float dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 32);
+          _mm256_stream_ps(dest, n);
+        }
+        VICTOR_INLINE f32x8 f32x8::load_partial(const float src[], size_t count) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_load_partial_ps(src, VICTOR_X_PARTIAL_COUNT(count, 8))); }
+        VICTOR_INLINE void f32x8::store_partial(float dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm256_store_partial_ps(dest, VICTOR_X_PARTIAL_COUNT(count, 8), n); }
+
+        VICTOR_INLINE f32x4 f32x8::low(void) const VICTOR_NOEXCEPT { return f32x4(_mm256_castps256_ps128(n)); };
+        VICTOR_INLINE f32x4 f32x8::high(void) const VICTOR_NOEXCEPT { return f32x4(_mm256_extractf128_ps(n, 1)); };
+
+        VICTOR_INLINE f64x4 f32x8::as_f64x4(void) const VICTOR_NOEXCEPT { return f64x4(_mm256_castps_pd(n)); };
+
+        #if defined(VICTOR_ENABLE_AVX2)
+          VICTOR_INLINE i32x8 f32x8::to_i32x8(void) const VICTOR_NOEXCEPT { return i32x8(_mm256_cvtps_epi32(n)); };
+          VICTOR_INLINE i32x8 f32x8::as_i32x8(void) const VICTOR_NOEXCEPT { return i32x8(_mm256_castps_si256(n)); };
+          VICTOR_INLINE f32x8 f32x8::gather(const float base[], i32x8 indices) VICTOR_NOEXCEPT { return f32x8(_mm256_i32gather_ps(base, indices.to_native(), 4)); }
+          VICTOR_INLINE void f32x8::scatter(float base[], i32x8 indices) const VICTOR_NOEXCEPT { victor_x_mm256_i32scatter_ps(base, indices.to_native(), n); }
+        #endif
+
+        VICTOR_INLINE f32x8 fmadd(f32x8 a, f32x8 b, f32x8 c) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_fmadd_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x8 fmsub(f32x8 a, f32x8 b, f32x8 c) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_fmsub_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x8 fnmadd(f32x8 a, f32x8 b, f32x8 c) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_fnmadd_ps(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f32x8 fnmsub(f32x8 a, f32x8 b, f32x8 c) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_fnmsub_ps(a.to_native(), b.to_native(), c.to_native())); }
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_add(victor_f32x8 a, victor_f32x8 b) {
+        return victor_f32x8_from_native(_mm256_add_ps(victor_f32x8_to_native(a), victor_f32x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_and(victor_f32x8 a, victor_f32x8 b) {
+        return victor_f32x8_from_native(_mm256_and_ps(victor_f32x8_to_native(a), victor_f32x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_and_not(victor_f32x8 a, victor_f32x8 b) {
+        return victor_f32x8_from_native(_mm256_andnot_ps(victor_f32x8_to_native(b), victor_f32x8_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_set1(float value) {
+        return victor_f32x8_from_native(_mm256_set1_ps(value));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_set(float e0, float e1, float e2, float e3, float e4, float e5, float e6, float e7) {
+        return victor_f32x8_from_native(_mm256_setr_ps(e0, e1, e2, e3, e4, e5, e6, e7));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_load(const float src[HEDLEY_ARRAY_PARAM(8)]) {
+        return victor_f32x8_from_native(_mm256_loadu_ps(src));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_load_aligned(const float src[HEDLEY_ARRAY_PARAM(8)]) {
+        VICTOR_ASSERT_ALIGNED(src, 32);
+        return victor_f32x8_from_native(_mm256_load_ps(src));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_load_stream(const float src[HEDLEY_ARRAY_PARAM(8)]) {
+        VICTOR_ASSERT_ALIGNED(src, 32);
+        #if defined(VICTOR_ENABLE_AVX2)
+          return victor_f32x8_from_native(_mm256_castsi256_ps(_mm256_stream_load_si256(HEDLEY_CONST_CAST(__m256i*, HEDLEY_REINTERPRET_CAST(const __m256i*, src)))));
+        #else
+          return victor_f32x8_from_native(_mm256_load_ps(src));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_f32x8_store(float dest[HEDLEY_ARRAY_PARAM(8)], victor_f32x8 src) {
+        _mm256_storeu_ps(dest, victor_f32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f32x8_store_aligned(float dest[HEDLEY_ARRAY_PARAM(8)], victor_f32x8 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 32);
+        _mm256_store_ps(dest, victor_f32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f32x8_store_stream(float dest[HEDLEY_ARRAY_PARAM(8)], victor_f32x8 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 32);
+        _mm256_stream_ps(dest, victor_f32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_load_partial(const float src[], size_t count) {
+        return victor_f32x8_from_native(victor_x_mm256_load_partial_ps(src, VICTOR_X_PARTIAL_COUNT(count, 8)));
+      }
+
+      static VICTOR_INLINE void victor_f32x8_store_partial(float dest[], size_t count, victor_f32x8 src) {
+        victor_x_mm256_store_partial_ps(dest, VICTOR_X_PARTIAL_COUNT(count, 8), victor_f32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_join(victor_f32x4 low, victor_f32x4 high) {
+        return victor_f32x8_from_native(_mm256_insertf128_ps(_mm256_castps128_ps256(victor_f32x4_to_native(low)), victor_f32x4_to_native(high), 1));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x8_low(victor_f32x8 src) {
+        return victor_f32x4_from_native(_mm256_castps256_ps128(victor_f32x8_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f32x8_high(victor_f32x8 src) {
+        return victor_f32x4_from_native(_mm256_extractf128_ps(victor_f32x8_to_native(src), 1));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f32x8_as_f64x4(victor_f32x8 src) {
+        return victor_f64x4_from_native(_mm256_castps_pd(victor_f32x8_to_native(src)));
+      }
+
+      #if defined(VICTOR_ENABLE_AVX2)
+        static VICTOR_INLINE victor_i32x8 victor_f32x8_to_i32x8(victor_f32x8 src) {
+          return victor_i32x8_from_native(_mm256_cvtps_epi32(victor_f32x8_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_i32x8 victor_f32x8_as_i32x8(victor_f32x8 src) {
+          return victor_i32x8_from_native(_mm256_castps_si256(victor_f32x8_to_native(src)));
+        }
+
+        static VICTOR_INLINE victor_f32x8 victor_f32x8_gather(const float base[], victor_i32x8 indices) {
+          return victor_f32x8_from_native(_mm256_i32gather_ps(base, victor_i32x8_to_native(indices), 4));
+        }
+
+        static VICTOR_INLINE void victor_f32x8_scatter(float base[], victor_i32x8 indices, victor_f32x8 src) {
+          victor_x_mm256_i32scatter_ps(base, victor_i32x8_to_native(indices), victor_f32x8_to_native(src));
+        }
+      #endif /* defined(VICTOR_ENABLE_AVX2) */
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_fmadd(victor_f32x8 a, victor_f32x8 b, victor_f32x8 c) {
+        return victor_f32x8_from_native(victor_x_mm256_fmadd_ps(victor_f32x8_to_native(a), victor_f32x8_to_native(b), victor_f32x8_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_fmsub(victor_f32x8 a, victor_f32x8 b, victor_f32x8 c) {
+        return victor_f32x8_from_native(victor_x_mm256_fmsub_ps(victor_f32x8_to_native(a), victor_f32x8_to_native(b), victor_f32x8_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_fnmadd(victor_f32x8 a, victor_f32x8 b, victor_f32x8 c) {
+        return victor_f32x8_from_native(victor_x_mm256_fnmadd_ps(victor_f32x8_to_native(a), victor_f32x8_to_native(b), victor_f32x8_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f32x8_fnmsub(victor_f32x8 a, victor_f32x8 b, victor_f32x8 c) {
+        return victor_f32x8_from_native(victor_x_mm256_fnmsub_ps(victor_f32x8_to_native(a), victor_f32x8_to_native(b), victor_f32x8_to_native(c)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_F32X8_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX) */
@@ -0,0 +1,327 @@
+/* f64x2.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_SSE2)
+  #if !defined(VICTOR_F64X2_H_FORWARD_DECLARE)
+    #define VICTOR_F64X2_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class f64x2;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_F64X2_H_DECLARE)
+    #define VICTOR_F64X2_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class f64x2 {
+          private:
+            __m128d n;
+
+          public:
+            VICTOR_INLINE f64x2(__m128d value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128d to_native(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f64x2(double value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2(double e0, double e1) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f64x2 operator+(f64x2 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 operator&(f64x2 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 and_not(f64x2 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f64x2 load(const double src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f64x2 load_aligned(const double src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f64x2 load_stream(const double src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(double values[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(double values[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(double values[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f64x2 load_partial(const double src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(double dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x4 to_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 as_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 as_i32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 as_i8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 as_u8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 as_i16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 as_u16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 as_u32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 as_i64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 as_u64x2(void) const VICTOR_NOEXCEPT;
+        };
+
+        VICTOR_INLINE f64x2 fmadd(f64x2 a, f64x2 b, f64x2 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f64x2 fmsub(f64x2 a, f64x2 b, f64x2 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f64x2 fnmadd(f64x2 a, f64x2 b, f64x2 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f64x2 fnmsub(f64x2 a, f64x2 b, f64x2 c) VICTOR_NOEXCEPT;
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef double victor_f64x2 __attribute__((__vector_size__(16),__aligned__(16)));
+
+        static VICTOR_INLINE victor_f64x2 victor_f64x2_from_native(__m128d v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_f64x2, v);
+          #else
+            union {
+              __m128d from;
+              victor_f64x2 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m128d victor_f64x2_to_native(victor_f64x2 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m128d, v);
+          #else
+            union {
+              victor_f64x2 from;
+              __m128d to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m128d victor_f64x2;
+        #define victor_f64x2_to_native(v) (v)
+        #define victor_f64x2_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_F64X2_H_DEFINE)
+    #define VICTOR_F64X2_H_DEFINE
+
+    /* Multiply-add; see victor_x_mm_fmadd_ps in f32x4.h. */
+    static VICTOR_INLINE __m128d victor_x_mm_fmadd_pd(__m128d a, __m128d b, __m128d c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm_fmadd_pd(a, b, c);
+      #else
+        return _mm_add_pd(_mm_mul_pd(a, b), c);
+      #endif
+    }
+
+    static VICTOR_INLINE __m128d victor_x_mm_fmsub_pd(__m128d a, __m128d b, __m128d c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm_fmsub_pd(a, b, c);
+      #else
+        return _mm_sub_pd(_mm_mul_pd(a, b), c);
+      #endif
+    }
+
+    static VICTOR_INLINE __m128d victor_x_mm_fnmadd_pd(__m128d a, __m128d b, __m128d c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm_fnmadd_pd(a, b, c);
+      #else
+        return _mm_sub_pd(c, _mm_mul_pd(a, b));
+      #endif
+    }
+
+    static VICTOR_INLINE __m128d victor_x_mm_fnmsub_pd(__m128d a, __m128d b, __m128d c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm_fnmsub_pd(a, b, c);
+      #else
+        return _mm_sub_pd(_mm_xor_pd(_mm_mul_pd(a, b), _mm_set1_pd(-0.0)), c);
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE f64x2::f64x2(__m128d value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128d f64x2::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE f64x2::f64x2(double value) VICTOR_NOEXCEPT :n(_mm_set1_pd(value)) { };
+        VICTOR_INLINE f64x2::f64x2(double e0, double e1) VICTOR_NOEXCEPT :n(_mm_setr_pd(e0, e1)) { };
+        VICTOR_INLINE f64x2 f64x2::operator+(f64x2 a) const VICTOR_NOEXCEPT { return f64x2(_mm_add_pd(n, a.to_native())); };
+        VICTOR_INLINE f64x2 f64x2::operator&(f64x2 a) const VICTOR_NOEXCEPT { return f64x2(_mm_and_pd(n, a.to_native())); };
+        VICTOR_INLINE f64x2 f64x2::and_not(f64x2 a) const VICTOR_NOEXCEPT { return f64x2(_mm_andnot_pd(a.to_native(), n)); };
+        VICTOR_INLINE f64x2 f64x2::load(const double src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT { return f64x2(_mm_loadu_pd(src)); }
+        VICTOR_INLINE f64x2 f64x2::load_aligned(const double src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          return f64x2(_mm_load_pd(src));
+        }
+        VICTOR_INLINE f64x2 f64x2::load_stream(const double src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return f64x2(_mm_castsi128_pd(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src)))));
+          #else
+            return f64x2(_mm_load_pd(src));
+          #endif
+        }
+        VICTOR_INLINE void f64x2::store(double dest[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT { _mm_storeu_pd(dest, n); }
+        VICTOR_INLINE void f64x2::store_aligned(double dest[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_store_pd(dest, n);
+        }
+        VICTOR_INLINE void f64x2::store_stream(double dest[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_stream_pd(dest, n);
+        }
+        VICTOR_INLINE f64x2 f64x2::load_partial(const double src[], size_t count) VICTOR_NOEXCEPT { return f64x2(_mm_castsi128_pd(victor_x_mm_load_partial_epi64(src, VICTOR_X_PARTIAL_COUNT(count, 2)))); }
+        VICTOR_INLINE void f64x2::store_partial(double dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm_store_partial_epi64(dest, VICTOR_X_PARTIAL_COUNT(count, 2), _mm_castpd_si128(n)); }
+
+        VICTOR_INLINE f32x4 f64x2::to_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_cvtpd_ps(n)); };
+        VICTOR_INLINE f32x4 f64x2::as_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_castpd_ps(n)); };
+        VICTOR_INLINE i32x4 f64x2::as_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(_mm_castpd_si128(n)); };
+        VICTOR_INLINE i8x16 f64x2::as_i8x16(void) const VICTOR_NOEXCEPT { return i8x16(_mm_castpd_si128(n)); };
+        VICTOR_INLINE u8x16 f64x2::as_u8x16(void) const VICTOR_NOEXCEPT { return u8x16(_mm_castpd_si128(n)); };
+        VICTOR_INLINE i16x8 f64x2::as_i16x8(void) const VICTOR_NOEXCEPT { return i16x8(_mm_castpd_si128(n)); };
+        VICTOR_INLINE u16x8 f64x2::as_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(_mm_castpd_si128(n)); };
+        VICTOR_INLINE u32x4 f64x2::as_u32x4(void) const VICTOR_NOEXCEPT { return u32x4(_mm_castpd_si128(n)); };
+        VICTOR_INLINE i64x2 f64x2::as_i64x2(void) const VICTOR_NOEXCEPT { return i64x2(_mm_castpd_si128(n)); };
+        VICTOR_INLINE u64x2 f64x2::as_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(_mm_castpd_si128(n)); };
+
+        VICTOR_INLINE f64x2 fmadd(f64x2 a, f64x2 b, f64x2 c) VICTOR_NOEXCEPT { return f64x2(victor_x_mm_fmadd_pd(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f64x2 fmsub(f64x2 a, f64x2 b, f64x2 c) VICTOR_NOEXCEPT { return f64x2(victor_x_mm_fmsub_pd(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f64x2 fnmadd(f64x2 a, f64x2 b, f64x2 c) VICTOR_NOEXCEPT { return f64x2(victor_x_mm_fnmadd_pd(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f64x2 fnmsub(f64x2 a, f64x2 b, f64x2 c) VICTOR_NOEXCEPT { return f64x2(victor_x_mm_fnmsub_pd(a.to_native(), b.to_native(), c.to_native())); }
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_add(victor_f64x2 a, victor_f64x2 b) {
+        return victor_f64x2_from_native(_mm_add_pd(victor_f64x2_to_native(a), victor_f64x2_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_and(victor_f64x2 a, victor_f64x2 b) {
+        return victor_f64x2_from_native(_mm_and_pd(victor_f64x2_to_native(a), victor_f64x2_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_and_not(victor_f64x2 a, victor_f64x2 b) {
+        return victor_f64x2_from_native(_mm_andnot_pd(victor_f64x2_to_native(b), victor_f64x2_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_set1(double value) {
+        return victor_f64x2_from_native(_mm_set1_pd(value));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_set(double e0, double e1) {
+        return victor_f64x2_from_native(_mm_setr_pd(e0, e1));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_load(const double src[HEDLEY_ARRAY_PARAM(2)]) {
+        return victor_f64x2_from_native(_mm_loadu_pd(src));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_load_aligned(const double src[HEDLEY_ARRAY_PARAM(2)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        return victor_f64x2_from_native(_mm_load_pd(src));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_load_stream(const double src[HEDLEY_ARRAY_PARAM(2)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_f64x2_from_native(_mm_castsi128_pd(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src)))));
+        #else
+          return victor_f64x2_from_native(_mm_load_pd(src));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_f64x2_store(double dest[HEDLEY_ARRAY_PARAM(2)], victor_f64x2 src) {
+        _mm_storeu_pd(dest, victor_f64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f64x2_store_aligned(double dest[HEDLEY_ARRAY_PARAM(2)], victor_f64x2 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_store_pd(dest, victor_f64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f64x2_store_stream(double dest[HEDLEY_ARRAY_PARAM(2)], victor_f64x2 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_stream_pd(dest, victor_f64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_load_partial(const double src[], size_t count) {
+        return victor_f64x2_from_native(_mm_castsi128_pd(victor_x_mm_load_partial_epi64(src, VICTOR_X_PARTIAL_COUNT(count, 2))));
+      }
+
+      static VICTOR_INLINE void victor_f64x2_store_partial(double dest[], size_t count, victor_f64x2 src) {
+        victor_x_mm_store_partial_epi64(dest, VICTOR_X_PARTIAL_COUNT(count, 2), _mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f64x2_to_f32x4(victor_f64x2 src) {
+        return victor_f32x4_from_native(_mm_cvtpd_ps(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f64x2_as_f32x4(victor_f64x2 src) {
+        return victor_f32x4_from_native(_mm_castpd_ps(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_f64x2_as_i32x4(victor_f64x2 src) {
+        return victor_i32x4_from_native(_mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_f64x2_as_i8x16(victor_f64x2 src) {
+        return victor_i8x16_from_native(_mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_f64x2_as_u8x16(victor_f64x2 src) {
+        return victor_u8x16_from_native(_mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_f64x2_as_i16x8(victor_f64x2 src) {
+        return victor_i16x8_from_native(_mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_f64x2_as_u16x8(victor_f64x2 src) {
+        return victor_u16x8_from_native(_mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_f64x2_as_u32x4(victor_f64x2 src) {
+        return victor_u32x4_from_native(_mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_f64x2_as_i64x2(victor_f64x2 src) {
+        return victor_i64x2_from_native(_mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_f64x2_as_u64x2(victor_f64x2 src) {
+        return victor_u64x2_from_native(_mm_castpd_si128(victor_f64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_fmadd(victor_f64x2 a, victor_f64x2 b, victor_f64x2 c) {
+        return victor_f64x2_from_native(victor_x_mm_fmadd_pd(victor_f64x2_to_native(a), victor_f64x2_to_native(b), victor_f64x2_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_fmsub(victor_f64x2 a, victor_f64x2 b, victor_f64x2 c) {
+        return victor_f64x2_from_native(victor_x_mm_fmsub_pd(victor_f64x2_to_native(a), victor_f64x2_to_native(b), victor_f64x2_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_fnmadd(victor_f64x2 a, victor_f64x2 b, victor_f64x2 c) {
+        return victor_f64x2_from_native(victor_x_mm_fnmadd_pd(victor_f64x2_to_native(a), victor_f64x2_to_native(b), victor_f64x2_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x2_fnmsub(victor_f64x2 a, victor_f64x2 b, victor_f64x2 c) {
+        return victor_f64x2_from_native(victor_x_mm_fnmsub_pd(victor_f64x2_to_native(a), victor_f64x2_to_native(b), victor_f64x2_to_native(c)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_F64X2_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_SSE2) */
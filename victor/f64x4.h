@@ -0,0 +1,322 @@
+/* f64x4.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX)
+  #if !defined(VICTOR_F64X4_H_FORWARD_DECLARE)
+    #define VICTOR_F64X4_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class f64x4;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_F64X4_H_DECLARE)
+    #define VICTOR_F64X4_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class f64x4 {
+          private:
+            __m256d n;
+
+          public:
+            VICTOR_INLINE f64x4(__m256d value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m256d to_native(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f64x4(double value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x4(double e0, double e1, double e2, double e3) VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x4(f64x2 low, f64x2 high) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f64x4 operator+(f64x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x4 operator&(f64x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x4 and_not(f64x4 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f64x4 load(const double src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f64x4 load_aligned(const double src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f64x4 load_stream(const double src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(double values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(double values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(double values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE f64x4 load_partial(const double src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(double dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f64x2 low(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 high(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x4 to_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x8 as_f32x8(void) const VICTOR_NOEXCEPT;
+        };
+
+        VICTOR_INLINE f64x4 fmadd(f64x4 a, f64x4 b, f64x4 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f64x4 fmsub(f64x4 a, f64x4 b, f64x4 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f64x4 fnmadd(f64x4 a, f64x4 b, f64x4 c) VICTOR_NOEXCEPT;
+        VICTOR_INLINE f64x4 fnmsub(f64x4 a, f64x4 b, f64x4 c) VICTOR_NOEXCEPT;
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef double victor_f64x4 __attribute__((__vector_size__(32),__aligned__(32)));
+
+        static VICTOR_INLINE victor_f64x4 victor_f64x4_from_native(__m256d v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_f64x4, v);
+          #else
+            union {
+              __m256d from;
+              victor_f64x4 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m256d victor_f64x4_to_native(victor_f64x4 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m256d, v);
+          #else
+            union {
+              victor_f64x4 from;
+              __m256d to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m256d victor_f64x4;
+        #define victor_f64x4_to_native(v) (v)
+        #define victor_f64x4_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_F64X4_H_DEFINE)
+    #define VICTOR_F64X4_H_DEFINE
+
+    /* Partial loads and stores of the first n lanes. */
+    static VICTOR_INLINE __m256i victor_x_mm256_partial_mask_pd(size_t n) {
+      return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_setr_pd(0.0, 1.0, 2.0, 3.0), _mm256_set1_pd(HEDLEY_STATIC_CAST(double, n)), _CMP_LT_OQ));
+    }
+
+    static VICTOR_INLINE __m256d victor_x_mm256_load_partial_pd(const double* src, size_t n) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        return _mm256_maskz_loadu_pd(HEDLEY_STATIC_CAST(__mmask8, 0xFu >> (4 - n)), src);
+      #else
+        return _mm256_maskload_pd(src, victor_x_mm256_partial_mask_pd(n));
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm256_store_partial_pd(double* dest, size_t n, __m256d v) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        _mm256_mask_storeu_pd(dest, HEDLEY_STATIC_CAST(__mmask8, 0xFu >> (4 - n)), v);
+      #else
+        _mm256_maskstore_pd(dest, victor_x_mm256_partial_mask_pd(n), v);
+      #endif
+    }
+
+    /* Multiply-add; see victor_x_mm_fmadd_ps in f32x4.h. */
+    static VICTOR_INLINE __m256d victor_x_mm256_fmadd_pd(__m256d a, __m256d b, __m256d c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm256_fmadd_pd(a, b, c);
+      #else
+        return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+      #endif
+    }
+
+    static VICTOR_INLINE __m256d victor_x_mm256_fmsub_pd(__m256d a, __m256d b, __m256d c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm256_fmsub_pd(a, b, c);
+      #else
+        return _mm256_sub_pd(_mm256_mul_pd(a, b), c);
+      #endif
+    }
+
+    static VICTOR_INLINE __m256d victor_x_mm256_fnmadd_pd(__m256d a, __m256d b, __m256d c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm256_fnmadd_pd(a, b, c);
+      #else
+        return _mm256_sub_pd(c, _mm256_mul_pd(a, b));
+      #endif
+    }
+
+    static VICTOR_INLINE __m256d victor_x_mm256_fnmsub_pd(__m256d a, __m256d b, __m256d c) {
+      #if defined(VICTOR_ENABLE_FMA)
+        return _mm256_fnmsub_pd(a, b, c);
+      #else
+        return _mm256_sub_pd(_mm256_xor_pd(_mm256_mul_pd(a, b), _mm256_set1_pd(-0.0)), c);
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE f64x4::f64x4(__m256d value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m256d f64x4::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE f64x4::f64x4(double value) VICTOR_NOEXCEPT :n(_mm256_set1_pd(value)) { };
+        VICTOR_INLINE f64x4::f64x4(double e0, double e1, double e2, double e3) VICTOR_NOEXCEPT
+          :n(_mm256_setr_pd(e0, e1, e2, e3)) { };
+        VICTOR_INLINE f64x4::f64x4(f64x2 low, f64x2 high) VICTOR_NOEXCEPT
+          :n(_mm256_insertf128_pd(_mm256_castpd128_pd256(low.to_native()), high.to_native(), 1)) { };
+        VICTOR_INLINE f64x4 f64x4::operator+(f64x4 a) const VICTOR_NOEXCEPT { return f64x4(_mm256_add_pd(n, a.to_native())); };
+        VICTOR_INLINE f64x4 f64x4::operator&(f64x4 a) const VICTOR_NOEXCEPT { return f64x4(_mm256_and_pd(n, a.to_native())); };
+        VICTOR_INLINE f64x4 f64x4::and_not(f64x4 a) const VICTOR_NOEXCEPT { return f64x4(_mm256_andnot_pd(a.to_native(), n)); };
+        VICTOR_INLINE f64x4 f64x4::load(const double src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT { return f64x4(_mm256_loadu_pd(src)); }
+        VICTOR_INLINE f64x4 f64x4::load_aligned(const double src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 32);
+          return f64x4(_mm256_load_pd(src));
+        }
+        VICTOR_INLINE f64x4 f64x4::load_stream(const double src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 32);
+          #if defined(VICTOR_ENABLE_AVX2)
+            return f64x4(_mm256_castsi256_pd(_mm256_stream_load_si256(HEDLEY_CONST_CAST(__m256i*, HEDLEY_REINTERPRET_CAST(const __m256i*, src)))));
+          #else
+            return f64x4(_mm256_load_pd(src));
+          #endif
+        }
+        VICTOR_INLINE void f64x4::store(double dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT { _mm256_storeu_pd(dest, n); }
+        VICTOR_INLINE void f64x4::store_aligned(double dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 32);
+          _mm256_store_pd(dest, n);
+        }
+        VICTOR_INLINE void f64x4::store_stream(double dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 32);
+          _mm256_stream_pd(dest, n);
+        }
+        VICTOR_INLINE f64x4 f64x4::load_partial(const double src[], size_t count) VICTOR_NOEXCEPT { return f64x4(victor_x_mm256_load_partial_pd(src, VICTOR_X_PARTIAL_COUNT(count, 4))); }
+        VICTOR_INLINE void f64x4::store_partial(double dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm256_store_partial_pd(dest, VICTOR_X_PARTIAL_COUNT(count, 4), n); }
+
+        VICTOR_INLINE f64x2 f64x4::low(void) const VICTOR_NOEXCEPT { return f64x2(_mm256_castpd256_pd128(n)); };
+        VICTOR_INLINE f64x2 f64x4::high(void) const VICTOR_NOEXCEPT { return f64x2(_mm256_extractf128_pd(n, 1)); };
+
+        VICTOR_INLINE f32x4 f64x4::to_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm256_cvtpd_ps(n)); };
+        VICTOR_INLINE f32x8 f64x4::as_f32x8(void) const VICTOR_NOEXCEPT { return f32x8(_mm256_castpd_ps(n)); };
+
+        VICTOR_INLINE f64x4 fmadd(f64x4 a, f64x4 b, f64x4 c) VICTOR_NOEXCEPT { return f64x4(victor_x_mm256_fmadd_pd(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f64x4 fmsub(f64x4 a, f64x4 b, f64x4 c) VICTOR_NOEXCEPT { return f64x4(victor_x_mm256_fmsub_pd(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f64x4 fnmadd(f64x4 a, f64x4 b, f64x4 c) VICTOR_NOEXCEPT { return f64x4(victor_x_mm256_fnmadd_pd(a.to_native(), b.to_native(), c.to_native())); }
+        VICTOR_INLINE f64x4 fnmsub(f64x4 a, f64x4 b, f64x4 c) VICTOR_NOEXCEPT { return f64x4(victor_x_mm256_fnmsub_pd(a.to_native(), b.to_native(), c.to_native())); }
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_add(victor_f64x4 a, victor_f64x4 b) {
+        return victor_f64x4_from_native(_mm256_add_pd(victor_f64x4_to_native(a), victor_f64x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_and(victor_f64x4 a, victor_f64x4 b) {
+        return victor_f64x4_from_native(_mm256_and_pd(victor_f64x4_to_native(a), victor_f64x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_and_not(victor_f64x4 a, victor_f64x4 b) {
+        return victor_f64x4_from_native(_mm256_andnot_pd(victor_f64x4_to_native(b), victor_f64x4_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_set1(double value) {
+        return victor_f64x4_from_native(_mm256_set1_pd(value));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_set(double e0, double e1, double e2, double e3) {
+        return victor_f64x4_from_native(_mm256_setr_pd(e0, e1, e2, e3));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_load(const double src[HEDLEY_ARRAY_PARAM(4)]) {
+        return victor_f64x4_from_native(_mm256_loadu_pd(src));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_load_aligned(const double src[HEDLEY_ARRAY_PARAM(4)]) {
+        VICTOR_ASSERT_ALIGNED(src, 32);
+        return victor_f64x4_from_native(_mm256_load_pd(src));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_load_stream(const double src[HEDLEY_ARRAY_PARAM(4)]) {
+        VICTOR_ASSERT_ALIGNED(src, 32);
+        #if defined(VICTOR_ENABLE_AVX2)
+          return victor_f64x4_from_native(_mm256_castsi256_pd(_mm256_stream_load_si256(HEDLEY_CONST_CAST(__m256i*, HEDLEY_REINTERPRET_CAST(const __m256i*, src)))));
+        #else
+          return victor_f64x4_from_native(_mm256_load_pd(src));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_f64x4_store(double dest[HEDLEY_ARRAY_PARAM(4)], victor_f64x4 src) {
+        _mm256_storeu_pd(dest, victor_f64x4_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f64x4_store_aligned(double dest[HEDLEY_ARRAY_PARAM(4)], victor_f64x4 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 32);
+        _mm256_store_pd(dest, victor_f64x4_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_f64x4_store_stream(double dest[HEDLEY_ARRAY_PARAM(4)], victor_f64x4 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 32);
+        _mm256_stream_pd(dest, victor_f64x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_load_partial(const double src[], size_t count) {
+        return victor_f64x4_from_native(victor_x_mm256_load_partial_pd(src, VICTOR_X_PARTIAL_COUNT(count, 4)));
+      }
+
+      static VICTOR_INLINE void victor_f64x4_store_partial(double dest[], size_t count, victor_f64x4 src) {
+        victor_x_mm256_store_partial_pd(dest, VICTOR_X_PARTIAL_COUNT(count, 4), victor_f64x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_join(victor_f64x2 low, victor_f64x2 high) {
+        return victor_f64x4_from_native(_mm256_insertf128_pd(_mm256_castpd128_pd256(victor_f64x2_to_native(low)), victor_f64x2_to_native(high), 1));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x4_low(victor_f64x4 src) {
+        return victor_f64x2_from_native(_mm256_castpd256_pd128(victor_f64x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_f64x4_high(victor_f64x4 src) {
+        return victor_f64x2_from_native(_mm256_extractf128_pd(victor_f64x4_to_native(src), 1));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_f64x4_to_f32x4(victor_f64x4 src) {
+        return victor_f32x4_from_native(_mm256_cvtpd_ps(victor_f64x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_f64x4_as_f32x8(victor_f64x4 src) {
+        return victor_f32x8_from_native(_mm256_castpd_ps(victor_f64x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_fmadd(victor_f64x4 a, victor_f64x4 b, victor_f64x4 c) {
+        return victor_f64x4_from_native(victor_x_mm256_fmadd_pd(victor_f64x4_to_native(a), victor_f64x4_to_native(b), victor_f64x4_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_fmsub(victor_f64x4 a, victor_f64x4 b, victor_f64x4 c) {
+        return victor_f64x4_from_native(victor_x_mm256_fmsub_pd(victor_f64x4_to_native(a), victor_f64x4_to_native(b), victor_f64x4_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_fnmadd(victor_f64x4 a, victor_f64x4 b, victor_f64x4 c) {
+        return victor_f64x4_from_native(victor_x_mm256_fnmadd_pd(victor_f64x4_to_native(a), victor_f64x4_to_native(b), victor_f64x4_to_native(c)));
+      }
+
+      static VICTOR_INLINE victor_f64x4 victor_f64x4_fnmsub(victor_f64x4 a, victor_f64x4 b, victor_f64x4 c) {
+        return victor_f64x4_from_native(victor_x_mm256_fnmsub_pd(victor_f64x4_to_native(a), victor_f64x4_to_native(b), victor_f64x4_to_native(c)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_F64X4_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX) */
@@ -0,0 +1,330 @@
+/* i16x8.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_SSE2)
+  #if !defined(VICTOR_I16X8_H_FORWARD_DECLARE)
+    #define VICTOR_I16X8_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i16x8;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_I16X8_H_DECLARE)
+    #define VICTOR_I16X8_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i16x8 {
+          private:
+            __m128i n;
+
+          public:
+            VICTOR_INLINE i16x8(__m128i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 to_i32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 to_i32x4_high(void) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i16x8 narrow(i32x4 low, i32x4 high) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8(int16_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8(int16_t e0, int16_t e1, int16_t e2, int16_t e3, int16_t e4, int16_t e5, int16_t e6, int16_t e7) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 operator+(i16x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 operator&(i16x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 and_not(i16x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 min(i16x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 max(i16x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 adds(i16x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 subs(i16x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 abs(void) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i16x8 load(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i16x8 load_aligned(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i16x8 load_stream(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(int16_t values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(int16_t values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(int16_t values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i16x8 load_partial(const int16_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(int16_t dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i8x16 as_i8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 as_u8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 as_u16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 as_i32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 as_u32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 as_i64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 as_u64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 as_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 as_f64x2(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef int16_t victor_i16x8 __attribute__((__vector_size__(16),__aligned__(16)));
+
+        static VICTOR_INLINE victor_i16x8 victor_i16x8_from_native(__m128i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_i16x8, v);
+          #else
+            union {
+              __m128i from;
+              victor_i16x8 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m128i victor_i16x8_to_native(victor_i16x8 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m128i, v);
+          #else
+            union {
+              victor_i16x8 from;
+              __m128i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m128i victor_i16x8;
+        #define victor_i16x8_to_native(v) (v)
+        #define victor_i16x8_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_I16X8_H_DEFINE)
+    #define VICTOR_I16X8_H_DEFINE
+
+    /* pabsw is SSSE3; without it, |x| is the signed maximum of x and
+       -x.  Like pabsw, abs(-32768) is -32768. */
+    static VICTOR_INLINE __m128i victor_x_mm_abs_epi16(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSSE3)
+        return _mm_abs_epi16(a);
+      #else
+        return _mm_max_epi16(a, _mm_sub_epi16(_mm_setzero_si128(), a));
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepi16_epi32(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_cvtepi16_epi32(a);
+      #else
+        return _mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16);
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepi16hi_epi32(__m128i a) {
+      return _mm_srai_epi32(_mm_unpackhi_epi16(a, a), 16);
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE i16x8::i16x8(__m128i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128i i16x8::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE i16x8::i16x8(int16_t value) VICTOR_NOEXCEPT :n(_mm_set1_epi16(value)) { };
+        VICTOR_INLINE i16x8::i16x8(int16_t e0, int16_t e1, int16_t e2, int16_t e3, int16_t e4, int16_t e5, int16_t e6, int16_t e7) VICTOR_NOEXCEPT :n(_mm_setr_epi16(e0, e1, e2, e3, e4, e5, e6, e7)) { };
+        VICTOR_INLINE i16x8 i16x8::operator+(i16x8 a) const VICTOR_NOEXCEPT { return i16x8(_mm_add_epi16(n, a.to_native())); };
+        VICTOR_INLINE i16x8 i16x8::operator&(i16x8 a) const VICTOR_NOEXCEPT { return i16x8(_mm_and_si128(n, a.to_native())); };
+        VICTOR_INLINE i16x8 i16x8::and_not(i16x8 a) const VICTOR_NOEXCEPT { return i16x8(_mm_andnot_si128(a.to_native(), n)); };
+        VICTOR_INLINE i16x8 i16x8::min(i16x8 a) const VICTOR_NOEXCEPT { return i16x8(_mm_min_epi16(n, a.to_native())); };
+        VICTOR_INLINE i16x8 i16x8::max(i16x8 a) const VICTOR_NOEXCEPT { return i16x8(_mm_max_epi16(n, a.to_native())); };
+        VICTOR_INLINE i16x8 i16x8::adds(i16x8 a) const VICTOR_NOEXCEPT { return i16x8(_mm_adds_epi16(n, a.to_native())); };
+        VICTOR_INLINE i16x8 i16x8::subs(i16x8 a) const VICTOR_NOEXCEPT { return i16x8(_mm_subs_epi16(n, a.to_native())); };
+        VICTOR_INLINE i16x8 i16x8::abs(void) const VICTOR_NOEXCEPT { return i16x8(victor_x_mm_abs_epi16(n)); };
+        VICTOR_INLINE i16x8 i16x8::load(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT { return i16x8(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src))); }
+        VICTOR_INLINE i16x8 i16x8::load_aligned(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          return i16x8(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        }
+        VICTOR_INLINE i16x8 i16x8::load_stream(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return i16x8(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+          #else
+            return i16x8(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+          #endif
+        }
+        VICTOR_INLINE void i16x8::store(int16_t dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT { _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n); }
+        VICTOR_INLINE void i16x8::store_aligned(int16_t dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE void i16x8::store_stream(int16_t dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE i16x8 i16x8::load_partial(const int16_t src[], size_t count) VICTOR_NOEXCEPT { return i16x8(victor_x_mm_load_partial_si128(src, VICTOR_X_PARTIAL_COUNT(count, 8) * 2)); }
+        VICTOR_INLINE void i16x8::store_partial(int16_t dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm_store_partial_si128(dest, VICTOR_X_PARTIAL_COUNT(count, 8) * 2, n); }
+
+        VICTOR_INLINE i32x4 i16x8::to_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(victor_x_mm_cvtepi16_epi32(n)); };
+        VICTOR_INLINE i32x4 i16x8::to_i32x4_high(void) const VICTOR_NOEXCEPT { return i32x4(victor_x_mm_cvtepi16hi_epi32(n)); };
+        VICTOR_INLINE i16x8 i16x8::narrow(i32x4 low, i32x4 high) VICTOR_NOEXCEPT { return i16x8(_mm_packs_epi32(low.to_native(), high.to_native())); };
+        VICTOR_INLINE i8x16 i16x8::as_i8x16(void) const VICTOR_NOEXCEPT { return i8x16(n); };
+        VICTOR_INLINE u8x16 i16x8::as_u8x16(void) const VICTOR_NOEXCEPT { return u8x16(n); };
+        VICTOR_INLINE u16x8 i16x8::as_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(n); };
+        VICTOR_INLINE i32x4 i16x8::as_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(n); };
+        VICTOR_INLINE u32x4 i16x8::as_u32x4(void) const VICTOR_NOEXCEPT { return u32x4(n); };
+        VICTOR_INLINE i64x2 i16x8::as_i64x2(void) const VICTOR_NOEXCEPT { return i64x2(n); };
+        VICTOR_INLINE u64x2 i16x8::as_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(n); };
+        VICTOR_INLINE f32x4 i16x8::as_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_castsi128_ps(n)); };
+        VICTOR_INLINE f64x2 i16x8::as_f64x2(void) const VICTOR_NOEXCEPT { return f64x2(_mm_castsi128_pd(n)); };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_add(victor_i16x8 a, victor_i16x8 b) {
+        return victor_i16x8_from_native(_mm_add_epi16(victor_i16x8_to_native(a), victor_i16x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_and(victor_i16x8 a, victor_i16x8 b) {
+        return victor_i16x8_from_native(_mm_and_si128(victor_i16x8_to_native(a), victor_i16x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_and_not(victor_i16x8 a, victor_i16x8 b) {
+        return victor_i16x8_from_native(_mm_andnot_si128(victor_i16x8_to_native(b), victor_i16x8_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_min(victor_i16x8 a, victor_i16x8 b) {
+        return victor_i16x8_from_native(_mm_min_epi16(victor_i16x8_to_native(a), victor_i16x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_max(victor_i16x8 a, victor_i16x8 b) {
+        return victor_i16x8_from_native(_mm_max_epi16(victor_i16x8_to_native(a), victor_i16x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_adds(victor_i16x8 a, victor_i16x8 b) {
+        return victor_i16x8_from_native(_mm_adds_epi16(victor_i16x8_to_native(a), victor_i16x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_subs(victor_i16x8 a, victor_i16x8 b) {
+        return victor_i16x8_from_native(_mm_subs_epi16(victor_i16x8_to_native(a), victor_i16x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_abs(victor_i16x8 a) {
+        return victor_i16x8_from_native(victor_x_mm_abs_epi16(victor_i16x8_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_set1(int16_t value) {
+        return victor_i16x8_from_native(_mm_set1_epi16(value));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_set(int16_t e0, int16_t e1, int16_t e2, int16_t e3, int16_t e4, int16_t e5, int16_t e6, int16_t e7) {
+        return victor_i16x8_from_native(_mm_setr_epi16(e0, e1, e2, e3, e4, e5, e6, e7));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_load(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) {
+        return victor_i16x8_from_native(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_load_aligned(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        return victor_i16x8_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_load_stream(const int16_t src[HEDLEY_ARRAY_PARAM(8)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_i16x8_from_native(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+        #else
+          return victor_i16x8_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_i16x8_store(int16_t dest[HEDLEY_ARRAY_PARAM(8)], victor_i16x8 src) {
+        _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i16x8_store_aligned(int16_t dest[HEDLEY_ARRAY_PARAM(8)], victor_i16x8 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i16x8_store_stream(int16_t dest[HEDLEY_ARRAY_PARAM(8)], victor_i16x8 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_load_partial(const int16_t src[], size_t count) {
+        return victor_i16x8_from_native(victor_x_mm_load_partial_si128(src, VICTOR_X_PARTIAL_COUNT(count, 8) * 2));
+      }
+
+      static VICTOR_INLINE void victor_i16x8_store_partial(int16_t dest[], size_t count, victor_i16x8 src) {
+        victor_x_mm_store_partial_si128(dest, VICTOR_X_PARTIAL_COUNT(count, 8) * 2, victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i16x8_to_i32x4(victor_i16x8 src) {
+        return victor_i32x4_from_native(victor_x_mm_cvtepi16_epi32(victor_i16x8_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i16x8_to_i32x4_high(victor_i16x8 src) {
+        return victor_i32x4_from_native(victor_x_mm_cvtepi16hi_epi32(victor_i16x8_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i16x8_narrow_i32x4(victor_i32x4 low, victor_i32x4 high) {
+        return victor_i16x8_from_native(_mm_packs_epi32(victor_i32x4_to_native(low), victor_i32x4_to_native(high)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i16x8_as_i8x16(victor_i16x8 src) {
+        return victor_i8x16_from_native(victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_i16x8_as_u8x16(victor_i16x8 src) {
+        return victor_u8x16_from_native(victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_i16x8_as_u16x8(victor_i16x8 src) {
+        return victor_u16x8_from_native(victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i16x8_as_i32x4(victor_i16x8 src) {
+        return victor_i32x4_from_native(victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_i16x8_as_u32x4(victor_i16x8 src) {
+        return victor_u32x4_from_native(victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i16x8_as_i64x2(victor_i16x8 src) {
+        return victor_i64x2_from_native(victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_i16x8_as_u64x2(victor_i16x8 src) {
+        return victor_u64x2_from_native(victor_i16x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_i16x8_as_f32x4(victor_i16x8 src) {
+        return victor_f32x4_from_native(_mm_castsi128_ps(victor_i16x8_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_i16x8_as_f64x2(victor_i16x8 src) {
+        return victor_f64x2_from_native(_mm_castsi128_pd(victor_i16x8_to_native(src)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_I16X8_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_SSE2) */
@@ -0,0 +1,318 @@
+/* i32x16.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX512F)
+  #if !defined(VICTOR_I32X16_H_FORWARD_DECLARE)
+    #define VICTOR_I32X16_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i32x16;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_I32X16_H_DECLARE)
+    #define VICTOR_I32X16_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i32x16 {
+          private:
+            __m512i n;
+
+          public:
+            VICTOR_INLINE i32x16(__m512i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m512i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x16(int32_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x16(int32_t  e0, int32_t  e1, int32_t  e2, int32_t  e3, int32_t  e4, int32_t  e5, int32_t  e6, int32_t  e7,
+                          int32_t  e8, int32_t  e9, int32_t e10, int32_t e11, int32_t e12, int32_t e13, int32_t e14, int32_t e15) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x16(i32x8 low, i32x8 high) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x16 operator+(i32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x16 operator&(i32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x16 and_not(i32x16 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x16 load(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x16 load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x16 load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(int32_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(int32_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(int32_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x16 load_partial(const int32_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(int32_t dest[], size_t count) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x16 gather(const int32_t base[], i32x16 indices) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x16 gather_masked(mask16 mask, const int32_t base[], i32x16 indices) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void scatter(int32_t base[], i32x16 indices) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE mask16 operator==(i32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator!=(i32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator<(i32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator<=(i32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator>(i32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator>=(i32x16 a) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i32x16 mask_add(i32x16 src, mask16 k, i32x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x16 maskz_add(mask16 k, i32x16 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x16 load_masked(mask16 k, const int32_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_masked(int32_t values[HEDLEY_ARRAY_PARAM(16)], mask16 k) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i32x8 low(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x8 high(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x16 to_f32x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x16 as_f32x16(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef int32_t victor_i32x16 __attribute__((__vector_size__(64),__aligned__(64)));
+
+        static VICTOR_INLINE victor_i32x16 victor_i32x16_from_native(__m512i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_i32x16, v);
+          #else
+            union {
+              __m512i from;
+              victor_i32x16 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m512i victor_i32x16_to_native(victor_i32x16 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m512i, v);
+          #else
+            union {
+              victor_i32x16 from;
+              __m512i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m512i victor_i32x16;
+        #define victor_i32x16_to_native(v) (v)
+        #define victor_i32x16_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_I32X16_H_DEFINE)
+    #define VICTOR_I32X16_H_DEFINE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE i32x16::i32x16(__m512i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m512i i32x16::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE i32x16::i32x16(int32_t value) VICTOR_NOEXCEPT :n(_mm512_set1_epi32(value)) { };
+        VICTOR_INLINE i32x16::i32x16(int32_t  e0, int32_t  e1, int32_t  e2, int32_t  e3, int32_t  e4, int32_t  e5, int32_t  e6, int32_t  e7,
+                              int32_t  e8, int32_t  e9, int32_t e10, int32_t e11, int32_t e12, int32_t e13, int32_t e14, int32_t e15) VICTOR_NOEXCEPT
+          :n(_mm512_setr_epi32(e0, e1,  e2,  e3,  e4,  e5,  e6,  e7,
+                               e8, e9, e10, e11, e12, e13, e14, e15)) { };
+        VICTOR_INLINE i32x16::i32x16(i32x8 low, i32x8 high) VICTOR_NOEXCEPT
+          :n(_mm512_inserti64x4(_mm512_castsi256_si512(low.to_native()), high.to_native(), 1)) { };
+        VICTOR_INLINE i32x16 i32x16::operator+(i32x16 a) const VICTOR_NOEXCEPT { return i32x16(_mm512_add_epi32(n, a.to_native())); };
+        VICTOR_INLINE i32x16 i32x16::operator&(i32x16 a) const VICTOR_NOEXCEPT { return i32x16(_mm512_and_si512(n, a.to_native())); };
+        VICTOR_INLINE i32x16 i32x16::and_not(i32x16 a) const VICTOR_NOEXCEPT { return i32x16(_mm512_andnot_si512(a.to_native(), n)); };
+        VICTOR_INLINE i32x16 i32x16::load(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT { return i32x16(_mm512_loadu_si512(src)); }
+        VICTOR_INLINE i32x16 i32x16::load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 64);
+          return i32x16(_mm512_load_si512(src));
+        }
+        VICTOR_INLINE i32x16 i32x16::load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 64);
+          return i32x16(_mm512_stream_load_si512(HEDLEY_CONST_CAST(int32_t*, src)));
+        }
+        VICTOR_INLINE void i32x16::store(int32_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT { _mm512_storeu_si512(dest, n); }
+        VICTOR_INLINE void i32x16::store_aligned(int32_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 64);
+          _mm512_store_si512(dest, n);
+        }
+        VICTOR_INLINE void i32x16::store_stream(int32_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 64);
+          _mm512_stream_si512(HEDLEY_REINTERPRET_CAST(__m512i*, dest), n);
+        }
+        VICTOR_INLINE i32x16 i32x16::load_partial(const int32_t src[], size_t count) VICTOR_NOEXCEPT { return i32x16(_mm512_maskz_loadu_epi32(HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - VICTOR_X_PARTIAL_COUNT(count, 16))), src)); }
+        VICTOR_INLINE void i32x16::store_partial(int32_t dest[], size_t count) const VICTOR_NOEXCEPT { _mm512_mask_storeu_epi32(dest, HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - VICTOR_X_PARTIAL_COUNT(count, 16))), n); }
+        VICTOR_INLINE i32x16 i32x16::gather(const int32_t base[], i32x16 indices) VICTOR_NOEXCEPT { return i32x16(_mm512_i32gather_epi32(indices.to_native(), base, 4)); }
+        VICTOR_INLINE i32x16 i32x16::gather_masked(mask16 mask, const int32_t base[], i32x16 indices) VICTOR_NOEXCEPT { return i32x16(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask.to_native(), indices.to_native(), base, 4)); }
+        VICTOR_INLINE void i32x16::scatter(int32_t base[], i32x16 indices) const VICTOR_NOEXCEPT { _mm512_i32scatter_epi32(base, indices.to_native(), n, 4); }
+
+        VICTOR_INLINE mask16 i32x16::operator==(i32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmpeq_epi32_mask(n, a.to_native())); }
+        VICTOR_INLINE mask16 i32x16::operator!=(i32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmpneq_epi32_mask(n, a.to_native())); }
+        VICTOR_INLINE mask16 i32x16::operator<(i32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmplt_epi32_mask(n, a.to_native())); }
+        VICTOR_INLINE mask16 i32x16::operator<=(i32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmple_epi32_mask(n, a.to_native())); }
+        VICTOR_INLINE mask16 i32x16::operator>(i32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmpgt_epi32_mask(n, a.to_native())); }
+        VICTOR_INLINE mask16 i32x16::operator>=(i32x16 a) const VICTOR_NOEXCEPT { return mask16(_mm512_cmpge_epi32_mask(n, a.to_native())); }
+
+        VICTOR_INLINE i32x16 i32x16::mask_add(i32x16 src, mask16 k, i32x16 a) const VICTOR_NOEXCEPT { return i32x16(_mm512_mask_add_epi32(src.to_native(), k.to_native(), n, a.to_native())); }
+        VICTOR_INLINE i32x16 i32x16::maskz_add(mask16 k, i32x16 a) const VICTOR_NOEXCEPT { return i32x16(_mm512_maskz_add_epi32(k.to_native(), n, a.to_native())); }
+        VICTOR_INLINE i32x16 i32x16::load_masked(mask16 k, const int32_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT { return i32x16(_mm512_maskz_loadu_epi32(k.to_native(), src)); }
+        VICTOR_INLINE void i32x16::store_masked(int32_t dest[HEDLEY_ARRAY_PARAM(16)], mask16 k) const VICTOR_NOEXCEPT { _mm512_mask_storeu_epi32(dest, k.to_native(), n); }
+
+        VICTOR_INLINE i32x8 i32x16::low(void) const VICTOR_NOEXCEPT { return i32x8(_mm512_castsi512_si256(n)); };
+        VICTOR_INLINE i32x8 i32x16::high(void) const VICTOR_NOEXCEPT { return i32x8(_mm512_extracti64x4_epi64(n, 1)); };
+
+        VICTOR_INLINE f32x16 i32x16::to_f32x16(void) const VICTOR_NOEXCEPT { return f32x16(_mm512_cvtepi32_ps(n)); };
+        VICTOR_INLINE f32x16 i32x16::as_f32x16(void) const VICTOR_NOEXCEPT { return f32x16(_mm512_castsi512_ps(n)); };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_add(victor_i32x16 a, victor_i32x16 b) {
+        return victor_i32x16_from_native(_mm512_add_epi32(victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_and(victor_i32x16 a, victor_i32x16 b) {
+        return victor_i32x16_from_native(_mm512_and_si512(victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_and_not(victor_i32x16 a, victor_i32x16 b) {
+        return victor_i32x16_from_native(_mm512_andnot_si512(victor_i32x16_to_native(b), victor_i32x16_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_set1(int32_t value) {
+        return victor_i32x16_from_native(_mm512_set1_epi32(value));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_set(int32_t  e0, int32_t  e1, int32_t  e2, int32_t  e3, int32_t  e4, int32_t  e5, int32_t  e6, int32_t  e7,
+                                                    int32_t  e8, int32_t  e9, int32_t e10, int32_t e11, int32_t e12, int32_t e13, int32_t e14, int32_t e15) {
+        return victor_i32x16_from_native(_mm512_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_load(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        return victor_i32x16_from_native(_mm512_loadu_si512(src));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        VICTOR_ASSERT_ALIGNED(src, 64);
+        return victor_i32x16_from_native(_mm512_load_si512(src));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        VICTOR_ASSERT_ALIGNED(src, 64);
+        return victor_i32x16_from_native(_mm512_stream_load_si512(HEDLEY_CONST_CAST(int32_t*, src)));
+      }
+
+      static VICTOR_INLINE void victor_i32x16_store(int32_t dest[HEDLEY_ARRAY_PARAM(16)], victor_i32x16 src) {
+        _mm512_storeu_si512(dest, victor_i32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i32x16_store_aligned(int32_t dest[HEDLEY_ARRAY_PARAM(16)], victor_i32x16 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 64);
+        _mm512_store_si512(dest, victor_i32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i32x16_store_stream(int32_t dest[HEDLEY_ARRAY_PARAM(16)], victor_i32x16 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 64);
+        _mm512_stream_si512(HEDLEY_REINTERPRET_CAST(__m512i*, dest), victor_i32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_load_partial(const int32_t src[], size_t count) {
+        return victor_i32x16_from_native(_mm512_maskz_loadu_epi32(HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - VICTOR_X_PARTIAL_COUNT(count, 16))), src));
+      }
+
+      static VICTOR_INLINE void victor_i32x16_store_partial(int32_t dest[], size_t count, victor_i32x16 src) {
+        _mm512_mask_storeu_epi32(dest, HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - VICTOR_X_PARTIAL_COUNT(count, 16))), victor_i32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_gather(const int32_t base[], victor_i32x16 indices) {
+        return victor_i32x16_from_native(_mm512_i32gather_epi32(victor_i32x16_to_native(indices), base, 4));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_gather_masked(victor_mask16 mask, const int32_t base[], victor_i32x16 indices) {
+        return victor_i32x16_from_native(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), victor_mask16_to_native(mask), victor_i32x16_to_native(indices), base, 4));
+      }
+
+      static VICTOR_INLINE void victor_i32x16_scatter(int32_t base[], victor_i32x16 indices, victor_i32x16 src) {
+        _mm512_i32scatter_epi32(base, victor_i32x16_to_native(indices), victor_i32x16_to_native(src), 4);
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_i32x16_cmpeq(victor_i32x16 a, victor_i32x16 b) {
+        return victor_mask16_from_native(_mm512_cmpeq_epi32_mask(victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_i32x16_cmpne(victor_i32x16 a, victor_i32x16 b) {
+        return victor_mask16_from_native(_mm512_cmpneq_epi32_mask(victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_i32x16_cmplt(victor_i32x16 a, victor_i32x16 b) {
+        return victor_mask16_from_native(_mm512_cmplt_epi32_mask(victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_i32x16_cmple(victor_i32x16 a, victor_i32x16 b) {
+        return victor_mask16_from_native(_mm512_cmple_epi32_mask(victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_i32x16_cmpgt(victor_i32x16 a, victor_i32x16 b) {
+        return victor_mask16_from_native(_mm512_cmpgt_epi32_mask(victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_i32x16_cmpge(victor_i32x16 a, victor_i32x16 b) {
+        return victor_mask16_from_native(_mm512_cmpge_epi32_mask(victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_mask_add(victor_i32x16 src, victor_mask16 k, victor_i32x16 a, victor_i32x16 b) {
+        return victor_i32x16_from_native(_mm512_mask_add_epi32(victor_i32x16_to_native(src), victor_mask16_to_native(k), victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_maskz_add(victor_mask16 k, victor_i32x16 a, victor_i32x16 b) {
+        return victor_i32x16_from_native(_mm512_maskz_add_epi32(victor_mask16_to_native(k), victor_i32x16_to_native(a), victor_i32x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_load_masked(victor_mask16 k, const int32_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        return victor_i32x16_from_native(_mm512_maskz_loadu_epi32(victor_mask16_to_native(k), src));
+      }
+
+      static VICTOR_INLINE void victor_i32x16_store_masked(int32_t dest[HEDLEY_ARRAY_PARAM(16)], victor_mask16 k, victor_i32x16 src) {
+        _mm512_mask_storeu_epi32(dest, victor_mask16_to_native(k), victor_i32x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x16 victor_i32x16_join(victor_i32x8 low, victor_i32x8 high) {
+        return victor_i32x16_from_native(_mm512_inserti64x4(_mm512_castsi256_si512(victor_i32x8_to_native(low)), victor_i32x8_to_native(high), 1));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x16_low(victor_i32x16 src) {
+        return victor_i32x8_from_native(_mm512_castsi512_si256(victor_i32x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x16_high(victor_i32x16 src) {
+        return victor_i32x8_from_native(_mm512_extracti64x4_epi64(victor_i32x16_to_native(src), 1));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_i32x16_to_f32x16(victor_i32x16 src) {
+        return victor_f32x16_from_native(_mm512_cvtepi32_ps(victor_i32x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_i32x16_as_f32x16(victor_i32x16 src) {
+        return victor_f32x16_from_native(_mm512_castsi512_ps(victor_i32x16_to_native(src)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_I32X16_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX512F) */
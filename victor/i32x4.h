@@ -31,55 +31,120 @@
     #define VICTOR_I32X4_H_FORWARD_DECLARE
 
     #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
+      VICTOR_X_BEGIN_NAMESPACE
         class i32x4;
-      }
+      VICTOR_X_END_NAMESPACE
     #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
   #elif !defined(VICTOR_I32X4_H_DECLARE)
     #define VICTOR_I32X4_H_DECLARE
 
     #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
+      VICTOR_X_BEGIN_NAMESPACE
         class i32x4 {
           private:
             __m128i n;
 
           public:
-            inline i32x4(__m128i value);
-            inline __m128i to_native(void);
-            inline i32x4(int32_t value);
-            inline i32x4(int32_t e0, int32_t e1, int32_t e2, int32_t e3);
-            inline i32x4 operator+(i32x4 a);
-            inline i32x4 operator&(i32x4 a);
-            inline i32x4 and_not(i32x4 a);
-            inline void store(int32_t values[HEDLEY_ARRAY_PARAM(4)]);
-
-            inline f32x4 to_f32x4(void);
-            inline f32x4 as_f32x4(void);
+            VICTOR_INLINE i32x4(__m128i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 to_i64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 to_i64x2_high(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4(int32_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4(int32_t e0, int32_t e1, int32_t e2, int32_t e3) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator+(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator&(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 and_not(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator-(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator*(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator|(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator^(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator~(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator<<(int count) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator>>(int count) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator<<(i32x4 counts) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 operator>>(i32x4 counts) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i32x4& operator+=(i32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator-=(i32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator*=(i32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator&=(i32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator|=(i32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator^=(i32x4 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator<<=(int count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator>>=(int count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator<<=(i32x4 counts) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4& operator>>=(i32x4 counts) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE int32_t reduce_add(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int32_t reduce_mul(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int32_t reduce_min(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int32_t reduce_max(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int32_t reduce_and(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int32_t reduce_or(void) const VICTOR_NOEXCEPT;
+
+            static VICTOR_INLINE i32x4 load(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x4 load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x4 load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(int32_t values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(int32_t values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(int32_t values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x4 load_partial(const int32_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(int32_t dest[], size_t count) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x4 gather(const int32_t base[], i32x4 indices) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x4 gather_masked(mask32x4 mask, const int32_t base[], i32x4 indices) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void scatter(int32_t base[], i32x4 indices) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x4 to_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 as_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 as_f64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 as_i8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 as_u8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 as_i16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 as_u16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 as_u32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 as_i64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 as_u64x2(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE mask32x4 operator==(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 operator!=(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 operator<(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 operator<=(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 operator>(i32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 operator>=(i32x4 a) const VICTOR_NOEXCEPT;
         };
-      }
+
+        VICTOR_INLINE i32x4 select(mask32x4 mask, i32x4 a, i32x4 b) VICTOR_NOEXCEPT;
+      VICTOR_X_END_NAMESPACE
     #endif /* defined(VICTOR_ENABLE_CXX_API) */
 
     #if defined(VICTOR_ENABLE_C_API)
       #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
         typedef int32_t victor_i32x4 __attribute__((__vector_size__(16),__aligned__(16)));
 
-        static inline victor_i32x4 victor_i32x4_from_native(__m128i v) {
-          union {
-            __m128i from;
-            victor_i32x4 to;
-          } u;
-          u.from = v;
-          return u.to;
+        static VICTOR_INLINE victor_i32x4 victor_i32x4_from_native(__m128i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_i32x4, v);
+          #else
+            union {
+              __m128i from;
+              victor_i32x4 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
         }
 
-        static inline __m128i victor_i32x4_to_native(victor_i32x4 v) {
-          union {
-            victor_i32x4 from;
-            __m128i to;
-          } u;
-          u.from = v;
-          return u.to;
+        static VICTOR_INLINE __m128i victor_i32x4_to_native(victor_i32x4 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m128i, v);
+          #else
+            union {
+              victor_i32x4 from;
+              __m128i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
         }
       #else
         typedef __m128i victor_i32x4;
@@ -91,54 +156,520 @@
   #elif !defined(VICTOR_I32X4_H_DEFINE)
     #define VICTOR_I32X4_H_DEFINE
 
-    #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
-        inline i32x4::i32x4(__m128i value) :n(value) { };
-        inline __m128i i32x4::to_native() { return n; }
-        inline i32x4::i32x4(int32_t value) :n(_mm_set1_epi32(value)) { };
-        inline i32x4::i32x4(int32_t e0, int32_t e1, int32_t e2, int32_t e3) :n(_mm_setr_epi32(e0, e1, e2, e3)) { };
-        inline i32x4 i32x4::operator+(i32x4 a) { return i32x4(_mm_add_epi32(n, a.to_native())); };
-        inline i32x4 i32x4::operator&(i32x4 a) { return i32x4(_mm_and_si128(n, a.to_native())); };
-        inline i32x4 i32x4::and_not(i32x4 a) { return i32x4(_mm_andnot_si128(n, a.to_native())); };
-        inline void i32x4::store(int32_t dest[HEDLEY_ARRAY_PARAM(4)]) { _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n); }
-
-        inline f32x4 i32x4::to_f32x4(void) { return f32x4(_mm_cvtepi32_ps(n)); };
-        inline f32x4 i32x4::as_f32x4(void) { return f32x4(_mm_castsi128_ps(n)); };
+    /* Partial loads and stores of the first n lanes; see
+       victor_x_mm_load_partial_si128.  AVX has masked moves for 32-bit
+       lanes (vmaskmovps; the integer version needs AVX2, but the data
+       is the same). */
+    static VICTOR_INLINE __m128i victor_x_mm_load_partial_epi32(const void* src, size_t n) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        return _mm_maskz_loadu_epi32(HEDLEY_STATIC_CAST(__mmask8, 0xFu >> (4 - n)), src);
+      #elif defined(VICTOR_ENABLE_AVX)
+        const __m128i mask = _mm_cmpgt_epi32(_mm_set1_epi32(HEDLEY_STATIC_CAST(int, n)), _mm_setr_epi32(0, 1, 2, 3));
+        return _mm_castps_si128(_mm_maskload_ps(HEDLEY_STATIC_CAST(const float*, src), mask));
+      #else
+        return victor_x_mm_load_partial_si128(src, n * 4);
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm_store_partial_epi32(void* dest, size_t n, __m128i v) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        _mm_mask_storeu_epi32(dest, HEDLEY_STATIC_CAST(__mmask8, 0xFu >> (4 - n)), v);
+      #elif defined(VICTOR_ENABLE_AVX)
+        const __m128i mask = _mm_cmpgt_epi32(_mm_set1_epi32(HEDLEY_STATIC_CAST(int, n)), _mm_setr_epi32(0, 1, 2, 3));
+        _mm_maskstore_ps(HEDLEY_STATIC_CAST(float*, dest), mask, _mm_castsi128_ps(v));
+      #else
+        victor_x_mm_store_partial_si128(dest, n * 4, v);
+      #endif
+    }
+
+    /* Gather and scatter with 32-bit element indices.  Below AVX2 we
+       pull the indices out one at a time (pextrd, or pshufd + movd on
+       SSE2) and let the compiler build the result with pinsrd.  The
+       masked gather never touches memory for inactive lanes, and the
+       emulated scatter writes the lanes in order so that, like
+       vpscatterdd, the highest lane wins when indices repeat. */
+    #if defined(VICTOR_ENABLE_SSE4_1)
+      #define victor_x_mm_extract_epi32(a, imm) _mm_extract_epi32((a), (imm))
+    #else
+      #define victor_x_mm_extract_epi32(a, imm) _mm_cvtsi128_si32(_mm_shuffle_epi32((a), (imm)))
+    #endif
+
+    static VICTOR_INLINE __m128i victor_x_mm_i32gather_epi32(const int32_t* base, __m128i vindex) {
+      #if defined(VICTOR_ENABLE_AVX2)
+        return _mm_i32gather_epi32(HEDLEY_REINTERPRET_CAST(const int*, base), vindex, 4);
+      #else
+        return _mm_setr_epi32(
+          base[_mm_cvtsi128_si32(vindex)],
+          base[victor_x_mm_extract_epi32(vindex, 1)],
+          base[victor_x_mm_extract_epi32(vindex, 2)],
+          base[victor_x_mm_extract_epi32(vindex, 3)]);
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_maskz_i32gather_epi32(__m128i mask, const int32_t* base, __m128i vindex) {
+      #if defined(VICTOR_ENABLE_AVX2)
+        return _mm_mask_i32gather_epi32(_mm_setzero_si128(), HEDLEY_REINTERPRET_CAST(const int*, base), vindex, mask, 4);
+      #else
+        const int m = _mm_movemask_ps(_mm_castsi128_ps(mask));
+        return _mm_setr_epi32(
+          (m & 1) ? base[_mm_cvtsi128_si32(vindex)] : 0,
+          (m & 2) ? base[victor_x_mm_extract_epi32(vindex, 1)] : 0,
+          (m & 4) ? base[victor_x_mm_extract_epi32(vindex, 2)] : 0,
+          (m & 8) ? base[victor_x_mm_extract_epi32(vindex, 3)] : 0);
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm_i32scatter_epi32(int32_t* base, __m128i vindex, __m128i v) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        _mm_i32scatter_epi32(base, vindex, v, 4);
+      #else
+        base[_mm_cvtsi128_si32(vindex)] = _mm_cvtsi128_si32(v);
+        base[victor_x_mm_extract_epi32(vindex, 1)] = victor_x_mm_extract_epi32(v, 1);
+        base[victor_x_mm_extract_epi32(vindex, 2)] = victor_x_mm_extract_epi32(v, 2);
+        base[victor_x_mm_extract_epi32(vindex, 3)] = victor_x_mm_extract_epi32(v, 3);
+      #endif
+    }
+
+    /* The low 32 bits of each product.  SSE2 only has a widening
+       unsigned multiply of the even lanes, so do the even and odd lanes
+       separately and interleave the low halves. */
+    static VICTOR_INLINE __m128i victor_x_mm_mullo_epi32(__m128i a, __m128i b) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_mullo_epi32(a, b);
+      #else
+        const __m128i even = _mm_mul_epu32(a, b);
+        const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                  _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+      #endif
+    }
+
+    /* The full 64-bit products of the even lanes, like pmuldq.  The
+       unsigned product is off by b << 32 when a is negative (and vice
+       versa), which we subtract back out. */
+    static VICTOR_INLINE __m128i victor_x_mm_mul_epi32(__m128i a, __m128i b) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_mul_epi32(a, b);
+      #else
+        const __m128i fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+        return _mm_sub_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(fix, 32));
+      #endif
+    }
+
+    /* Per-lane shifts need AVX2.  Otherwise we shift the whole vector
+       by each lane's count and pick out the lane we want from each.
+       Like vpsllvd and vpsravd, counts which are out of range shift
+       in zeros (or sign bits, for the arithmetic shift). */
+    #if !defined(VICTOR_ENABLE_AVX2)
+      static VICTOR_INLINE __m128i victor_x_mm_select_diagonal_epi32(__m128i r0, __m128i r1, __m128i r2, __m128i r3) {
+        const __m128 r01 = _mm_shuffle_ps(_mm_castsi128_ps(r0), _mm_castsi128_ps(r1), _MM_SHUFFLE(1, 1, 0, 0));
+        const __m128 r23 = _mm_shuffle_ps(_mm_castsi128_ps(r2), _mm_castsi128_ps(r3), _MM_SHUFFLE(3, 3, 2, 2));
+        return _mm_castps_si128(_mm_shuffle_ps(r01, r23, _MM_SHUFFLE(2, 0, 2, 0)));
       }
+    #endif
+
+    static VICTOR_INLINE __m128i victor_x_mm_sllv_epi32(__m128i a, __m128i counts) {
+      #if defined(VICTOR_ENABLE_AVX2)
+        return _mm_sllv_epi32(a, counts);
+      #else
+        const __m128i lo = _mm_unpacklo_epi32(counts, _mm_setzero_si128());
+        const __m128i hi = _mm_unpackhi_epi32(counts, _mm_setzero_si128());
+        return victor_x_mm_select_diagonal_epi32(
+          _mm_sll_epi32(a, lo), _mm_sll_epi32(a, _mm_srli_si128(lo, 8)),
+          _mm_sll_epi32(a, hi), _mm_sll_epi32(a, _mm_srli_si128(hi, 8)));
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_srav_epi32(__m128i a, __m128i counts) {
+      #if defined(VICTOR_ENABLE_AVX2)
+        return _mm_srav_epi32(a, counts);
+      #else
+        const __m128i lo = _mm_unpacklo_epi32(counts, _mm_setzero_si128());
+        const __m128i hi = _mm_unpackhi_epi32(counts, _mm_setzero_si128());
+        return victor_x_mm_select_diagonal_epi32(
+          _mm_sra_epi32(a, lo), _mm_sra_epi32(a, _mm_srli_si128(lo, 8)),
+          _mm_sra_epi32(a, hi), _mm_sra_epi32(a, _mm_srli_si128(hi, 8)));
+      #endif
+    }
+
+    #if !defined(victor_x_mm_not_si128)
+      /* andnot(a, ~0) rather than xor(a, ~0): GCC folds the latter
+         into an operation on the C API's vector type and adds a
+         register copy. */
+      #define victor_x_mm_not_si128(a) \
+        _mm_andnot_si128((a), _mm_set1_epi32(-1))
+    #endif
+
+    static VICTOR_INLINE __m128i victor_x_mm_min_epi32(__m128i a, __m128i b) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_min_epi32(a, b);
+      #else
+        const __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_max_epi32(__m128i a, __m128i b) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_max_epi32(a, b);
+      #else
+        const __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+      #endif
+    }
+
+    /* Horizontal reductions.  phaddd (SSSE3) is 3 uops, so halving the
+       vector twice with shuffles is faster even when it's available. */
+    static VICTOR_INLINE int32_t victor_x_mm_reduce_add_epi32(__m128i v) {
+      v = _mm_add_epi32(v, _mm_unpackhi_epi64(v, v));
+      return _mm_cvtsi128_si32(_mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    static VICTOR_INLINE int32_t victor_x_mm_reduce_mul_epi32(__m128i v) {
+      v = victor_x_mm_mullo_epi32(v, _mm_unpackhi_epi64(v, v));
+      return _mm_cvtsi128_si32(victor_x_mm_mullo_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    static VICTOR_INLINE int32_t victor_x_mm_reduce_min_epi32(__m128i v) {
+      v = victor_x_mm_min_epi32(v, _mm_unpackhi_epi64(v, v));
+      return _mm_cvtsi128_si32(victor_x_mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    static VICTOR_INLINE int32_t victor_x_mm_reduce_max_epi32(__m128i v) {
+      v = victor_x_mm_max_epi32(v, _mm_unpackhi_epi64(v, v));
+      return _mm_cvtsi128_si32(victor_x_mm_max_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    static VICTOR_INLINE int32_t victor_x_mm_reduce_and_epi32(__m128i v) {
+      v = _mm_and_si128(v, _mm_unpackhi_epi64(v, v));
+      return _mm_cvtsi128_si32(_mm_and_si128(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    static VICTOR_INLINE int32_t victor_x_mm_reduce_or_epi32(__m128i v) {
+      v = _mm_or_si128(v, _mm_unpackhi_epi64(v, v));
+      return _mm_cvtsi128_si32(_mm_or_si128(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    /* SSE2 has no 64-bit arithmetic shift, but srai by 31 gives us the
+       upper halves directly. */
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepi32_epi64(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_cvtepi32_epi64(a);
+      #else
+        return _mm_unpacklo_epi32(a, _mm_srai_epi32(a, 31));
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepi32hi_epi64(__m128i a) {
+      return _mm_unpackhi_epi32(a, _mm_srai_epi32(a, 31));
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE i32x4::i32x4(__m128i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128i i32x4::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE i32x4::i32x4(int32_t value) VICTOR_NOEXCEPT :n(_mm_set1_epi32(value)) { };
+        VICTOR_INLINE i32x4::i32x4(int32_t e0, int32_t e1, int32_t e2, int32_t e3) VICTOR_NOEXCEPT :n(_mm_setr_epi32(e0, e1, e2, e3)) { };
+        VICTOR_INLINE i32x4 i32x4::operator+(i32x4 a) const VICTOR_NOEXCEPT { return i32x4(_mm_add_epi32(n, a.to_native())); };
+        VICTOR_INLINE i32x4 i32x4::operator&(i32x4 a) const VICTOR_NOEXCEPT { return i32x4(_mm_and_si128(n, a.to_native())); };
+        VICTOR_INLINE i32x4 i32x4::and_not(i32x4 a) const VICTOR_NOEXCEPT { return i32x4(_mm_andnot_si128(a.to_native(), n)); };
+        VICTOR_INLINE i32x4 i32x4::operator-(i32x4 a) const VICTOR_NOEXCEPT { return i32x4(_mm_sub_epi32(n, a.to_native())); };
+        VICTOR_INLINE i32x4 i32x4::operator*(i32x4 a) const VICTOR_NOEXCEPT { return i32x4(victor_x_mm_mullo_epi32(n, a.to_native())); };
+        VICTOR_INLINE i32x4 i32x4::operator|(i32x4 a) const VICTOR_NOEXCEPT { return i32x4(_mm_or_si128(n, a.to_native())); };
+        VICTOR_INLINE i32x4 i32x4::operator^(i32x4 a) const VICTOR_NOEXCEPT { return i32x4(_mm_xor_si128(n, a.to_native())); };
+        VICTOR_INLINE i32x4 i32x4::operator~(void) const VICTOR_NOEXCEPT { return i32x4(victor_x_mm_not_si128(n)); };
+        VICTOR_INLINE i32x4 i32x4::operator<<(int count) const VICTOR_NOEXCEPT { return i32x4(_mm_slli_epi32(n, count)); };
+        VICTOR_INLINE i32x4 i32x4::operator>>(int count) const VICTOR_NOEXCEPT { return i32x4(_mm_srai_epi32(n, count)); };
+        VICTOR_INLINE i32x4 i32x4::operator<<(i32x4 counts) const VICTOR_NOEXCEPT { return i32x4(victor_x_mm_sllv_epi32(n, counts.to_native())); };
+        VICTOR_INLINE i32x4 i32x4::operator>>(i32x4 counts) const VICTOR_NOEXCEPT { return i32x4(victor_x_mm_srav_epi32(n, counts.to_native())); };
+        VICTOR_INLINE i32x4& i32x4::operator+=(i32x4 a) VICTOR_NOEXCEPT { return *this = *this + a; };
+        VICTOR_INLINE i32x4& i32x4::operator-=(i32x4 a) VICTOR_NOEXCEPT { return *this = *this - a; };
+        VICTOR_INLINE i32x4& i32x4::operator*=(i32x4 a) VICTOR_NOEXCEPT { return *this = *this * a; };
+        VICTOR_INLINE i32x4& i32x4::operator&=(i32x4 a) VICTOR_NOEXCEPT { return *this = *this & a; };
+        VICTOR_INLINE i32x4& i32x4::operator|=(i32x4 a) VICTOR_NOEXCEPT { return *this = *this | a; };
+        VICTOR_INLINE i32x4& i32x4::operator^=(i32x4 a) VICTOR_NOEXCEPT { return *this = *this ^ a; };
+        VICTOR_INLINE i32x4& i32x4::operator<<=(int count) VICTOR_NOEXCEPT { return *this = *this << count; };
+        VICTOR_INLINE i32x4& i32x4::operator>>=(int count) VICTOR_NOEXCEPT { return *this = *this >> count; };
+        VICTOR_INLINE i32x4& i32x4::operator<<=(i32x4 counts) VICTOR_NOEXCEPT { return *this = *this << counts; };
+        VICTOR_INLINE i32x4& i32x4::operator>>=(i32x4 counts) VICTOR_NOEXCEPT { return *this = *this >> counts; };
+        VICTOR_INLINE int32_t i32x4::reduce_add(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_add_epi32(n); }
+        VICTOR_INLINE int32_t i32x4::reduce_mul(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_mul_epi32(n); }
+        VICTOR_INLINE int32_t i32x4::reduce_min(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_min_epi32(n); }
+        VICTOR_INLINE int32_t i32x4::reduce_max(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_max_epi32(n); }
+        VICTOR_INLINE int32_t i32x4::reduce_and(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_and_epi32(n); }
+        VICTOR_INLINE int32_t i32x4::reduce_or(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_or_epi32(n); }
+        VICTOR_INLINE i32x4 i32x4::load(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT { return i32x4(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src))); }
+        VICTOR_INLINE i32x4 i32x4::load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          return i32x4(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        }
+        VICTOR_INLINE i32x4 i32x4::load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return i32x4(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+          #else
+            return i32x4(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+          #endif
+        }
+        VICTOR_INLINE void i32x4::store(int32_t dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT { _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n); }
+        VICTOR_INLINE void i32x4::store_aligned(int32_t dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE void i32x4::store_stream(int32_t dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE i32x4 i32x4::load_partial(const int32_t src[], size_t count) VICTOR_NOEXCEPT { return i32x4(victor_x_mm_load_partial_epi32(src, VICTOR_X_PARTIAL_COUNT(count, 4))); }
+        VICTOR_INLINE void i32x4::store_partial(int32_t dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm_store_partial_epi32(dest, VICTOR_X_PARTIAL_COUNT(count, 4), n); }
+        VICTOR_INLINE i32x4 i32x4::gather(const int32_t base[], i32x4 indices) VICTOR_NOEXCEPT { return i32x4(victor_x_mm_i32gather_epi32(base, indices.to_native())); }
+        VICTOR_INLINE i32x4 i32x4::gather_masked(mask32x4 mask, const int32_t base[], i32x4 indices) VICTOR_NOEXCEPT { return i32x4(victor_x_mm_maskz_i32gather_epi32(mask.to_native(), base, indices.to_native())); }
+        VICTOR_INLINE void i32x4::scatter(int32_t base[], i32x4 indices) const VICTOR_NOEXCEPT { victor_x_mm_i32scatter_epi32(base, indices.to_native(), n); }
+
+        VICTOR_INLINE i64x2 i32x4::to_i64x2(void) const VICTOR_NOEXCEPT { return i64x2(victor_x_mm_cvtepi32_epi64(n)); };
+        VICTOR_INLINE i64x2 i32x4::to_i64x2_high(void) const VICTOR_NOEXCEPT { return i64x2(victor_x_mm_cvtepi32hi_epi64(n)); };
+        VICTOR_INLINE f32x4 i32x4::to_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_cvtepi32_ps(n)); };
+        VICTOR_INLINE f32x4 i32x4::as_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_castsi128_ps(n)); };
+        VICTOR_INLINE f64x2 i32x4::as_f64x2(void) const VICTOR_NOEXCEPT { return f64x2(_mm_castsi128_pd(n)); };
+        VICTOR_INLINE i8x16 i32x4::as_i8x16(void) const VICTOR_NOEXCEPT { return i8x16(n); };
+        VICTOR_INLINE u8x16 i32x4::as_u8x16(void) const VICTOR_NOEXCEPT { return u8x16(n); };
+        VICTOR_INLINE i16x8 i32x4::as_i16x8(void) const VICTOR_NOEXCEPT { return i16x8(n); };
+        VICTOR_INLINE u16x8 i32x4::as_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(n); };
+        VICTOR_INLINE u32x4 i32x4::as_u32x4(void) const VICTOR_NOEXCEPT { return u32x4(n); };
+        VICTOR_INLINE i64x2 i32x4::as_i64x2(void) const VICTOR_NOEXCEPT { return i64x2(n); };
+        VICTOR_INLINE u64x2 i32x4::as_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(n); };
+
+        VICTOR_INLINE mask32x4 i32x4::operator==(i32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_cmpeq_epi32(n, a.to_native())); }
+        VICTOR_INLINE mask32x4 i32x4::operator!=(i32x4 a) const VICTOR_NOEXCEPT { return ~(*this == a); }
+        VICTOR_INLINE mask32x4 i32x4::operator<(i32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_cmplt_epi32(n, a.to_native())); }
+        VICTOR_INLINE mask32x4 i32x4::operator<=(i32x4 a) const VICTOR_NOEXCEPT { return ~(*this > a); }
+        VICTOR_INLINE mask32x4 i32x4::operator>(i32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_cmpgt_epi32(n, a.to_native())); }
+        VICTOR_INLINE mask32x4 i32x4::operator>=(i32x4 a) const VICTOR_NOEXCEPT { return ~(*this < a); }
+
+        VICTOR_INLINE i32x4 select(mask32x4 mask, i32x4 a, i32x4 b) VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return i32x4(_mm_blendv_epi8(b.to_native(), a.to_native(), mask.to_native()));
+          #else
+            const i32x4 m(mask.to_native());
+            return (a & m) | b.and_not(m);
+          #endif
+        }
+      VICTOR_X_END_NAMESPACE
     #endif /* defined(VICTOR_ENABLE_CXX_API) */
 
     #if defined(VICTOR_ENABLE_C_API)
-      static inline victor_i32x4 victor_i32x4_add(victor_i32x4 a, victor_i32x4 b) {
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_add(victor_i32x4 a, victor_i32x4 b) {
         return victor_i32x4_from_native(_mm_add_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
       }
 
-      static inline victor_i32x4 victor_i32x4_and(victor_i32x4 a, victor_i32x4 b) {
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_and(victor_i32x4 a, victor_i32x4 b) {
         return victor_i32x4_from_native(_mm_and_si128(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
       }
 
-      static inline victor_i32x4 victor_i32x4_andnot(victor_i32x4 a, victor_i32x4 b) {
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_and_not(victor_i32x4 a, victor_i32x4 b) {
         return victor_i32x4_from_native(_mm_andnot_si128(victor_i32x4_to_native(b), victor_i32x4_to_native(a)));
       }
 
-      static inline victor_i32x4 victor_i32x4_set1(int32_t value) {
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_sub(victor_i32x4 a, victor_i32x4 b) {
+        return victor_i32x4_from_native(_mm_sub_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_mul(victor_i32x4 a, victor_i32x4 b) {
+        return victor_i32x4_from_native(victor_x_mm_mullo_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_or(victor_i32x4 a, victor_i32x4 b) {
+        return victor_i32x4_from_native(_mm_or_si128(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_xor(victor_i32x4 a, victor_i32x4 b) {
+        return victor_i32x4_from_native(_mm_xor_si128(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_not(victor_i32x4 a) {
+        return victor_i32x4_from_native(victor_x_mm_not_si128(victor_i32x4_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_shl(victor_i32x4 a, int count) {
+        return victor_i32x4_from_native(_mm_slli_epi32(victor_i32x4_to_native(a), count));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_shr(victor_i32x4 a, int count) {
+        return victor_i32x4_from_native(_mm_srai_epi32(victor_i32x4_to_native(a), count));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_shlv(victor_i32x4 a, victor_i32x4 counts) {
+        return victor_i32x4_from_native(victor_x_mm_sllv_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(counts)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_shrv(victor_i32x4 a, victor_i32x4 counts) {
+        return victor_i32x4_from_native(victor_x_mm_srav_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(counts)));
+      }
+
+      static VICTOR_INLINE int32_t victor_i32x4_reduce_add(victor_i32x4 a) {
+        return victor_x_mm_reduce_add_epi32(victor_i32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE int32_t victor_i32x4_reduce_mul(victor_i32x4 a) {
+        return victor_x_mm_reduce_mul_epi32(victor_i32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE int32_t victor_i32x4_reduce_min(victor_i32x4 a) {
+        return victor_x_mm_reduce_min_epi32(victor_i32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE int32_t victor_i32x4_reduce_max(victor_i32x4 a) {
+        return victor_x_mm_reduce_max_epi32(victor_i32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE int32_t victor_i32x4_reduce_and(victor_i32x4 a) {
+        return victor_x_mm_reduce_and_epi32(victor_i32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE int32_t victor_i32x4_reduce_or(victor_i32x4 a) {
+        return victor_x_mm_reduce_or_epi32(victor_i32x4_to_native(a));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_set1(int32_t value) {
         return victor_i32x4_from_native(_mm_set1_epi32(value));
       }
 
-      static inline victor_i32x4 victor_i32x4_set(int32_t e0, int32_t e1, int32_t e2, int32_t e3) {
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_set(int32_t e0, int32_t e1, int32_t e2, int32_t e3) {
         return victor_i32x4_from_native(_mm_setr_epi32(e0, e1, e2, e3));
       }
 
-      static inline void victor_i32x4_store(int32_t dest[HEDLEY_ARRAY_PARAM(4)], victor_i32x4 src) {
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_load(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) {
+        return victor_i32x4_from_native(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        return victor_i32x4_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(4)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_i32x4_from_native(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+        #else
+          return victor_i32x4_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_i32x4_store(int32_t dest[HEDLEY_ARRAY_PARAM(4)], victor_i32x4 src) {
         _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i32x4_to_native(src));
       }
 
-      static inline victor_f32x4 victor_i32x4_to_f32x4(victor_i32x4 src) {
+      static VICTOR_INLINE void victor_i32x4_store_aligned(int32_t dest[HEDLEY_ARRAY_PARAM(4)], victor_i32x4 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i32x4_store_stream(int32_t dest[HEDLEY_ARRAY_PARAM(4)], victor_i32x4 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_load_partial(const int32_t src[], size_t count) {
+        return victor_i32x4_from_native(victor_x_mm_load_partial_epi32(src, VICTOR_X_PARTIAL_COUNT(count, 4)));
+      }
+
+      static VICTOR_INLINE void victor_i32x4_store_partial(int32_t dest[], size_t count, victor_i32x4 src) {
+        victor_x_mm_store_partial_epi32(dest, VICTOR_X_PARTIAL_COUNT(count, 4), victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_gather(const int32_t base[], victor_i32x4 indices) {
+        return victor_i32x4_from_native(victor_x_mm_i32gather_epi32(base, victor_i32x4_to_native(indices)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_gather_masked(victor_mask32x4 mask, const int32_t base[], victor_i32x4 indices) {
+        return victor_i32x4_from_native(victor_x_mm_maskz_i32gather_epi32(victor_mask32x4_to_native(mask), base, victor_i32x4_to_native(indices)));
+      }
+
+      static VICTOR_INLINE void victor_i32x4_scatter(int32_t base[], victor_i32x4 indices, victor_i32x4 src) {
+        victor_x_mm_i32scatter_epi32(base, victor_i32x4_to_native(indices), victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i32x4_to_i64x2(victor_i32x4 src) {
+        return victor_i64x2_from_native(victor_x_mm_cvtepi32_epi64(victor_i32x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i32x4_to_i64x2_high(victor_i32x4 src) {
+        return victor_i64x2_from_native(victor_x_mm_cvtepi32hi_epi64(victor_i32x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_i32x4_to_f32x4(victor_i32x4 src) {
         return victor_f32x4_from_native(_mm_cvtepi32_ps(victor_i32x4_to_native(src)));
       }
 
-      static inline victor_f32x4 victor_i32x4_as_f32x4(victor_i32x4 src) {
+      static VICTOR_INLINE victor_f32x4 victor_i32x4_as_f32x4(victor_i32x4 src) {
         return victor_f32x4_from_native(_mm_castsi128_ps(victor_i32x4_to_native(src)));
       }
+
+      static VICTOR_INLINE victor_f64x2 victor_i32x4_as_f64x2(victor_i32x4 src) {
+        return victor_f64x2_from_native(_mm_castsi128_pd(victor_i32x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i32x4_as_i8x16(victor_i32x4 src) {
+        return victor_i8x16_from_native(victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_i32x4_as_u8x16(victor_i32x4 src) {
+        return victor_u8x16_from_native(victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i32x4_as_i16x8(victor_i32x4 src) {
+        return victor_i16x8_from_native(victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_i32x4_as_u16x8(victor_i32x4 src) {
+        return victor_u16x8_from_native(victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_i32x4_as_u32x4(victor_i32x4 src) {
+        return victor_u32x4_from_native(victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i32x4_as_i64x2(victor_i32x4 src) {
+        return victor_i64x2_from_native(victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_i32x4_as_u64x2(victor_i32x4 src) {
+        return victor_u64x2_from_native(victor_i32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_i32x4_cmpeq(victor_i32x4 a, victor_i32x4 b) {
+        return victor_mask32x4_from_native(_mm_cmpeq_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_i32x4_cmpne(victor_i32x4 a, victor_i32x4 b) {
+        return victor_mask32x4_not(victor_mask32x4_from_native(_mm_cmpeq_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b))));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_i32x4_cmplt(victor_i32x4 a, victor_i32x4 b) {
+        return victor_mask32x4_from_native(_mm_cmplt_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_i32x4_cmple(victor_i32x4 a, victor_i32x4 b) {
+        return victor_mask32x4_not(victor_mask32x4_from_native(_mm_cmpgt_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b))));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_i32x4_cmpgt(victor_i32x4 a, victor_i32x4 b) {
+        return victor_mask32x4_from_native(_mm_cmpgt_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_i32x4_cmpge(victor_i32x4 a, victor_i32x4 b) {
+        return victor_mask32x4_not(victor_mask32x4_from_native(_mm_cmplt_epi32(victor_i32x4_to_native(a), victor_i32x4_to_native(b))));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x4_select(victor_mask32x4 mask, victor_i32x4 a, victor_i32x4 b) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_i32x4_from_native(_mm_blendv_epi8(victor_i32x4_to_native(b), victor_i32x4_to_native(a), victor_mask32x4_to_native(mask)));
+        #else
+          const victor_i32x4 m = victor_i32x4_from_native(victor_mask32x4_to_native(mask));
+          return victor_i32x4_or(victor_i32x4_and(a, m), victor_i32x4_and_not(b, m));
+        #endif
+      }
     #endif /* defined(VICTOR_ENABLE_C_API) */
   #endif /* ? defined(VICTOR_I32X4_FORWARD_DECLARE_H) */
 #endif /* defined(VICTOR_ENABLE_SSE2) */
@@ -0,0 +1,273 @@
+/* i32x8.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX2)
+  #if !defined(VICTOR_I32X8_H_FORWARD_DECLARE)
+    #define VICTOR_I32X8_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i32x8;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_I32X8_H_DECLARE)
+    #define VICTOR_I32X8_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i32x8 {
+          private:
+            __m256i n;
+
+          public:
+            VICTOR_INLINE i32x8(__m256i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m256i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x8(int32_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x8(int32_t e0, int32_t e1, int32_t e2, int32_t e3, int32_t e4, int32_t e5, int32_t e6, int32_t e7) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x8(i32x4 low, i32x4 high) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x8 operator+(i32x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x8 operator&(i32x8 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x8 and_not(i32x8 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x8 load(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x8 load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x8 load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(int32_t values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(int32_t values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(int32_t values[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x8 load_partial(const int32_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(int32_t dest[], size_t count) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i32x8 gather(const int32_t base[], i32x8 indices) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void scatter(int32_t base[], i32x8 indices) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i32x4 low(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 high(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x8 to_f32x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x8 as_f32x8(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef int32_t victor_i32x8 __attribute__((__vector_size__(32),__aligned__(32)));
+
+        static VICTOR_INLINE victor_i32x8 victor_i32x8_from_native(__m256i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_i32x8, v);
+          #else
+            union {
+              __m256i from;
+              victor_i32x8 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m256i victor_i32x8_to_native(victor_i32x8 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m256i, v);
+          #else
+            union {
+              victor_i32x8 from;
+              __m256i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m256i victor_i32x8;
+        #define victor_i32x8_to_native(v) (v)
+        #define victor_i32x8_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_I32X8_H_DEFINE)
+    #define VICTOR_I32X8_H_DEFINE
+
+    /* Partial loads and stores of the first n lanes. */
+    static VICTOR_INLINE __m256i victor_x_mm256_load_partial_epi32(const int32_t* src, size_t n) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        return _mm256_maskz_loadu_epi32(HEDLEY_STATIC_CAST(__mmask8, 0xFFu >> (8 - n)), src);
+      #else
+        return _mm256_maskload_epi32(HEDLEY_REINTERPRET_CAST(const int*, src), _mm256_cmpgt_epi32(_mm256_set1_epi32(HEDLEY_STATIC_CAST(int, n)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm256_store_partial_epi32(int32_t* dest, size_t n, __m256i v) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        _mm256_mask_storeu_epi32(dest, HEDLEY_STATIC_CAST(__mmask8, 0xFFu >> (8 - n)), v);
+      #else
+        _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int*, dest), _mm256_cmpgt_epi32(_mm256_set1_epi32(HEDLEY_STATIC_CAST(int, n)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), v);
+      #endif
+    }
+
+    /* Scatter needs AVX-512VL; otherwise do the low half, then the
+       high half, so repeated indices still resolve to the highest
+       lane. */
+    static VICTOR_INLINE void victor_x_mm256_i32scatter_epi32(int32_t* base, __m256i vindex, __m256i v) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        _mm256_i32scatter_epi32(base, vindex, v, 4);
+      #else
+        victor_x_mm_i32scatter_epi32(base, _mm256_castsi256_si128(vindex), _mm256_castsi256_si128(v));
+        victor_x_mm_i32scatter_epi32(base, _mm256_extracti128_si256(vindex, 1), _mm256_extracti128_si256(v, 1));
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE i32x8::i32x8(__m256i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m256i i32x8::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE i32x8::i32x8(int32_t value) VICTOR_NOEXCEPT :n(_mm256_set1_epi32(value)) { };
+        VICTOR_INLINE i32x8::i32x8(int32_t e0, int32_t e1, int32_t e2, int32_t e3, int32_t e4, int32_t e5, int32_t e6, int32_t e7) VICTOR_NOEXCEPT
+          :n(_mm256_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7)) { };
+        VICTOR_INLINE i32x8::i32x8(i32x4 low, i32x4 high) VICTOR_NOEXCEPT
+          :n(_mm256_inserti128_si256(_mm256_castsi128_si256(low.to_native()), high.to_native(), 1)) { };
+        VICTOR_INLINE i32x8 i32x8::operator+(i32x8 a) const VICTOR_NOEXCEPT { return i32x8(_mm256_add_epi32(n, a.to_native())); };
+        VICTOR_INLINE i32x8 i32x8::operator&(i32x8 a) const VICTOR_NOEXCEPT { return i32x8(_mm256_and_si256(n, a.to_native())); };
+        VICTOR_INLINE i32x8 i32x8::and_not(i32x8 a) const VICTOR_NOEXCEPT { return i32x8(_mm256_andnot_si256(a.to_native(), n)); };
+        VICTOR_INLINE i32x8 i32x8::load(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT { return i32x8(_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, src))); }
+        VICTOR_INLINE i32x8 i32x8::load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 32);
+          return i32x8(_mm256_load_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, src)));
+        }
+        VICTOR_INLINE i32x8 i32x8::load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 32);
+          return i32x8(_mm256_stream_load_si256(HEDLEY_CONST_CAST(__m256i*, HEDLEY_REINTERPRET_CAST(const __m256i*, src))));
+        }
+        VICTOR_INLINE void i32x8::store(int32_t dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT { _mm256_storeu_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), n); }
+        VICTOR_INLINE void i32x8::store_aligned(int32_t dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 32);
+          _mm256_store_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), n);
+        }
+        VICTOR_INLINE void i32x8::store_stream(int32_t dest[HEDLEY_ARRAY_PARAM(8)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 32);
+          _mm256_stream_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), n);
+        }
+        VICTOR_INLINE i32x8 i32x8::load_partial(const int32_t src[], size_t count) VICTOR_NOEXCEPT { return i32x8(victor_x_mm256_load_partial_epi32(src, VICTOR_X_PARTIAL_COUNT(count, 8))); }
+        VICTOR_INLINE void i32x8::store_partial(int32_t dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm256_store_partial_epi32(dest, VICTOR_X_PARTIAL_COUNT(count, 8), n); }
+        VICTOR_INLINE i32x8 i32x8::gather(const int32_t base[], i32x8 indices) VICTOR_NOEXCEPT { return i32x8(_mm256_i32gather_epi32(HEDLEY_REINTERPRET_CAST(const int*, base), indices.to_native(), 4)); }
+        VICTOR_INLINE void i32x8::scatter(int32_t base[], i32x8 indices) const VICTOR_NOEXCEPT { victor_x_mm256_i32scatter_epi32(base, indices.to_native(), n); }
+
+        VICTOR_INLINE i32x4 i32x8::low(void) const VICTOR_NOEXCEPT { return i32x4(_mm256_castsi256_si128(n)); };
+        VICTOR_INLINE i32x4 i32x8::high(void) const VICTOR_NOEXCEPT { return i32x4(_mm256_extracti128_si256(n, 1)); };
+
+        VICTOR_INLINE f32x8 i32x8::to_f32x8(void) const VICTOR_NOEXCEPT { return f32x8(_mm256_cvtepi32_ps(n)); };
+        VICTOR_INLINE f32x8 i32x8::as_f32x8(void) const VICTOR_NOEXCEPT { return f32x8(_mm256_castsi256_ps(n)); };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_add(victor_i32x8 a, victor_i32x8 b) {
+        return victor_i32x8_from_native(_mm256_add_epi32(victor_i32x8_to_native(a), victor_i32x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_and(victor_i32x8 a, victor_i32x8 b) {
+        return victor_i32x8_from_native(_mm256_and_si256(victor_i32x8_to_native(a), victor_i32x8_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_and_not(victor_i32x8 a, victor_i32x8 b) {
+        return victor_i32x8_from_native(_mm256_andnot_si256(victor_i32x8_to_native(b), victor_i32x8_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_set1(int32_t value) {
+        return victor_i32x8_from_native(_mm256_set1_epi32(value));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_set(int32_t e0, int32_t e1, int32_t e2, int32_t e3, int32_t e4, int32_t e5, int32_t e6, int32_t e7) {
+        return victor_i32x8_from_native(_mm256_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_load(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) {
+        return victor_i32x8_from_native(_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_load_aligned(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) {
+        VICTOR_ASSERT_ALIGNED(src, 32);
+        return victor_i32x8_from_native(_mm256_load_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_load_stream(const int32_t src[HEDLEY_ARRAY_PARAM(8)]) {
+        VICTOR_ASSERT_ALIGNED(src, 32);
+        return victor_i32x8_from_native(_mm256_stream_load_si256(HEDLEY_CONST_CAST(__m256i*, HEDLEY_REINTERPRET_CAST(const __m256i*, src))));
+      }
+
+      static VICTOR_INLINE void victor_i32x8_store(int32_t dest[HEDLEY_ARRAY_PARAM(8)], victor_i32x8 src) {
+        _mm256_storeu_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), victor_i32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i32x8_store_aligned(int32_t dest[HEDLEY_ARRAY_PARAM(8)], victor_i32x8 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 32);
+        _mm256_store_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), victor_i32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i32x8_store_stream(int32_t dest[HEDLEY_ARRAY_PARAM(8)], victor_i32x8 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 32);
+        _mm256_stream_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), victor_i32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_load_partial(const int32_t src[], size_t count) {
+        return victor_i32x8_from_native(victor_x_mm256_load_partial_epi32(src, VICTOR_X_PARTIAL_COUNT(count, 8)));
+      }
+
+      static VICTOR_INLINE void victor_i32x8_store_partial(int32_t dest[], size_t count, victor_i32x8 src) {
+        victor_x_mm256_store_partial_epi32(dest, VICTOR_X_PARTIAL_COUNT(count, 8), victor_i32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_gather(const int32_t base[], victor_i32x8 indices) {
+        return victor_i32x8_from_native(_mm256_i32gather_epi32(HEDLEY_REINTERPRET_CAST(const int*, base), victor_i32x8_to_native(indices), 4));
+      }
+
+      static VICTOR_INLINE void victor_i32x8_scatter(int32_t base[], victor_i32x8 indices, victor_i32x8 src) {
+        victor_x_mm256_i32scatter_epi32(base, victor_i32x8_to_native(indices), victor_i32x8_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x8 victor_i32x8_join(victor_i32x4 low, victor_i32x4 high) {
+        return victor_i32x8_from_native(_mm256_inserti128_si256(_mm256_castsi128_si256(victor_i32x4_to_native(low)), victor_i32x4_to_native(high), 1));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x8_low(victor_i32x8 src) {
+        return victor_i32x4_from_native(_mm256_castsi256_si128(victor_i32x8_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i32x8_high(victor_i32x8 src) {
+        return victor_i32x4_from_native(_mm256_extracti128_si256(victor_i32x8_to_native(src), 1));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_i32x8_to_f32x8(victor_i32x8 src) {
+        return victor_f32x8_from_native(_mm256_cvtepi32_ps(victor_i32x8_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_i32x8_as_f32x8(victor_i32x8 src) {
+        return victor_f32x8_from_native(_mm256_castsi256_ps(victor_i32x8_to_native(src)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_I32X8_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX2) */
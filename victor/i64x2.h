@@ -0,0 +1,284 @@
+/* i64x2.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_SSE2)
+  #if !defined(VICTOR_I64X2_H_FORWARD_DECLARE)
+    #define VICTOR_I64X2_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i64x2;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_I64X2_H_DECLARE)
+    #define VICTOR_I64X2_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i64x2 {
+          private:
+            __m128i n;
+
+          public:
+            VICTOR_INLINE i64x2(__m128i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2(int64_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2(int64_t e0, int64_t e1) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 operator+(i64x2 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 operator&(i64x2 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 and_not(i64x2 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i64x2 load(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i64x2 load_aligned(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i64x2 load_stream(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(int64_t values[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(int64_t values[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(int64_t values[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i64x2 load_partial(const int64_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(int64_t dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i8x16 as_i8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 as_u8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 as_i16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 as_u16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 as_i32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 as_u32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 as_u64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 as_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 as_f64x2(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef int64_t victor_i64x2 __attribute__((__vector_size__(16),__aligned__(16)));
+
+        static VICTOR_INLINE victor_i64x2 victor_i64x2_from_native(__m128i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_i64x2, v);
+          #else
+            union {
+              __m128i from;
+              victor_i64x2 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m128i victor_i64x2_to_native(victor_i64x2 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m128i, v);
+          #else
+            union {
+              victor_i64x2 from;
+              __m128i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m128i victor_i64x2;
+        #define victor_i64x2_to_native(v) (v)
+        #define victor_i64x2_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_I64X2_H_DEFINE)
+    #define VICTOR_I64X2_H_DEFINE
+
+    /* As victor_x_mm_load_partial_epi32, but for 64-bit lanes.  The
+       mask compares 32-bit halves against the index of their lane. */
+    static VICTOR_INLINE __m128i victor_x_mm_load_partial_epi64(const void* src, size_t n) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        return _mm_maskz_loadu_epi64(HEDLEY_STATIC_CAST(__mmask8, 0x3u >> (2 - n)), src);
+      #elif defined(VICTOR_ENABLE_AVX)
+        const __m128i mask = _mm_cmpgt_epi32(_mm_set1_epi32(HEDLEY_STATIC_CAST(int, n)), _mm_setr_epi32(0, 0, 1, 1));
+        return _mm_castpd_si128(_mm_maskload_pd(HEDLEY_STATIC_CAST(const double*, src), mask));
+      #else
+        return victor_x_mm_load_partial_si128(src, n * 8);
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm_store_partial_epi64(void* dest, size_t n, __m128i v) {
+      #if defined(VICTOR_ENABLE_AVX512VL)
+        _mm_mask_storeu_epi64(dest, HEDLEY_STATIC_CAST(__mmask8, 0x3u >> (2 - n)), v);
+      #elif defined(VICTOR_ENABLE_AVX)
+        const __m128i mask = _mm_cmpgt_epi32(_mm_set1_epi32(HEDLEY_STATIC_CAST(int, n)), _mm_setr_epi32(0, 0, 1, 1));
+        _mm_maskstore_pd(HEDLEY_STATIC_CAST(double*, dest), mask, _mm_castsi128_pd(v));
+      #else
+        victor_x_mm_store_partial_si128(dest, n * 8, v);
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE i64x2::i64x2(__m128i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128i i64x2::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE i64x2::i64x2(int64_t value) VICTOR_NOEXCEPT :n(_mm_set1_epi64x(value)) { };
+        VICTOR_INLINE i64x2::i64x2(int64_t e0, int64_t e1) VICTOR_NOEXCEPT :n(_mm_set_epi64x(e1, e0)) { };
+        VICTOR_INLINE i64x2 i64x2::operator+(i64x2 a) const VICTOR_NOEXCEPT { return i64x2(_mm_add_epi64(n, a.to_native())); };
+        VICTOR_INLINE i64x2 i64x2::operator&(i64x2 a) const VICTOR_NOEXCEPT { return i64x2(_mm_and_si128(n, a.to_native())); };
+        VICTOR_INLINE i64x2 i64x2::and_not(i64x2 a) const VICTOR_NOEXCEPT { return i64x2(_mm_andnot_si128(a.to_native(), n)); };
+        VICTOR_INLINE i64x2 i64x2::load(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT { return i64x2(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src))); }
+        VICTOR_INLINE i64x2 i64x2::load_aligned(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          return i64x2(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        }
+        VICTOR_INLINE i64x2 i64x2::load_stream(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return i64x2(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+          #else
+            return i64x2(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+          #endif
+        }
+        VICTOR_INLINE void i64x2::store(int64_t dest[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT { _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n); }
+        VICTOR_INLINE void i64x2::store_aligned(int64_t dest[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE void i64x2::store_stream(int64_t dest[HEDLEY_ARRAY_PARAM(2)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE i64x2 i64x2::load_partial(const int64_t src[], size_t count) VICTOR_NOEXCEPT { return i64x2(victor_x_mm_load_partial_epi64(src, VICTOR_X_PARTIAL_COUNT(count, 2))); }
+        VICTOR_INLINE void i64x2::store_partial(int64_t dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm_store_partial_epi64(dest, VICTOR_X_PARTIAL_COUNT(count, 2), n); }
+
+        VICTOR_INLINE i8x16 i64x2::as_i8x16(void) const VICTOR_NOEXCEPT { return i8x16(n); };
+        VICTOR_INLINE u8x16 i64x2::as_u8x16(void) const VICTOR_NOEXCEPT { return u8x16(n); };
+        VICTOR_INLINE i16x8 i64x2::as_i16x8(void) const VICTOR_NOEXCEPT { return i16x8(n); };
+        VICTOR_INLINE u16x8 i64x2::as_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(n); };
+        VICTOR_INLINE i32x4 i64x2::as_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(n); };
+        VICTOR_INLINE u32x4 i64x2::as_u32x4(void) const VICTOR_NOEXCEPT { return u32x4(n); };
+        VICTOR_INLINE u64x2 i64x2::as_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(n); };
+        VICTOR_INLINE f32x4 i64x2::as_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_castsi128_ps(n)); };
+        VICTOR_INLINE f64x2 i64x2::as_f64x2(void) const VICTOR_NOEXCEPT { return f64x2(_mm_castsi128_pd(n)); };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_add(victor_i64x2 a, victor_i64x2 b) {
+        return victor_i64x2_from_native(_mm_add_epi64(victor_i64x2_to_native(a), victor_i64x2_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_and(victor_i64x2 a, victor_i64x2 b) {
+        return victor_i64x2_from_native(_mm_and_si128(victor_i64x2_to_native(a), victor_i64x2_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_and_not(victor_i64x2 a, victor_i64x2 b) {
+        return victor_i64x2_from_native(_mm_andnot_si128(victor_i64x2_to_native(b), victor_i64x2_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_set1(int64_t value) {
+        return victor_i64x2_from_native(_mm_set1_epi64x(value));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_set(int64_t e0, int64_t e1) {
+        return victor_i64x2_from_native(_mm_set_epi64x(e1, e0));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_load(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) {
+        return victor_i64x2_from_native(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_load_aligned(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        return victor_i64x2_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_load_stream(const int64_t src[HEDLEY_ARRAY_PARAM(2)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_i64x2_from_native(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+        #else
+          return victor_i64x2_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_i64x2_store(int64_t dest[HEDLEY_ARRAY_PARAM(2)], victor_i64x2 src) {
+        _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i64x2_store_aligned(int64_t dest[HEDLEY_ARRAY_PARAM(2)], victor_i64x2 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i64x2_store_stream(int64_t dest[HEDLEY_ARRAY_PARAM(2)], victor_i64x2 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i64x2_load_partial(const int64_t src[], size_t count) {
+        return victor_i64x2_from_native(victor_x_mm_load_partial_epi64(src, VICTOR_X_PARTIAL_COUNT(count, 2)));
+      }
+
+      static VICTOR_INLINE void victor_i64x2_store_partial(int64_t dest[], size_t count, victor_i64x2 src) {
+        victor_x_mm_store_partial_epi64(dest, VICTOR_X_PARTIAL_COUNT(count, 2), victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i64x2_as_i8x16(victor_i64x2 src) {
+        return victor_i8x16_from_native(victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_i64x2_as_u8x16(victor_i64x2 src) {
+        return victor_u8x16_from_native(victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i64x2_as_i16x8(victor_i64x2 src) {
+        return victor_i16x8_from_native(victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_i64x2_as_u16x8(victor_i64x2 src) {
+        return victor_u16x8_from_native(victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i64x2_as_i32x4(victor_i64x2 src) {
+        return victor_i32x4_from_native(victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_i64x2_as_u32x4(victor_i64x2 src) {
+        return victor_u32x4_from_native(victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_i64x2_as_u64x2(victor_i64x2 src) {
+        return victor_u64x2_from_native(victor_i64x2_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_i64x2_as_f32x4(victor_i64x2 src) {
+        return victor_f32x4_from_native(_mm_castsi128_ps(victor_i64x2_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_i64x2_as_f64x2(victor_i64x2 src) {
+        return victor_f64x2_from_native(_mm_castsi128_pd(victor_i64x2_to_native(src)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_I64X2_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_SSE2) */
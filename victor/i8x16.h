@@ -31,55 +31,118 @@
     #define VICTOR_I8X16_H_FORWARD_DECLARE
 
     #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
+      VICTOR_X_BEGIN_NAMESPACE
         class i8x16;
-      }
+      VICTOR_X_END_NAMESPACE
     #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
   #elif !defined(VICTOR_I8X16_H_DECLARE)
     #define VICTOR_I8X16_H_DECLARE
 
     #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
+      VICTOR_X_BEGIN_NAMESPACE
         class i8x16 {
           private:
             __m128i n;
 
           public:
-            inline i8x16(__m128i value);
-            inline __m128i to_native(void);
-            inline i8x16(int8_t value);
-            inline i8x16(int8_t e0, int8_t e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
-                         int8_t e8, int8_t e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15);
-            inline i8x16 operator+(i8x16 a);
-            inline i8x16 operator&(i8x16 a);
-            inline i8x16 and_not(i8x16 a);
-            inline void store(int8_t values[HEDLEY_ARRAY_PARAM(4)]);
-
-            inline f32x4 as_f32x4(void);
+            VICTOR_INLINE i8x16(__m128i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 to_i16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 to_i16x8_high(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 to_i32x4(void) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x16 narrow(i16x8 low, i16x8 high) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void dequantize(f32x4 dest[HEDLEY_ARRAY_PARAM(4)], float scale) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16(int8_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16(int8_t e0, int8_t e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
+                         int8_t e8, int8_t e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator+(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator&(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 and_not(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator-(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator*(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator|(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator^(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator~(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator<<(int count) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 operator>>(int count) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 adds(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 subs(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 abs(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i8x16& operator+=(i8x16 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16& operator-=(i8x16 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16& operator*=(i8x16 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16& operator&=(i8x16 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16& operator|=(i8x16 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16& operator^=(i8x16 a) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16& operator<<=(int count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16& operator>>=(int count) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE int32_t reduce_add(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int8_t reduce_min(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int8_t reduce_max(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int8_t reduce_and(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE int8_t reduce_or(void) const VICTOR_NOEXCEPT;
+
+            static VICTOR_INLINE i8x16 load(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x16 load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x16 load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(int8_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(int8_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(int8_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x16 load_partial(const int8_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(int8_t dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x4 as_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 as_f64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 as_u8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 as_i16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 as_u16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 as_i32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 as_u32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 as_i64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 as_u64x2(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE mask8x16 operator==(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask8x16 operator!=(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask8x16 operator<(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask8x16 operator<=(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask8x16 operator>(i8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask8x16 operator>=(i8x16 a) const VICTOR_NOEXCEPT;
         };
-      }
+
+        VICTOR_INLINE i8x16 select(mask8x16 mask, i8x16 a, i8x16 b) VICTOR_NOEXCEPT;
+      VICTOR_X_END_NAMESPACE
     #endif /* defined(VICTOR_ENABLE_CXX_API) */
 
     #if defined(VICTOR_ENABLE_C_API)
       #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
         typedef int8_t victor_i8x16 __attribute__((__vector_size__(16),__aligned__(16)));
 
-        static inline victor_i8x16 victor_i8x16_from_native(__m128i v) {
-          union {
-            __m128i from;
-            victor_i8x16 to;
-          } u;
-          u.from = v;
-          return u.to;
+        static VICTOR_INLINE victor_i8x16 victor_i8x16_from_native(__m128i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_i8x16, v);
+          #else
+            union {
+              __m128i from;
+              victor_i8x16 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
         }
 
-        static inline __m128i victor_i8x16_to_native(victor_i8x16 v) {
-          union {
-            victor_i8x16 from;
-            __m128i to;
-          } u;
-          u.from = v;
-          return u.to;
+        static VICTOR_INLINE __m128i victor_i8x16_to_native(victor_i8x16 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m128i, v);
+          #else
+            union {
+              victor_i8x16 from;
+              __m128i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
         }
       #else
         typedef __m128i victor_i8x16;
@@ -91,53 +154,507 @@
   #elif !defined(VICTOR_I8X16_H_DEFINE)
     #define VICTOR_I8X16_H_DEFINE
 
+    /* Partial loads and stores of the first `bytes' bytes; loads zero
+       the rest of the vector, stores leave the rest of memory alone.
+       With AVX-512BW and AVX-512VL these are masked moves, which don't
+       fault on the masked-off bytes.  Otherwise a load reads the whole
+       16 bytes if they're all in the same page as src (so it can't
+       fault) and zeros the extra bytes, and anything else goes through
+       memcpy. */
+    static VICTOR_INLINE __m128i victor_x_mm_load_partial_si128(const void* src, size_t bytes) {
+      #if defined(VICTOR_ENABLE_AVX512BW) && defined(VICTOR_ENABLE_AVX512VL)
+        return _mm_maskz_loadu_epi8(HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - bytes)), src);
+      #else
+        __m128i r;
+        #if !defined(VICTOR_NO_OVERREAD)
+          if (bytes != 0 && (HEDLEY_REINTERPRET_CAST(uintptr_t, src) & 4095) <= 4096 - 16) {
+            const __m128i keep = _mm_cmpgt_epi8(_mm_set1_epi8(HEDLEY_STATIC_CAST(char, bytes)), _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+            return _mm_and_si128(_mm_loadu_si128(HEDLEY_STATIC_CAST(const __m128i*, src)), keep);
+          }
+        #endif
+        r = _mm_setzero_si128();
+        memcpy(&r, src, bytes);
+        return r;
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm_store_partial_si128(void* dest, size_t bytes, __m128i v) {
+      #if defined(VICTOR_ENABLE_AVX512BW) && defined(VICTOR_ENABLE_AVX512VL)
+        _mm_mask_storeu_epi8(dest, HEDLEY_STATIC_CAST(__mmask16, 0xFFFFu >> (16 - bytes)), v);
+      #else
+        memcpy(dest, &v, bytes);
+      #endif
+    }
+
+    /* x86 has no 8-bit multiplies or shifts, so we use the 16-bit
+       versions and fix up the bytes afterwards. */
+    static VICTOR_INLINE __m128i victor_x_mm_mullo_epi8(__m128i a, __m128i b) {
+      const __m128i even = _mm_mullo_epi16(a, b);
+      const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+      return _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0x00FF)), _mm_slli_epi16(odd, 8));
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_slli_epi8(__m128i a, int count) {
+      if (HEDLEY_UNLIKELY(count > 7))
+        return _mm_setzero_si128();
+      return _mm_and_si128(_mm_slli_epi16(a, count), _mm_set1_epi8(HEDLEY_STATIC_CAST(char, (0xFF << count) & 0xFF)));
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_srai_epi8(__m128i a, int count) {
+      const __m128i even = _mm_srai_epi16(_mm_slli_epi16(a, 8), count + 8);
+      const __m128i odd = _mm_srai_epi16(a, count);
+      return _mm_or_si128(_mm_srli_epi16(_mm_slli_epi16(even, 8), 8), _mm_andnot_si128(_mm_set1_epi16(0x00FF), odd));
+    }
+
+    /* pabsb is SSSE3; without it, |x| is the unsigned minimum of x and
+       -x.  Like pabsb, abs(-128) is -128. */
+    static VICTOR_INLINE __m128i victor_x_mm_abs_epi8(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSSE3)
+        return _mm_abs_epi8(a);
+      #else
+        return _mm_min_epu8(a, _mm_sub_epi8(_mm_setzero_si128(), a));
+      #endif
+    }
+
+    /* pminsb and pmaxsb are SSE4.1; otherwise flip the sign bits and
+       use the unsigned versions. */
+    static VICTOR_INLINE __m128i victor_x_mm_min_epi8(__m128i a, __m128i b) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_min_epi8(a, b);
+      #else
+        const __m128i bias = _mm_set1_epi8(-128);
+        return _mm_xor_si128(_mm_min_epu8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_max_epi8(__m128i a, __m128i b) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_max_epi8(a, b);
+      #else
+        const __m128i bias = _mm_set1_epi8(-128);
+        return _mm_xor_si128(_mm_max_epu8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+      #endif
+    }
+
+    #if !defined(victor_x_mm_not_si128)
+      /* andnot(a, ~0) rather than xor(a, ~0): GCC folds the latter
+         into an operation on the C API's vector type and adds a
+         register copy. */
+      #define victor_x_mm_not_si128(a) \
+        _mm_andnot_si128((a), _mm_set1_epi32(-1))
+    #endif
+
+    /* Horizontal reductions.  The sum is exact (it doesn't wrap), which
+       is what you want for checksums and histograms; psadbw sums each
+       group of eight bytes, so we flip the sign bits to make them
+       unsigned and subtract the bias at the end. */
+    static VICTOR_INLINE int32_t victor_x_mm_reduce_add_epi8(__m128i v) {
+      const __m128i sums = _mm_sad_epu8(_mm_xor_si128(v, _mm_set1_epi8(-128)), _mm_setzero_si128());
+      return _mm_cvtsi128_si32(_mm_add_epi32(sums, _mm_unpackhi_epi64(sums, sums))) - (16 * 128);
+    }
+
+    /* For min and max we flip the sign bits so we can use the unsigned
+       instructions.  On SSE4.1 phminposuw does most of the work after
+       a single pminub folds the bytes into words; otherwise we halve
+       the vector four times.  max(x) is ~min(~x). */
+    static VICTOR_INLINE uint8_t victor_x_mm_reduce_min_epu8(__m128i v) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        v = _mm_min_epu8(v, _mm_srli_epi16(v, 8));
+        return HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(_mm_minpos_epu16(_mm_and_si128(v, _mm_set1_epi16(0x00FF)))));
+      #else
+        v = _mm_min_epu8(v, _mm_unpackhi_epi64(v, v));
+        v = _mm_min_epu8(v, _mm_srli_epi64(v, 32));
+        v = _mm_min_epu8(v, _mm_srli_epi32(v, 16));
+        v = _mm_min_epu8(v, _mm_srli_epi16(v, 8));
+        return HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(v));
+      #endif
+    }
+
+    static VICTOR_INLINE int8_t victor_x_mm_reduce_min_epi8(__m128i v) {
+      return HEDLEY_STATIC_CAST(int8_t, victor_x_mm_reduce_min_epu8(_mm_xor_si128(v, _mm_set1_epi8(-128))) ^ 0x80);
+    }
+
+    static VICTOR_INLINE int8_t victor_x_mm_reduce_max_epi8(__m128i v) {
+      return HEDLEY_STATIC_CAST(int8_t, victor_x_mm_reduce_min_epu8(_mm_xor_si128(v, _mm_set1_epi8(0x7F))) ^ 0x7F);
+    }
+
+    /* Fold down to 32 bits in vector registers, then finish in GPRs. */
+    static VICTOR_INLINE int8_t victor_x_mm_reduce_and_epi8(__m128i v) {
+      uint32_t r;
+      v = _mm_and_si128(v, _mm_unpackhi_epi64(v, v));
+      r = HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(_mm_and_si128(v, _mm_srli_epi64(v, 32))));
+      r &= r >> 16;
+      return HEDLEY_STATIC_CAST(int8_t, r & (r >> 8));
+    }
+
+    static VICTOR_INLINE int8_t victor_x_mm_reduce_or_epi8(__m128i v) {
+      uint32_t r;
+      v = _mm_or_si128(v, _mm_unpackhi_epi64(v, v));
+      r = HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(_mm_or_si128(v, _mm_srli_epi64(v, 32))));
+      r |= r >> 16;
+      return HEDLEY_STATIC_CAST(int8_t, r | (r >> 8));
+    }
+
+    /* Widening.  SSE4.1 has pmovsx for the low lanes; otherwise we
+       interleave the vector with itself and shift the copy back down,
+       which is also how we get the high half. */
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepi8_epi16(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_cvtepi8_epi16(a);
+      #else
+        return _mm_srai_epi16(_mm_unpacklo_epi8(a, a), 8);
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepi8hi_epi16(__m128i a) {
+      return _mm_srai_epi16(_mm_unpackhi_epi8(a, a), 8);
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepi8_epi32(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_cvtepi8_epi32(a);
+      #else
+        a = _mm_unpacklo_epi8(a, a);
+        return _mm_srai_epi32(_mm_unpacklo_epi16(a, a), 24);
+      #endif
+    }
+
+    /* All sixteen lanes as four vectors of 32-bit lanes.  Without
+       SSE4.1 the two 8 -> 16-bit interleaves are shared by both
+       halves. */
+    static VICTOR_INLINE void victor_x_mm_cvtepi8_epi32_x4(__m128i r[4], __m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        r[0] = _mm_cvtepi8_epi32(a);
+        r[1] = _mm_cvtepi8_epi32(_mm_srli_si128(a, 4));
+        r[2] = _mm_cvtepi8_epi32(_mm_srli_si128(a, 8));
+        r[3] = _mm_cvtepi8_epi32(_mm_srli_si128(a, 12));
+      #else
+        const __m128i lo = _mm_unpacklo_epi8(a, a);
+        const __m128i hi = _mm_unpackhi_epi8(a, a);
+        r[0] = _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 24);
+        r[1] = _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 24);
+        r[2] = _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 24);
+        r[3] = _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 24);
+      #endif
+    }
+
     #if defined(VICTOR_ENABLE_CXX_API)
-      namespace Victor {
-        inline i8x16::i8x16(__m128i value) :n(value) { };
-        inline __m128i i8x16::to_native() { return n; }
-        inline i8x16::i8x16(int8_t value) :n(_mm_set1_epi8(value)) { };
-        inline i8x16::i8x16(int8_t e0, int8_t e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
-                            int8_t e8, int8_t e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE i8x16::i8x16(__m128i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128i i8x16::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE i8x16::i8x16(int8_t value) VICTOR_NOEXCEPT :n(_mm_set1_epi8(value)) { };
+        VICTOR_INLINE i8x16::i8x16(int8_t e0, int8_t e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
+                            int8_t e8, int8_t e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15) VICTOR_NOEXCEPT
           :n(_mm_setr_epi8(e0, e1,  e2,  e3,  e4,  e5,  e6,  e7,
                            e8, e9, e10, e11, e12, e13, e14, e15)) { };
-        inline i8x16 i8x16::operator+(i8x16 a) { return i8x16(_mm_add_epi8(n, a.to_native())); };
-        inline i8x16 i8x16::operator&(i8x16 a) { return i8x16(_mm_and_si128(n, a.to_native())); };
-        inline i8x16 i8x16::and_not(i8x16 a) { return i8x16(_mm_andnot_si128(n, a.to_native())); };
-        inline void i8x16::store(int8_t dest[HEDLEY_ARRAY_PARAM(4)]) { _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n); }
+        VICTOR_INLINE i8x16 i8x16::operator+(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(_mm_add_epi8(n, a.to_native())); };
+        VICTOR_INLINE i8x16 i8x16::operator&(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(_mm_and_si128(n, a.to_native())); };
+        VICTOR_INLINE i8x16 i8x16::and_not(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(_mm_andnot_si128(a.to_native(), n)); };
+        VICTOR_INLINE i8x16 i8x16::operator-(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(_mm_sub_epi8(n, a.to_native())); };
+        VICTOR_INLINE i8x16 i8x16::operator*(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(victor_x_mm_mullo_epi8(n, a.to_native())); };
+        VICTOR_INLINE i8x16 i8x16::operator|(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(_mm_or_si128(n, a.to_native())); };
+        VICTOR_INLINE i8x16 i8x16::operator^(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(_mm_xor_si128(n, a.to_native())); };
+        VICTOR_INLINE i8x16 i8x16::operator~(void) const VICTOR_NOEXCEPT { return i8x16(victor_x_mm_not_si128(n)); };
+        VICTOR_INLINE i8x16 i8x16::operator<<(int count) const VICTOR_NOEXCEPT { return i8x16(victor_x_mm_slli_epi8(n, count)); };
+        VICTOR_INLINE i8x16 i8x16::operator>>(int count) const VICTOR_NOEXCEPT { return i8x16(victor_x_mm_srai_epi8(n, count)); };
+        VICTOR_INLINE i8x16 i8x16::adds(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(_mm_adds_epi8(n, a.to_native())); };
+        VICTOR_INLINE i8x16 i8x16::subs(i8x16 a) const VICTOR_NOEXCEPT { return i8x16(_mm_subs_epi8(n, a.to_native())); };
+        VICTOR_INLINE i8x16 i8x16::abs(void) const VICTOR_NOEXCEPT { return i8x16(victor_x_mm_abs_epi8(n)); };
+        VICTOR_INLINE i8x16& i8x16::operator+=(i8x16 a) VICTOR_NOEXCEPT { return *this = *this + a; };
+        VICTOR_INLINE i8x16& i8x16::operator-=(i8x16 a) VICTOR_NOEXCEPT { return *this = *this - a; };
+        VICTOR_INLINE i8x16& i8x16::operator*=(i8x16 a) VICTOR_NOEXCEPT { return *this = *this * a; };
+        VICTOR_INLINE i8x16& i8x16::operator&=(i8x16 a) VICTOR_NOEXCEPT { return *this = *this & a; };
+        VICTOR_INLINE i8x16& i8x16::operator|=(i8x16 a) VICTOR_NOEXCEPT { return *this = *this | a; };
+        VICTOR_INLINE i8x16& i8x16::operator^=(i8x16 a) VICTOR_NOEXCEPT { return *this = *this ^ a; };
+        VICTOR_INLINE i8x16& i8x16::operator<<=(int count) VICTOR_NOEXCEPT { return *this = *this << count; };
+        VICTOR_INLINE i8x16& i8x16::operator>>=(int count) VICTOR_NOEXCEPT { return *this = *this >> count; };
+        VICTOR_INLINE int32_t i8x16::reduce_add(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_add_epi8(n); }
+        VICTOR_INLINE int8_t i8x16::reduce_min(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_min_epi8(n); }
+        VICTOR_INLINE int8_t i8x16::reduce_max(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_max_epi8(n); }
+        VICTOR_INLINE int8_t i8x16::reduce_and(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_and_epi8(n); }
+        VICTOR_INLINE int8_t i8x16::reduce_or(void) const VICTOR_NOEXCEPT { return victor_x_mm_reduce_or_epi8(n); }
+        VICTOR_INLINE i8x16 i8x16::load(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT { return i8x16(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src))); }
+        VICTOR_INLINE i8x16 i8x16::load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          return i8x16(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        }
+        VICTOR_INLINE i8x16 i8x16::load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return i8x16(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+          #else
+            return i8x16(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+          #endif
+        }
+        VICTOR_INLINE void i8x16::store(int8_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT { _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n); }
+        VICTOR_INLINE void i8x16::store_aligned(int8_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE void i8x16::store_stream(int8_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE i8x16 i8x16::load_partial(const int8_t src[], size_t count) VICTOR_NOEXCEPT { return i8x16(victor_x_mm_load_partial_si128(src, VICTOR_X_PARTIAL_COUNT(count, 16))); }
+        VICTOR_INLINE void i8x16::store_partial(int8_t dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm_store_partial_si128(dest, VICTOR_X_PARTIAL_COUNT(count, 16), n); }
 
-        inline f32x4 i8x16::as_f32x4(void) { return f32x4(_mm_castsi128_ps(n)); };
-      }
+        VICTOR_INLINE i16x8 i8x16::to_i16x8(void) const VICTOR_NOEXCEPT { return i16x8(victor_x_mm_cvtepi8_epi16(n)); };
+        VICTOR_INLINE i16x8 i8x16::to_i16x8_high(void) const VICTOR_NOEXCEPT { return i16x8(victor_x_mm_cvtepi8hi_epi16(n)); };
+        VICTOR_INLINE i32x4 i8x16::to_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(victor_x_mm_cvtepi8_epi32(n)); };
+        VICTOR_INLINE i8x16 i8x16::narrow(i16x8 low, i16x8 high) VICTOR_NOEXCEPT { return i8x16(_mm_packs_epi16(low.to_native(), high.to_native())); };
+        VICTOR_INLINE void i8x16::dequantize(f32x4 dest[HEDLEY_ARRAY_PARAM(4)], float scale) const VICTOR_NOEXCEPT {
+          const __m128 s = _mm_set1_ps(scale);
+          __m128i r[4];
+          victor_x_mm_cvtepi8_epi32_x4(r, n);
+          dest[0] = f32x4(_mm_mul_ps(_mm_cvtepi32_ps(r[0]), s));
+          dest[1] = f32x4(_mm_mul_ps(_mm_cvtepi32_ps(r[1]), s));
+          dest[2] = f32x4(_mm_mul_ps(_mm_cvtepi32_ps(r[2]), s));
+          dest[3] = f32x4(_mm_mul_ps(_mm_cvtepi32_ps(r[3]), s));
+        }
+        VICTOR_INLINE f32x4 i8x16::as_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_castsi128_ps(n)); };
+        VICTOR_INLINE f64x2 i8x16::as_f64x2(void) const VICTOR_NOEXCEPT { return f64x2(_mm_castsi128_pd(n)); };
+        VICTOR_INLINE u8x16 i8x16::as_u8x16(void) const VICTOR_NOEXCEPT { return u8x16(n); };
+        VICTOR_INLINE i16x8 i8x16::as_i16x8(void) const VICTOR_NOEXCEPT { return i16x8(n); };
+        VICTOR_INLINE u16x8 i8x16::as_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(n); };
+        VICTOR_INLINE i32x4 i8x16::as_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(n); };
+        VICTOR_INLINE u32x4 i8x16::as_u32x4(void) const VICTOR_NOEXCEPT { return u32x4(n); };
+        VICTOR_INLINE i64x2 i8x16::as_i64x2(void) const VICTOR_NOEXCEPT { return i64x2(n); };
+        VICTOR_INLINE u64x2 i8x16::as_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(n); };
+
+        VICTOR_INLINE mask8x16 i8x16::operator==(i8x16 a) const VICTOR_NOEXCEPT { return mask8x16(_mm_cmpeq_epi8(n, a.to_native())); }
+        VICTOR_INLINE mask8x16 i8x16::operator!=(i8x16 a) const VICTOR_NOEXCEPT { return ~(*this == a); }
+        VICTOR_INLINE mask8x16 i8x16::operator<(i8x16 a) const VICTOR_NOEXCEPT { return mask8x16(_mm_cmplt_epi8(n, a.to_native())); }
+        VICTOR_INLINE mask8x16 i8x16::operator<=(i8x16 a) const VICTOR_NOEXCEPT { return ~(*this > a); }
+        VICTOR_INLINE mask8x16 i8x16::operator>(i8x16 a) const VICTOR_NOEXCEPT { return mask8x16(_mm_cmpgt_epi8(n, a.to_native())); }
+        VICTOR_INLINE mask8x16 i8x16::operator>=(i8x16 a) const VICTOR_NOEXCEPT { return ~(*this < a); }
+
+        VICTOR_INLINE i8x16 select(mask8x16 mask, i8x16 a, i8x16 b) VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return i8x16(_mm_blendv_epi8(b.to_native(), a.to_native(), mask.to_native()));
+          #else
+            const i8x16 m(mask.to_native());
+            return (a & m) | b.and_not(m);
+          #endif
+        }
+      VICTOR_X_END_NAMESPACE
     #endif /* defined(VICTOR_ENABLE_CXX_API) */
 
     #if defined(VICTOR_ENABLE_C_API)
-      static inline victor_i8x16 victor_i8x16_add(victor_i8x16 a, victor_i8x16 b) {
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_add(victor_i8x16 a, victor_i8x16 b) {
         return victor_i8x16_from_native(_mm_add_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
       }
 
-      static inline victor_i8x16 victor_i8x16_and(victor_i8x16 a, victor_i8x16 b) {
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_and(victor_i8x16 a, victor_i8x16 b) {
         return victor_i8x16_from_native(_mm_and_si128(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
       }
 
-      static inline victor_i8x16 victor_i8x16_andnot(victor_i8x16 a, victor_i8x16 b) {
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_and_not(victor_i8x16 a, victor_i8x16 b) {
         return victor_i8x16_from_native(_mm_andnot_si128(victor_i8x16_to_native(b), victor_i8x16_to_native(a)));
       }
 
-      static inline victor_i8x16 victor_i8x16_set1(int8_t value) {
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_sub(victor_i8x16 a, victor_i8x16 b) {
+        return victor_i8x16_from_native(_mm_sub_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_mul(victor_i8x16 a, victor_i8x16 b) {
+        return victor_i8x16_from_native(victor_x_mm_mullo_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_or(victor_i8x16 a, victor_i8x16 b) {
+        return victor_i8x16_from_native(_mm_or_si128(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_xor(victor_i8x16 a, victor_i8x16 b) {
+        return victor_i8x16_from_native(_mm_xor_si128(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_not(victor_i8x16 a) {
+        return victor_i8x16_from_native(victor_x_mm_not_si128(victor_i8x16_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_shl(victor_i8x16 a, int count) {
+        return victor_i8x16_from_native(victor_x_mm_slli_epi8(victor_i8x16_to_native(a), count));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_shr(victor_i8x16 a, int count) {
+        return victor_i8x16_from_native(victor_x_mm_srai_epi8(victor_i8x16_to_native(a), count));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_adds(victor_i8x16 a, victor_i8x16 b) {
+        return victor_i8x16_from_native(_mm_adds_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_subs(victor_i8x16 a, victor_i8x16 b) {
+        return victor_i8x16_from_native(_mm_subs_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_abs(victor_i8x16 a) {
+        return victor_i8x16_from_native(victor_x_mm_abs_epi8(victor_i8x16_to_native(a)));
+      }
+
+      static VICTOR_INLINE int32_t victor_i8x16_reduce_add(victor_i8x16 a) {
+        return victor_x_mm_reduce_add_epi8(victor_i8x16_to_native(a));
+      }
+
+      static VICTOR_INLINE int8_t victor_i8x16_reduce_min(victor_i8x16 a) {
+        return victor_x_mm_reduce_min_epi8(victor_i8x16_to_native(a));
+      }
+
+      static VICTOR_INLINE int8_t victor_i8x16_reduce_max(victor_i8x16 a) {
+        return victor_x_mm_reduce_max_epi8(victor_i8x16_to_native(a));
+      }
+
+      static VICTOR_INLINE int8_t victor_i8x16_reduce_and(victor_i8x16 a) {
+        return victor_x_mm_reduce_and_epi8(victor_i8x16_to_native(a));
+      }
+
+      static VICTOR_INLINE int8_t victor_i8x16_reduce_or(victor_i8x16 a) {
+        return victor_x_mm_reduce_or_epi8(victor_i8x16_to_native(a));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_set1(int8_t value) {
         return victor_i8x16_from_native(_mm_set1_epi8(value));
       }
 
-      static inline victor_i8x16 victor_i8x16_set(int8_t e0, int8_t e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_set(int8_t e0, int8_t e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
                                                   int8_t e8, int8_t e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15) {
         return victor_i8x16_from_native(_mm_setr_epi8(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15));
       }
 
-      static inline void victor_i8x16_store(int8_t dest[HEDLEY_ARRAY_PARAM(4)], victor_i8x16 src) {
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_load(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        return victor_i8x16_from_native(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        return victor_i8x16_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_i8x16_from_native(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+        #else
+          return victor_i8x16_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_i8x16_store(int8_t dest[HEDLEY_ARRAY_PARAM(16)], victor_i8x16 src) {
         _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i8x16_to_native(src));
       }
 
-      static inline victor_f32x4 victor_i8x16_as_f32x4(victor_i8x16 src) {
+      static VICTOR_INLINE void victor_i8x16_store_aligned(int8_t dest[HEDLEY_ARRAY_PARAM(16)], victor_i8x16 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i8x16_store_stream(int8_t dest[HEDLEY_ARRAY_PARAM(16)], victor_i8x16 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_load_partial(const int8_t src[], size_t count) {
+        return victor_i8x16_from_native(victor_x_mm_load_partial_si128(src, VICTOR_X_PARTIAL_COUNT(count, 16)));
+      }
+
+      static VICTOR_INLINE void victor_i8x16_store_partial(int8_t dest[], size_t count, victor_i8x16 src) {
+        victor_x_mm_store_partial_si128(dest, VICTOR_X_PARTIAL_COUNT(count, 16), victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i8x16_to_i16x8(victor_i8x16 src) {
+        return victor_i16x8_from_native(victor_x_mm_cvtepi8_epi16(victor_i8x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i8x16_to_i16x8_high(victor_i8x16 src) {
+        return victor_i16x8_from_native(victor_x_mm_cvtepi8hi_epi16(victor_i8x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i8x16_to_i32x4(victor_i8x16 src) {
+        return victor_i32x4_from_native(victor_x_mm_cvtepi8_epi32(victor_i8x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_narrow_i16x8(victor_i16x8 low, victor_i16x8 high) {
+        return victor_i8x16_from_native(_mm_packs_epi16(victor_i16x8_to_native(low), victor_i16x8_to_native(high)));
+      }
+
+      static VICTOR_INLINE void victor_i8x16_dequantize(victor_f32x4 dest[HEDLEY_ARRAY_PARAM(4)], victor_i8x16 src, float scale) {
+        const __m128 s = _mm_set1_ps(scale);
+        __m128i r[4];
+        victor_x_mm_cvtepi8_epi32_x4(r, victor_i8x16_to_native(src));
+        dest[0] = victor_f32x4_from_native(_mm_mul_ps(_mm_cvtepi32_ps(r[0]), s));
+        dest[1] = victor_f32x4_from_native(_mm_mul_ps(_mm_cvtepi32_ps(r[1]), s));
+        dest[2] = victor_f32x4_from_native(_mm_mul_ps(_mm_cvtepi32_ps(r[2]), s));
+        dest[3] = victor_f32x4_from_native(_mm_mul_ps(_mm_cvtepi32_ps(r[3]), s));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_i8x16_as_f32x4(victor_i8x16 src) {
         return victor_f32x4_from_native(_mm_castsi128_ps(victor_i8x16_to_native(src)));
       }
+
+      static VICTOR_INLINE victor_f64x2 victor_i8x16_as_f64x2(victor_i8x16 src) {
+        return victor_f64x2_from_native(_mm_castsi128_pd(victor_i8x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_i8x16_as_u8x16(victor_i8x16 src) {
+        return victor_u8x16_from_native(victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_i8x16_as_i16x8(victor_i8x16 src) {
+        return victor_i16x8_from_native(victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_i8x16_as_u16x8(victor_i8x16 src) {
+        return victor_u16x8_from_native(victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_i8x16_as_i32x4(victor_i8x16 src) {
+        return victor_i32x4_from_native(victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_i8x16_as_u32x4(victor_i8x16 src) {
+        return victor_u32x4_from_native(victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_i8x16_as_i64x2(victor_i8x16 src) {
+        return victor_i64x2_from_native(victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_i8x16_as_u64x2(victor_i8x16 src) {
+        return victor_u64x2_from_native(victor_i8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_mask8x16 victor_i8x16_cmpeq(victor_i8x16 a, victor_i8x16 b) {
+        return victor_mask8x16_from_native(_mm_cmpeq_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask8x16 victor_i8x16_cmpne(victor_i8x16 a, victor_i8x16 b) {
+        return victor_mask8x16_not(victor_mask8x16_from_native(_mm_cmpeq_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b))));
+      }
+
+      static VICTOR_INLINE victor_mask8x16 victor_i8x16_cmplt(victor_i8x16 a, victor_i8x16 b) {
+        return victor_mask8x16_from_native(_mm_cmplt_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask8x16 victor_i8x16_cmple(victor_i8x16 a, victor_i8x16 b) {
+        return victor_mask8x16_not(victor_mask8x16_from_native(_mm_cmpgt_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b))));
+      }
+
+      static VICTOR_INLINE victor_mask8x16 victor_i8x16_cmpgt(victor_i8x16 a, victor_i8x16 b) {
+        return victor_mask8x16_from_native(_mm_cmpgt_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask8x16 victor_i8x16_cmpge(victor_i8x16 a, victor_i8x16 b) {
+        return victor_mask8x16_not(victor_mask8x16_from_native(_mm_cmplt_epi8(victor_i8x16_to_native(a), victor_i8x16_to_native(b))));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x16_select(victor_mask8x16 mask, victor_i8x16 a, victor_i8x16 b) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_i8x16_from_native(_mm_blendv_epi8(victor_i8x16_to_native(b), victor_i8x16_to_native(a), victor_mask8x16_to_native(mask)));
+        #else
+          const victor_i8x16 m = victor_i8x16_from_native(victor_mask8x16_to_native(mask));
+          return victor_i8x16_or(victor_i8x16_and(a, m), victor_i8x16_and_not(b, m));
+        #endif
+      }
     #endif /* defined(VICTOR_ENABLE_C_API) */
   #endif /* ? defined(VICTOR_I8X16_FORWARD_DECLARE_H) */
 #endif /* defined(VICTOR_ENABLE_SSE2) */
@@ -0,0 +1,267 @@
+/* i8x32.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX2)
+  #if !defined(VICTOR_I8X32_H_FORWARD_DECLARE)
+    #define VICTOR_I8X32_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i8x32;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_I8X32_H_DECLARE)
+    #define VICTOR_I8X32_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i8x32 {
+          private:
+            __m256i n;
+
+          public:
+            VICTOR_INLINE i8x32(__m256i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m256i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x32(int8_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x32(int8_t  e0, int8_t  e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
+                         int8_t  e8, int8_t  e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15,
+                         int8_t e16, int8_t e17, int8_t e18, int8_t e19, int8_t e20, int8_t e21, int8_t e22, int8_t e23,
+                         int8_t e24, int8_t e25, int8_t e26, int8_t e27, int8_t e28, int8_t e29, int8_t e30, int8_t e31) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x32(i8x16 low, i8x16 high) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x32 operator+(i8x32 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x32 operator&(i8x32 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x32 and_not(i8x32 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x32 load(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x32 load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x32 load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(int8_t values[HEDLEY_ARRAY_PARAM(32)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(int8_t values[HEDLEY_ARRAY_PARAM(32)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(int8_t values[HEDLEY_ARRAY_PARAM(32)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x32 load_partial(const int8_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(int8_t dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i8x16 low(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x16 high(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x8 as_f32x8(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef int8_t victor_i8x32 __attribute__((__vector_size__(32),__aligned__(32)));
+
+        static VICTOR_INLINE victor_i8x32 victor_i8x32_from_native(__m256i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_i8x32, v);
+          #else
+            union {
+              __m256i from;
+              victor_i8x32 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m256i victor_i8x32_to_native(victor_i8x32 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m256i, v);
+          #else
+            union {
+              victor_i8x32 from;
+              __m256i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m256i victor_i8x32;
+        #define victor_i8x32_to_native(v) (v)
+        #define victor_i8x32_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_I8X32_H_DEFINE)
+    #define VICTOR_I8X32_H_DEFINE
+
+    /* Partial loads and stores; see victor_x_mm_load_partial_si128 in
+       i8x16.h.  AVX2 has no byte-granular masked moves, so without
+       AVX-512 we do each half separately. */
+    static VICTOR_INLINE __m256i victor_x_mm256_load_partial_epi8(const void* src, size_t n) {
+      #if defined(VICTOR_ENABLE_AVX512BW) && defined(VICTOR_ENABLE_AVX512VL)
+        return _mm256_maskz_loadu_epi8(HEDLEY_STATIC_CAST(__mmask32, UINT64_C(0xFFFFFFFF) >> (32 - n)), src);
+      #else
+        if (n <= 16)
+          return _mm256_castsi128_si256(victor_x_mm_load_partial_si128(src, n));
+        return _mm256_inserti128_si256(
+          _mm256_castsi128_si256(_mm_loadu_si128(HEDLEY_STATIC_CAST(const __m128i*, src))),
+          victor_x_mm_load_partial_si128(HEDLEY_STATIC_CAST(const int8_t*, src) + 16, n - 16), 1);
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm256_store_partial_epi8(void* dest, size_t n, __m256i v) {
+      #if defined(VICTOR_ENABLE_AVX512BW) && defined(VICTOR_ENABLE_AVX512VL)
+        _mm256_mask_storeu_epi8(dest, HEDLEY_STATIC_CAST(__mmask32, UINT64_C(0xFFFFFFFF) >> (32 - n)), v);
+      #else
+        if (n <= 16) {
+          victor_x_mm_store_partial_si128(dest, n, _mm256_castsi256_si128(v));
+        } else {
+          _mm_storeu_si128(HEDLEY_STATIC_CAST(__m128i*, dest), _mm256_castsi256_si128(v));
+          victor_x_mm_store_partial_si128(HEDLEY_STATIC_CAST(int8_t*, dest) + 16, n - 16, _mm256_extracti128_si256(v, 1));
+        }
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE i8x32::i8x32(__m256i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m256i i8x32::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE i8x32::i8x32(int8_t value) VICTOR_NOEXCEPT :n(_mm256_set1_epi8(value)) { };
+        VICTOR_INLINE i8x32::i8x32(int8_t  e0, int8_t  e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
+                            int8_t  e8, int8_t  e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15,
+                            int8_t e16, int8_t e17, int8_t e18, int8_t e19, int8_t e20, int8_t e21, int8_t e22, int8_t e23,
+                            int8_t e24, int8_t e25, int8_t e26, int8_t e27, int8_t e28, int8_t e29, int8_t e30, int8_t e31) VICTOR_NOEXCEPT
+          :n(_mm256_setr_epi8( e0,  e1,  e2,  e3,  e4,  e5,  e6,  e7,
+                               e8,  e9, e10, e11, e12, e13, e14, e15,
+                              e16, e17, e18, e19, e20, e21, e22, e23,
+                              e24, e25, e26, e27, e28, e29, e30, e31)) { };
+        VICTOR_INLINE i8x32::i8x32(i8x16 low, i8x16 high) VICTOR_NOEXCEPT
+          :n(_mm256_inserti128_si256(_mm256_castsi128_si256(low.to_native()), high.to_native(), 1)) { };
+        VICTOR_INLINE i8x32 i8x32::operator+(i8x32 a) const VICTOR_NOEXCEPT { return i8x32(_mm256_add_epi8(n, a.to_native())); };
+        VICTOR_INLINE i8x32 i8x32::operator&(i8x32 a) const VICTOR_NOEXCEPT { return i8x32(_mm256_and_si256(n, a.to_native())); };
+        VICTOR_INLINE i8x32 i8x32::and_not(i8x32 a) const VICTOR_NOEXCEPT { return i8x32(_mm256_andnot_si256(a.to_native(), n)); };
+        VICTOR_INLINE i8x32 i8x32::load(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) VICTOR_NOEXCEPT { return i8x32(_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, src))); }
+        VICTOR_INLINE i8x32 i8x32::load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 32);
+          return i8x32(_mm256_load_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, src)));
+        }
+        VICTOR_INLINE i8x32 i8x32::load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 32);
+          return i8x32(_mm256_stream_load_si256(HEDLEY_CONST_CAST(__m256i*, HEDLEY_REINTERPRET_CAST(const __m256i*, src))));
+        }
+        VICTOR_INLINE void i8x32::store(int8_t dest[HEDLEY_ARRAY_PARAM(32)]) const VICTOR_NOEXCEPT { _mm256_storeu_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), n); }
+        VICTOR_INLINE void i8x32::store_aligned(int8_t dest[HEDLEY_ARRAY_PARAM(32)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 32);
+          _mm256_store_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), n);
+        }
+        VICTOR_INLINE void i8x32::store_stream(int8_t dest[HEDLEY_ARRAY_PARAM(32)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 32);
+          _mm256_stream_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), n);
+        }
+        VICTOR_INLINE i8x32 i8x32::load_partial(const int8_t src[], size_t count) VICTOR_NOEXCEPT { return i8x32(victor_x_mm256_load_partial_epi8(src, VICTOR_X_PARTIAL_COUNT(count, 32))); }
+        VICTOR_INLINE void i8x32::store_partial(int8_t dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm256_store_partial_epi8(dest, VICTOR_X_PARTIAL_COUNT(count, 32), n); }
+
+        VICTOR_INLINE i8x16 i8x32::low(void) const VICTOR_NOEXCEPT { return i8x16(_mm256_castsi256_si128(n)); };
+        VICTOR_INLINE i8x16 i8x32::high(void) const VICTOR_NOEXCEPT { return i8x16(_mm256_extracti128_si256(n, 1)); };
+
+        VICTOR_INLINE f32x8 i8x32::as_f32x8(void) const VICTOR_NOEXCEPT { return f32x8(_mm256_castsi256_ps(n)); };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_add(victor_i8x32 a, victor_i8x32 b) {
+        return victor_i8x32_from_native(_mm256_add_epi8(victor_i8x32_to_native(a), victor_i8x32_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_and(victor_i8x32 a, victor_i8x32 b) {
+        return victor_i8x32_from_native(_mm256_and_si256(victor_i8x32_to_native(a), victor_i8x32_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_and_not(victor_i8x32 a, victor_i8x32 b) {
+        return victor_i8x32_from_native(_mm256_andnot_si256(victor_i8x32_to_native(b), victor_i8x32_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_set1(int8_t value) {
+        return victor_i8x32_from_native(_mm256_set1_epi8(value));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_set(int8_t  e0, int8_t  e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
+                                                  int8_t  e8, int8_t  e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15,
+                                                  int8_t e16, int8_t e17, int8_t e18, int8_t e19, int8_t e20, int8_t e21, int8_t e22, int8_t e23,
+                                                  int8_t e24, int8_t e25, int8_t e26, int8_t e27, int8_t e28, int8_t e29, int8_t e30, int8_t e31) {
+        return victor_i8x32_from_native(_mm256_setr_epi8(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15,
+                                                         e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_load(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) {
+        return victor_i8x32_from_native(_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) {
+        VICTOR_ASSERT_ALIGNED(src, 32);
+        return victor_i8x32_from_native(_mm256_load_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, src)));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(32)]) {
+        VICTOR_ASSERT_ALIGNED(src, 32);
+        return victor_i8x32_from_native(_mm256_stream_load_si256(HEDLEY_CONST_CAST(__m256i*, HEDLEY_REINTERPRET_CAST(const __m256i*, src))));
+      }
+
+      static VICTOR_INLINE void victor_i8x32_store(int8_t dest[HEDLEY_ARRAY_PARAM(32)], victor_i8x32 src) {
+        _mm256_storeu_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), victor_i8x32_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i8x32_store_aligned(int8_t dest[HEDLEY_ARRAY_PARAM(32)], victor_i8x32 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 32);
+        _mm256_store_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), victor_i8x32_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i8x32_store_stream(int8_t dest[HEDLEY_ARRAY_PARAM(32)], victor_i8x32 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 32);
+        _mm256_stream_si256(HEDLEY_REINTERPRET_CAST(__m256i*, dest), victor_i8x32_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_load_partial(const int8_t src[], size_t count) {
+        return victor_i8x32_from_native(victor_x_mm256_load_partial_epi8(src, VICTOR_X_PARTIAL_COUNT(count, 32)));
+      }
+
+      static VICTOR_INLINE void victor_i8x32_store_partial(int8_t dest[], size_t count, victor_i8x32 src) {
+        victor_x_mm256_store_partial_epi8(dest, VICTOR_X_PARTIAL_COUNT(count, 32), victor_i8x32_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x32_join(victor_i8x16 low, victor_i8x16 high) {
+        return victor_i8x32_from_native(_mm256_inserti128_si256(_mm256_castsi128_si256(victor_i8x16_to_native(low)), victor_i8x16_to_native(high), 1));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x32_low(victor_i8x32 src) {
+        return victor_i8x16_from_native(_mm256_castsi256_si128(victor_i8x32_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_i8x32_high(victor_i8x32 src) {
+        return victor_i8x16_from_native(_mm256_extracti128_si256(victor_i8x32_to_native(src), 1));
+      }
+
+      static VICTOR_INLINE victor_f32x8 victor_i8x32_as_f32x8(victor_i8x32 src) {
+        return victor_f32x8_from_native(_mm256_castsi256_ps(victor_i8x32_to_native(src)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_I8X32_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX2) */
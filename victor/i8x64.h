@@ -0,0 +1,289 @@
+/* i8x64.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX512BW)
+  #if !defined(VICTOR_I8X64_H_FORWARD_DECLARE)
+    #define VICTOR_I8X64_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i8x64;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_I8X64_H_DECLARE)
+    #define VICTOR_I8X64_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class i8x64 {
+          private:
+            __m512i n;
+
+          public:
+            VICTOR_INLINE i8x64(__m512i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m512i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x64(int8_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x64(i8x32 low, i8x32 high) VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x64 operator+(i8x64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x64 operator&(i8x64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x64 and_not(i8x64 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x64 load(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x64 load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x64 load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(int8_t values[HEDLEY_ARRAY_PARAM(64)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(int8_t values[HEDLEY_ARRAY_PARAM(64)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(int8_t values[HEDLEY_ARRAY_PARAM(64)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x64 load_partial(const int8_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(int8_t dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE mask64 operator==(i8x64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 operator!=(i8x64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 operator<(i8x64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 operator<=(i8x64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 operator>(i8x64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 operator>=(i8x64 a) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i8x64 mask_add(i8x64 src, mask64 k, i8x64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x64 maskz_add(mask64 k, i8x64 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE i8x64 load_masked(mask64 k, const int8_t src[HEDLEY_ARRAY_PARAM(64)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_masked(int8_t values[HEDLEY_ARRAY_PARAM(64)], mask64 k) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i8x32 low(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i8x32 high(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE f32x16 as_f32x16(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef int8_t victor_i8x64 __attribute__((__vector_size__(64),__aligned__(64)));
+
+        static VICTOR_INLINE victor_i8x64 victor_i8x64_from_native(__m512i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_i8x64, v);
+          #else
+            union {
+              __m512i from;
+              victor_i8x64 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m512i victor_i8x64_to_native(victor_i8x64 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m512i, v);
+          #else
+            union {
+              victor_i8x64 from;
+              __m512i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m512i victor_i8x64;
+        #define victor_i8x64_to_native(v) (v)
+        #define victor_i8x64_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_I8X64_H_DEFINE)
+    #define VICTOR_I8X64_H_DEFINE
+
+    /* The __mmask64 for the first n of 64 lanes.  1 << 64 is undefined,
+       so the shift is split in two. */
+    static VICTOR_INLINE __mmask64 victor_x_mm512_partial_mask64(size_t n) {
+      return HEDLEY_STATIC_CAST(__mmask64, ~(~UINT64_C(0) << (n / 2) << (n - n / 2)));
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE i8x64::i8x64(__m512i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m512i i8x64::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE i8x64::i8x64(int8_t value) VICTOR_NOEXCEPT :n(_mm512_set1_epi8(value)) { };
+        VICTOR_INLINE i8x64::i8x64(i8x32 low, i8x32 high) VICTOR_NOEXCEPT
+          :n(_mm512_inserti64x4(_mm512_castsi256_si512(low.to_native()), high.to_native(), 1)) { };
+        VICTOR_INLINE i8x64 i8x64::operator+(i8x64 a) const VICTOR_NOEXCEPT { return i8x64(_mm512_add_epi8(n, a.to_native())); };
+        VICTOR_INLINE i8x64 i8x64::operator&(i8x64 a) const VICTOR_NOEXCEPT { return i8x64(_mm512_and_si512(n, a.to_native())); };
+        VICTOR_INLINE i8x64 i8x64::and_not(i8x64 a) const VICTOR_NOEXCEPT { return i8x64(_mm512_andnot_si512(a.to_native(), n)); };
+        VICTOR_INLINE i8x64 i8x64::load(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) VICTOR_NOEXCEPT { return i8x64(_mm512_loadu_si512(src)); }
+        VICTOR_INLINE i8x64 i8x64::load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 64);
+          return i8x64(_mm512_load_si512(src));
+        }
+        VICTOR_INLINE i8x64 i8x64::load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 64);
+          return i8x64(_mm512_stream_load_si512(HEDLEY_CONST_CAST(int8_t*, src)));
+        }
+        VICTOR_INLINE void i8x64::store(int8_t dest[HEDLEY_ARRAY_PARAM(64)]) const VICTOR_NOEXCEPT { _mm512_storeu_si512(dest, n); }
+        VICTOR_INLINE void i8x64::store_aligned(int8_t dest[HEDLEY_ARRAY_PARAM(64)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 64);
+          _mm512_store_si512(dest, n);
+        }
+        VICTOR_INLINE void i8x64::store_stream(int8_t dest[HEDLEY_ARRAY_PARAM(64)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 64);
+          _mm512_stream_si512(HEDLEY_REINTERPRET_CAST(__m512i*, dest), n);
+        }
+        VICTOR_INLINE i8x64 i8x64::load_partial(const int8_t src[], size_t count) VICTOR_NOEXCEPT { return i8x64(_mm512_maskz_loadu_epi8(victor_x_mm512_partial_mask64(VICTOR_X_PARTIAL_COUNT(count, 64)), src)); }
+        VICTOR_INLINE void i8x64::store_partial(int8_t dest[], size_t count) const VICTOR_NOEXCEPT { _mm512_mask_storeu_epi8(dest, victor_x_mm512_partial_mask64(VICTOR_X_PARTIAL_COUNT(count, 64)), n); }
+
+        VICTOR_INLINE mask64 i8x64::operator==(i8x64 a) const VICTOR_NOEXCEPT { return mask64(_mm512_cmpeq_epi8_mask(n, a.to_native())); }
+        VICTOR_INLINE mask64 i8x64::operator!=(i8x64 a) const VICTOR_NOEXCEPT { return mask64(_mm512_cmpneq_epi8_mask(n, a.to_native())); }
+        VICTOR_INLINE mask64 i8x64::operator<(i8x64 a) const VICTOR_NOEXCEPT { return mask64(_mm512_cmplt_epi8_mask(n, a.to_native())); }
+        VICTOR_INLINE mask64 i8x64::operator<=(i8x64 a) const VICTOR_NOEXCEPT { return mask64(_mm512_cmple_epi8_mask(n, a.to_native())); }
+        VICTOR_INLINE mask64 i8x64::operator>(i8x64 a) const VICTOR_NOEXCEPT { return mask64(_mm512_cmpgt_epi8_mask(n, a.to_native())); }
+        VICTOR_INLINE mask64 i8x64::operator>=(i8x64 a) const VICTOR_NOEXCEPT { return mask64(_mm512_cmpge_epi8_mask(n, a.to_native())); }
+
+        VICTOR_INLINE i8x64 i8x64::mask_add(i8x64 src, mask64 k, i8x64 a) const VICTOR_NOEXCEPT { return i8x64(_mm512_mask_add_epi8(src.to_native(), k.to_native(), n, a.to_native())); }
+        VICTOR_INLINE i8x64 i8x64::maskz_add(mask64 k, i8x64 a) const VICTOR_NOEXCEPT { return i8x64(_mm512_maskz_add_epi8(k.to_native(), n, a.to_native())); }
+        VICTOR_INLINE i8x64 i8x64::load_masked(mask64 k, const int8_t src[HEDLEY_ARRAY_PARAM(64)]) VICTOR_NOEXCEPT { return i8x64(_mm512_maskz_loadu_epi8(k.to_native(), src)); }
+        VICTOR_INLINE void i8x64::store_masked(int8_t dest[HEDLEY_ARRAY_PARAM(64)], mask64 k) const VICTOR_NOEXCEPT { _mm512_mask_storeu_epi8(dest, k.to_native(), n); }
+
+        VICTOR_INLINE i8x32 i8x64::low(void) const VICTOR_NOEXCEPT { return i8x32(_mm512_castsi512_si256(n)); };
+        VICTOR_INLINE i8x32 i8x64::high(void) const VICTOR_NOEXCEPT { return i8x32(_mm512_extracti64x4_epi64(n, 1)); };
+
+        VICTOR_INLINE f32x16 i8x64::as_f32x16(void) const VICTOR_NOEXCEPT { return f32x16(_mm512_castsi512_ps(n)); };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_add(victor_i8x64 a, victor_i8x64 b) {
+        return victor_i8x64_from_native(_mm512_add_epi8(victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_and(victor_i8x64 a, victor_i8x64 b) {
+        return victor_i8x64_from_native(_mm512_and_si512(victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_and_not(victor_i8x64 a, victor_i8x64 b) {
+        return victor_i8x64_from_native(_mm512_andnot_si512(victor_i8x64_to_native(b), victor_i8x64_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_set1(int8_t value) {
+        return victor_i8x64_from_native(_mm512_set1_epi8(value));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_load(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) {
+        return victor_i8x64_from_native(_mm512_loadu_si512(src));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_load_aligned(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) {
+        VICTOR_ASSERT_ALIGNED(src, 64);
+        return victor_i8x64_from_native(_mm512_load_si512(src));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_load_stream(const int8_t src[HEDLEY_ARRAY_PARAM(64)]) {
+        VICTOR_ASSERT_ALIGNED(src, 64);
+        return victor_i8x64_from_native(_mm512_stream_load_si512(HEDLEY_CONST_CAST(int8_t*, src)));
+      }
+
+      static VICTOR_INLINE void victor_i8x64_store(int8_t dest[HEDLEY_ARRAY_PARAM(64)], victor_i8x64 src) {
+        _mm512_storeu_si512(dest, victor_i8x64_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i8x64_store_aligned(int8_t dest[HEDLEY_ARRAY_PARAM(64)], victor_i8x64 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 64);
+        _mm512_store_si512(dest, victor_i8x64_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_i8x64_store_stream(int8_t dest[HEDLEY_ARRAY_PARAM(64)], victor_i8x64 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 64);
+        _mm512_stream_si512(HEDLEY_REINTERPRET_CAST(__m512i*, dest), victor_i8x64_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_load_partial(const int8_t src[], size_t count) {
+        return victor_i8x64_from_native(_mm512_maskz_loadu_epi8(victor_x_mm512_partial_mask64(VICTOR_X_PARTIAL_COUNT(count, 64)), src));
+      }
+
+      static VICTOR_INLINE void victor_i8x64_store_partial(int8_t dest[], size_t count, victor_i8x64 src) {
+        _mm512_mask_storeu_epi8(dest, victor_x_mm512_partial_mask64(VICTOR_X_PARTIAL_COUNT(count, 64)), victor_i8x64_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_i8x64_cmpeq(victor_i8x64 a, victor_i8x64 b) {
+        return victor_mask64_from_native(_mm512_cmpeq_epi8_mask(victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_i8x64_cmpne(victor_i8x64 a, victor_i8x64 b) {
+        return victor_mask64_from_native(_mm512_cmpneq_epi8_mask(victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_i8x64_cmplt(victor_i8x64 a, victor_i8x64 b) {
+        return victor_mask64_from_native(_mm512_cmplt_epi8_mask(victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_i8x64_cmple(victor_i8x64 a, victor_i8x64 b) {
+        return victor_mask64_from_native(_mm512_cmple_epi8_mask(victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_i8x64_cmpgt(victor_i8x64 a, victor_i8x64 b) {
+        return victor_mask64_from_native(_mm512_cmpgt_epi8_mask(victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_i8x64_cmpge(victor_i8x64 a, victor_i8x64 b) {
+        return victor_mask64_from_native(_mm512_cmpge_epi8_mask(victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_mask_add(victor_i8x64 src, victor_mask64 k, victor_i8x64 a, victor_i8x64 b) {
+        return victor_i8x64_from_native(_mm512_mask_add_epi8(victor_i8x64_to_native(src), victor_mask64_to_native(k), victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_maskz_add(victor_mask64 k, victor_i8x64 a, victor_i8x64 b) {
+        return victor_i8x64_from_native(_mm512_maskz_add_epi8(victor_mask64_to_native(k), victor_i8x64_to_native(a), victor_i8x64_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_load_masked(victor_mask64 k, const int8_t src[HEDLEY_ARRAY_PARAM(64)]) {
+        return victor_i8x64_from_native(_mm512_maskz_loadu_epi8(victor_mask64_to_native(k), src));
+      }
+
+      static VICTOR_INLINE void victor_i8x64_store_masked(int8_t dest[HEDLEY_ARRAY_PARAM(64)], victor_mask64 k, victor_i8x64 src) {
+        _mm512_mask_storeu_epi8(dest, victor_mask64_to_native(k), victor_i8x64_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i8x64 victor_i8x64_join(victor_i8x32 low, victor_i8x32 high) {
+        return victor_i8x64_from_native(_mm512_inserti64x4(_mm512_castsi256_si512(victor_i8x32_to_native(low)), victor_i8x32_to_native(high), 1));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x64_low(victor_i8x64 src) {
+        return victor_i8x32_from_native(_mm512_castsi512_si256(victor_i8x64_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i8x32 victor_i8x64_high(victor_i8x64 src) {
+        return victor_i8x32_from_native(_mm512_extracti64x4_epi64(victor_i8x64_to_native(src), 1));
+      }
+
+      static VICTOR_INLINE victor_f32x16 victor_i8x64_as_f32x16(victor_i8x64 src) {
+        return victor_f32x16_from_native(_mm512_castsi512_ps(victor_i8x64_to_native(src)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_I8X64_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX512BW) */
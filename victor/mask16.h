@@ -0,0 +1,131 @@
+/* mask16.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX512F)
+  #if !defined(VICTOR_MASK16_H_FORWARD_DECLARE)
+    #define VICTOR_MASK16_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class mask16;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_MASK16_H_DECLARE)
+    #define VICTOR_MASK16_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class mask16 {
+          private:
+            __mmask16 n;
+
+          public:
+            VICTOR_INLINE mask16(__mmask16 value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __mmask16 to_native(void) const VICTOR_NOEXCEPT;
+
+            static VICTOR_INLINE mask16 first(size_t count) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE mask16 operator&(mask16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator|(mask16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator^(mask16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 operator~(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask16 and_not(mask16 a) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE bool any(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE bool all(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE bool none(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      typedef __mmask16 victor_mask16;
+      #define victor_mask16_to_native(v) (v)
+      #define victor_mask16_from_native(v) (v)
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_MASK16_H_DEFINE)
+    #define VICTOR_MASK16_H_DEFINE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE mask16::mask16(__mmask16 value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __mmask16 mask16::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE mask16 mask16::first(size_t count) VICTOR_NOEXCEPT {
+          return mask16(HEDLEY_STATIC_CAST(__mmask16, (count >= 16) ? 0xFFFF : ((1U << count) - 1)));
+        }
+        VICTOR_INLINE mask16 mask16::operator&(mask16 a) const VICTOR_NOEXCEPT { return mask16(HEDLEY_STATIC_CAST(__mmask16, n & a.to_native())); };
+        VICTOR_INLINE mask16 mask16::operator|(mask16 a) const VICTOR_NOEXCEPT { return mask16(HEDLEY_STATIC_CAST(__mmask16, n | a.to_native())); };
+        VICTOR_INLINE mask16 mask16::operator^(mask16 a) const VICTOR_NOEXCEPT { return mask16(HEDLEY_STATIC_CAST(__mmask16, n ^ a.to_native())); };
+        VICTOR_INLINE mask16 mask16::operator~(void) const VICTOR_NOEXCEPT { return mask16(HEDLEY_STATIC_CAST(__mmask16, ~n)); };
+        VICTOR_INLINE mask16 mask16::and_not(mask16 a) const VICTOR_NOEXCEPT { return mask16(HEDLEY_STATIC_CAST(__mmask16, n & ~a.to_native())); };
+        VICTOR_INLINE bool mask16::any(void) const VICTOR_NOEXCEPT { return n != 0; }
+        VICTOR_INLINE bool mask16::all(void) const VICTOR_NOEXCEPT { return n == 0xFFFF; }
+        VICTOR_INLINE bool mask16::none(void) const VICTOR_NOEXCEPT { return n == 0; }
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_mask16 victor_mask16_first(size_t count) {
+        return HEDLEY_STATIC_CAST(victor_mask16, (count >= 16) ? 0xFFFF : ((1U << count) - 1));
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_mask16_and(victor_mask16 a, victor_mask16 b) {
+        return HEDLEY_STATIC_CAST(victor_mask16, a & b);
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_mask16_or(victor_mask16 a, victor_mask16 b) {
+        return HEDLEY_STATIC_CAST(victor_mask16, a | b);
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_mask16_xor(victor_mask16 a, victor_mask16 b) {
+        return HEDLEY_STATIC_CAST(victor_mask16, a ^ b);
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_mask16_not(victor_mask16 a) {
+        return HEDLEY_STATIC_CAST(victor_mask16, ~a);
+      }
+
+      static VICTOR_INLINE victor_mask16 victor_mask16_and_not(victor_mask16 a, victor_mask16 b) {
+        return HEDLEY_STATIC_CAST(victor_mask16, a & ~b);
+      }
+
+      static VICTOR_INLINE int victor_mask16_any(victor_mask16 a) {
+        return a != 0;
+      }
+
+      static VICTOR_INLINE int victor_mask16_all(victor_mask16 a) {
+        return a == 0xFFFF;
+      }
+
+      static VICTOR_INLINE int victor_mask16_none(victor_mask16 a) {
+        return a == 0;
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_MASK16_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX512F) */
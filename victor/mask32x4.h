@@ -0,0 +1,174 @@
+/* mask32x4.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+/* Result of comparing two f32x4s or i32x4s.  Each lane is either all
+   ones (true) or all zeros (false). */
+
+#if defined(VICTOR_ENABLE_SSE2)
+  #if !defined(VICTOR_MASK32X4_H_FORWARD_DECLARE)
+    #define VICTOR_MASK32X4_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class mask32x4;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_MASK32X4_H_DECLARE)
+    #define VICTOR_MASK32X4_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class mask32x4 {
+          private:
+            __m128i n;
+
+          public:
+            VICTOR_INLINE mask32x4(__m128i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128i to_native(void) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE mask32x4 operator&(mask32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 operator|(mask32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 operator^(mask32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 operator~(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask32x4 and_not(mask32x4 a) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE int movemask(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE bool any(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE bool all(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE bool none(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      /* A struct rather than a vector, so passing an integer vector
+         where a mask is expected (or the other way around) is an
+         error in C too.  It is still passed in a register. */
+      typedef struct {
+        __m128i n;
+      } victor_mask32x4;
+
+      static VICTOR_INLINE victor_mask32x4 victor_mask32x4_from_native(__m128i v) {
+        victor_mask32x4 r;
+        r.n = v;
+        return r;
+      }
+
+      static VICTOR_INLINE __m128i victor_mask32x4_to_native(victor_mask32x4 v) {
+        return v.n;
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_MASK32X4_H_DEFINE)
+    #define VICTOR_MASK32X4_H_DEFINE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE mask32x4::mask32x4(__m128i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128i mask32x4::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE mask32x4 mask32x4::operator&(mask32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_and_si128(n, a.to_native())); };
+        VICTOR_INLINE mask32x4 mask32x4::operator|(mask32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_or_si128(n, a.to_native())); };
+        VICTOR_INLINE mask32x4 mask32x4::operator^(mask32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_xor_si128(n, a.to_native())); };
+        VICTOR_INLINE mask32x4 mask32x4::operator~(void) const VICTOR_NOEXCEPT { return mask32x4(_mm_xor_si128(n, _mm_set1_epi32(-1))); };
+        VICTOR_INLINE mask32x4 mask32x4::and_not(mask32x4 a) const VICTOR_NOEXCEPT { return mask32x4(_mm_andnot_si128(a.to_native(), n)); };
+        VICTOR_INLINE int mask32x4::movemask(void) const VICTOR_NOEXCEPT { return _mm_movemask_ps(_mm_castsi128_ps(n)); }
+        VICTOR_INLINE bool mask32x4::any(void) const VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return !_mm_testz_si128(n, n);
+          #else
+            return movemask() != 0;
+          #endif
+        }
+        VICTOR_INLINE bool mask32x4::all(void) const VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return _mm_test_all_ones(n) != 0;
+          #else
+            return movemask() == 0xF;
+          #endif
+        }
+        VICTOR_INLINE bool mask32x4::none(void) const VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return _mm_testz_si128(n, n) != 0;
+          #else
+            return movemask() == 0;
+          #endif
+        }
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_mask32x4 victor_mask32x4_and(victor_mask32x4 a, victor_mask32x4 b) {
+        return victor_mask32x4_from_native(_mm_and_si128(victor_mask32x4_to_native(a), victor_mask32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_mask32x4_or(victor_mask32x4 a, victor_mask32x4 b) {
+        return victor_mask32x4_from_native(_mm_or_si128(victor_mask32x4_to_native(a), victor_mask32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_mask32x4_xor(victor_mask32x4 a, victor_mask32x4 b) {
+        return victor_mask32x4_from_native(_mm_xor_si128(victor_mask32x4_to_native(a), victor_mask32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_mask32x4_not(victor_mask32x4 a) {
+        return victor_mask32x4_from_native(_mm_xor_si128(victor_mask32x4_to_native(a), _mm_set1_epi32(-1)));
+      }
+
+      static VICTOR_INLINE victor_mask32x4 victor_mask32x4_and_not(victor_mask32x4 a, victor_mask32x4 b) {
+        return victor_mask32x4_from_native(_mm_andnot_si128(victor_mask32x4_to_native(b), victor_mask32x4_to_native(a)));
+      }
+
+      static VICTOR_INLINE int victor_mask32x4_movemask(victor_mask32x4 a) {
+        return _mm_movemask_ps(_mm_castsi128_ps(victor_mask32x4_to_native(a)));
+      }
+
+      static VICTOR_INLINE int victor_mask32x4_any(victor_mask32x4 a) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return !_mm_testz_si128(victor_mask32x4_to_native(a), victor_mask32x4_to_native(a));
+        #else
+          return victor_mask32x4_movemask(a) != 0;
+        #endif
+      }
+
+      static VICTOR_INLINE int victor_mask32x4_all(victor_mask32x4 a) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return _mm_test_all_ones(victor_mask32x4_to_native(a)) != 0;
+        #else
+          return victor_mask32x4_movemask(a) == 0xF;
+        #endif
+      }
+
+      static VICTOR_INLINE int victor_mask32x4_none(victor_mask32x4 a) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return _mm_testz_si128(victor_mask32x4_to_native(a), victor_mask32x4_to_native(a)) != 0;
+        #else
+          return victor_mask32x4_movemask(a) == 0;
+        #endif
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_MASK32X4_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_SSE2) */
@@ -0,0 +1,131 @@
+/* mask64.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_AVX512BW)
+  #if !defined(VICTOR_MASK64_H_FORWARD_DECLARE)
+    #define VICTOR_MASK64_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class mask64;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_MASK64_H_DECLARE)
+    #define VICTOR_MASK64_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class mask64 {
+          private:
+            __mmask64 n;
+
+          public:
+            VICTOR_INLINE mask64(__mmask64 value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE __mmask64 to_native(void) const VICTOR_NOEXCEPT;
+
+            static VICTOR_INLINE mask64 first(size_t count) VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE mask64 operator&(mask64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 operator|(mask64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 operator^(mask64 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 operator~(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE mask64 and_not(mask64 a) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE bool any(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE bool all(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE bool none(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      typedef __mmask64 victor_mask64;
+      #define victor_mask64_to_native(v) (v)
+      #define victor_mask64_from_native(v) (v)
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_MASK64_H_DEFINE)
+    #define VICTOR_MASK64_H_DEFINE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE mask64::mask64(__mmask64 value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __mmask64 mask64::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE mask64 mask64::first(size_t count) VICTOR_NOEXCEPT {
+          return mask64(HEDLEY_STATIC_CAST(__mmask64, (count >= 64) ? UINT64_C(0xFFFFFFFFFFFFFFFF) : ((UINT64_C(1) << count) - 1)));
+        }
+        VICTOR_INLINE mask64 mask64::operator&(mask64 a) const VICTOR_NOEXCEPT { return mask64(HEDLEY_STATIC_CAST(__mmask64, n & a.to_native())); };
+        VICTOR_INLINE mask64 mask64::operator|(mask64 a) const VICTOR_NOEXCEPT { return mask64(HEDLEY_STATIC_CAST(__mmask64, n | a.to_native())); };
+        VICTOR_INLINE mask64 mask64::operator^(mask64 a) const VICTOR_NOEXCEPT { return mask64(HEDLEY_STATIC_CAST(__mmask64, n ^ a.to_native())); };
+        VICTOR_INLINE mask64 mask64::operator~(void) const VICTOR_NOEXCEPT { return mask64(HEDLEY_STATIC_CAST(__mmask64, ~n)); };
+        VICTOR_INLINE mask64 mask64::and_not(mask64 a) const VICTOR_NOEXCEPT { return mask64(HEDLEY_STATIC_CAST(__mmask64, n & ~a.to_native())); };
+        VICTOR_INLINE bool mask64::any(void) const VICTOR_NOEXCEPT { return n != 0; }
+        VICTOR_INLINE bool mask64::all(void) const VICTOR_NOEXCEPT { return n == UINT64_C(0xFFFFFFFFFFFFFFFF); }
+        VICTOR_INLINE bool mask64::none(void) const VICTOR_NOEXCEPT { return n == 0; }
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_mask64 victor_mask64_first(size_t count) {
+        return HEDLEY_STATIC_CAST(victor_mask64, (count >= 64) ? UINT64_C(0xFFFFFFFFFFFFFFFF) : ((UINT64_C(1) << count) - 1));
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_mask64_and(victor_mask64 a, victor_mask64 b) {
+        return HEDLEY_STATIC_CAST(victor_mask64, a & b);
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_mask64_or(victor_mask64 a, victor_mask64 b) {
+        return HEDLEY_STATIC_CAST(victor_mask64, a | b);
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_mask64_xor(victor_mask64 a, victor_mask64 b) {
+        return HEDLEY_STATIC_CAST(victor_mask64, a ^ b);
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_mask64_not(victor_mask64 a) {
+        return HEDLEY_STATIC_CAST(victor_mask64, ~a);
+      }
+
+      static VICTOR_INLINE victor_mask64 victor_mask64_and_not(victor_mask64 a, victor_mask64 b) {
+        return HEDLEY_STATIC_CAST(victor_mask64, a & ~b);
+      }
+
+      static VICTOR_INLINE int victor_mask64_any(victor_mask64 a) {
+        return a != 0;
+      }
+
+      static VICTOR_INLINE int victor_mask64_all(victor_mask64 a) {
+        return a == UINT64_C(0xFFFFFFFFFFFFFFFF);
+      }
+
+      static VICTOR_INLINE int victor_mask64_none(victor_mask64 a) {
+        return a == 0;
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_MASK64_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_AVX512BW) */
@@ -0,0 +1,923 @@
+/* shuffle.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+/* Shuffles with compile-time indices.
+ *
+ * In C++, Victor::shuffle<I0, I1, ...>(v) rearranges the lanes of v,
+ * and Victor::shuffle<I0, I1, ...>(a, b) picks lanes from a (indices
+ * 0 through N - 1) and b (N through 2N - 1).  The index pattern is
+ * inspected at compile time to pick the cheapest instruction which can
+ * implement it (pshufd, shufps, unpck*, palignr, blend, pshufb, etc.)
+ * for the available ISA extensions, so you don't have to.
+ *
+ * In C, victor_T_shuffle(v, ...) and victor_T_shuffle2(a, b, ...) are
+ * macros which hand the pattern to the compiler's shuffle builtin when
+ * one is available; GCC and clang both do the same kind of instruction
+ * selection themselves.  Otherwise they fall back on a single shufps or
+ * pshufd where possible, or a (slow) generic implementation. */
+
+#if !defined(VICTOR_SHUFFLE_H)
+#define VICTOR_SHUFFLE_H
+
+#if defined(VICTOR_ENABLE_CXX_API) && defined(VICTOR_ENABLE_SSE2)
+  VICTOR_X_BEGIN_NAMESPACE
+    namespace shuffle_detail {
+      enum {
+        KIND_IDENTITY,
+        KIND_SHUFPS,
+        KIND_PERMILPS,
+        KIND_MOVELH,
+        KIND_MOVEHL,
+        KIND_UNPACKLO,
+        KIND_UNPACKHI,
+        KIND_MOVELDUP,
+        KIND_MOVEHDUP,
+        KIND_PSHUFD,
+        KIND_PSHUFLW,
+        KIND_PSHUFHW,
+        KIND_ROTATE,
+        KIND_PSHUFB,
+        KIND_SCALAR
+      };
+
+      enum {
+        KIND2_A,
+        KIND2_B,
+        KIND2_UNPACKLO_AB,
+        KIND2_UNPACKLO_BA,
+        KIND2_UNPACKHI_AB,
+        KIND2_UNPACKHI_BA,
+        KIND2_MOVELH_AB,
+        KIND2_MOVELH_BA,
+        KIND2_MOVEHL_AB,
+        KIND2_MOVEHL_BA,
+        KIND2_MOVSS_AB,
+        KIND2_MOVSS_BA,
+        KIND2_BLEND,
+        KIND2_ALIGNR_AB,
+        KIND2_ALIGNR_BA,
+        KIND2_SHUFPS_AB,
+        KIND2_SHUFPS_BA,
+        KIND2_TWO_SHUFPS,
+        KIND2_BLEND_SHUFFLES,
+        KIND2_PSHUFB,
+        KIND2_SCALAR
+      };
+
+      /* 4 x 32-bit lanes, for f32x4 and i32x4. */
+
+      template <int I0, int I1, int I2, int I3>
+      struct lanes4 {
+        enum {
+          in_range1 = (I0 >= 0 && I0 < 4 && I1 >= 0 && I1 < 4 && I2 >= 0 && I2 < 4 && I3 >= 0 && I3 < 4),
+          in_range2 = (I0 >= 0 && I0 < 8 && I1 >= 0 && I1 < 8 && I2 >= 0 && I2 < 8 && I3 >= 0 && I3 < 8),
+          imm = ((I3 & 3) << 6) | ((I2 & 3) << 4) | ((I1 & 3) << 2) | (I0 & 3),
+          from_b = ((I0 >= 4) << 0) | ((I1 >= 4) << 1) | ((I2 >= 4) << 2) | ((I3 >= 4) << 3),
+          from_a_count = (I0 < 4) + (I1 < 4) + (I2 < 4) + (I3 < 4),
+          in_place = ((I0 & 3) == 0 && (I1 & 3) == 1 && (I2 & 3) == 2 && (I3 & 3) == 3),
+          consecutive = (((I0 + 1) & 7) == I1 && ((I0 + 2) & 7) == I2 && ((I0 + 3) & 7) == I3)
+        };
+      };
+
+      template <int K, int I0, int I1, int I2, int I3>
+      struct lane4 {
+        enum { value = (K == 0) ? I0 : ((K == 1) ? I1 : ((K == 2) ? I2 : I3)) };
+      };
+
+      template <int I0, int I1, int I2, int I3>
+      struct f32x4_kind {
+        enum {
+          value =
+            (I0 == 0 && I1 == 1 && I2 == 2 && I3 == 3) ? KIND_IDENTITY :
+            (I0 == 0 && I1 == 1 && I2 == 0 && I3 == 1) ? KIND_MOVELH :
+            (I0 == 2 && I1 == 3 && I2 == 2 && I3 == 3) ? KIND_MOVEHL :
+            (I0 == 0 && I1 == 0 && I2 == 1 && I3 == 1) ? KIND_UNPACKLO :
+            (I0 == 2 && I1 == 2 && I2 == 3 && I3 == 3) ? KIND_UNPACKHI :
+            #if defined(VICTOR_ENABLE_SSE3)
+            (I0 == 0 && I1 == 0 && I2 == 2 && I3 == 2) ? KIND_MOVELDUP :
+            (I0 == 1 && I1 == 1 && I2 == 3 && I3 == 3) ? KIND_MOVEHDUP :
+            #endif
+            #if defined(VICTOR_ENABLE_AVX)
+            KIND_PERMILPS
+            #else
+            KIND_SHUFPS
+            #endif
+        };
+      };
+
+      template <int Kind, int Imm> struct f32x4_shuffle;
+      template <int Imm> struct f32x4_shuffle<KIND_IDENTITY, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return v; } };
+      template <int Imm> struct f32x4_shuffle<KIND_MOVELH, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return _mm_movelh_ps(v, v); } };
+      template <int Imm> struct f32x4_shuffle<KIND_MOVEHL, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return _mm_movehl_ps(v, v); } };
+      template <int Imm> struct f32x4_shuffle<KIND_UNPACKLO, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return _mm_unpacklo_ps(v, v); } };
+      template <int Imm> struct f32x4_shuffle<KIND_UNPACKHI, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return _mm_unpackhi_ps(v, v); } };
+      #if defined(VICTOR_ENABLE_SSE3)
+        template <int Imm> struct f32x4_shuffle<KIND_MOVELDUP, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return _mm_moveldup_ps(v); } };
+        template <int Imm> struct f32x4_shuffle<KIND_MOVEHDUP, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return _mm_movehdup_ps(v); } };
+      #endif
+      #if defined(VICTOR_ENABLE_AVX)
+        template <int Imm> struct f32x4_shuffle<KIND_PERMILPS, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return _mm_permute_ps(v, Imm); } };
+      #endif
+      template <int Imm> struct f32x4_shuffle<KIND_SHUFPS, Imm> { static VICTOR_INLINE __m128 apply(__m128 v) VICTOR_NOEXCEPT { return _mm_shuffle_ps(v, v, Imm); } };
+
+      /* pshufd can do any single-source pattern in one instruction
+         without clobbering its input, so there is nothing to choose. */
+      template <int I0, int I1, int I2, int I3>
+      struct i32x4_kind {
+        enum { value = (I0 == 0 && I1 == 1 && I2 == 2 && I3 == 3) ? KIND_IDENTITY : KIND_PSHUFD };
+      };
+
+      template <int Kind, int Imm> struct i32x4_shuffle;
+      template <int Imm> struct i32x4_shuffle<KIND_IDENTITY, Imm> { static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT { return v; } };
+      template <int Imm> struct i32x4_shuffle<KIND_PSHUFD, Imm> { static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT { return _mm_shuffle_epi32(v, Imm); } };
+
+      /* Two-source patterns are the same for f32x4 and i32x4, except
+         that palignr only makes sense for integers. */
+      template <bool Integer, int I0, int I1, int I2, int I3>
+      struct lanes4_kind2 {
+        typedef lanes4<I0, I1, I2, I3> l;
+        enum {
+          value =
+            (l::from_a_count == 4) ? KIND2_A :
+            (l::from_a_count == 0) ? KIND2_B :
+            (I0 == 0 && I1 == 4 && I2 == 1 && I3 == 5) ? KIND2_UNPACKLO_AB :
+            (I0 == 4 && I1 == 0 && I2 == 5 && I3 == 1) ? KIND2_UNPACKLO_BA :
+            (I0 == 2 && I1 == 6 && I2 == 3 && I3 == 7) ? KIND2_UNPACKHI_AB :
+            (I0 == 6 && I1 == 2 && I2 == 7 && I3 == 3) ? KIND2_UNPACKHI_BA :
+            (I0 == 0 && I1 == 1 && I2 == 4 && I3 == 5) ? KIND2_MOVELH_AB :
+            (I0 == 4 && I1 == 5 && I2 == 0 && I3 == 1) ? KIND2_MOVELH_BA :
+            (I0 == 2 && I1 == 3 && I2 == 6 && I3 == 7) ? KIND2_MOVEHL_AB :
+            (I0 == 6 && I1 == 7 && I2 == 2 && I3 == 3) ? KIND2_MOVEHL_BA :
+            #if defined(VICTOR_ENABLE_SSE4_1)
+            (l::in_place) ? KIND2_BLEND :
+            #else
+            (l::in_place && l::from_b == 0x1) ? KIND2_MOVSS_AB :
+            (l::in_place && l::from_b == 0xE) ? KIND2_MOVSS_BA :
+            #endif
+            #if defined(VICTOR_ENABLE_SSSE3)
+            (Integer && l::consecutive && I0 < 4) ? KIND2_ALIGNR_AB :
+            (Integer && l::consecutive && I0 >= 4) ? KIND2_ALIGNR_BA :
+            #endif
+            (I0 < 4 && I1 < 4 && I2 >= 4 && I3 >= 4) ? KIND2_SHUFPS_AB :
+            (I0 >= 4 && I1 >= 4 && I2 < 4 && I3 < 4) ? KIND2_SHUFPS_BA :
+            (l::from_a_count == 2) ? KIND2_TWO_SHUFPS :
+            KIND2_BLEND_SHUFFLES
+        };
+      };
+
+      /* Lanes of the result, split by source.  Used when exactly two
+         lanes come from each source: one shufps gathers the four
+         lanes, another puts them in order. */
+      template <int I0, int I1, int I2, int I3>
+      struct lanes4_split {
+        enum {
+          a0 = (I0 < 4) ? 0 : ((I1 < 4) ? 1 : ((I2 < 4) ? 2 : 3)),
+          a1 = (I3 < 4) ? 3 : ((I2 < 4) ? 2 : ((I1 < 4) ? 1 : 0)),
+          b0 = (I0 >= 4) ? 0 : ((I1 >= 4) ? 1 : ((I2 >= 4) ? 2 : 3)),
+          b1 = (I3 >= 4) ? 3 : ((I2 >= 4) ? 2 : ((I1 >= 4) ? 1 : 0)),
+          gather =
+            ((lane4<a0, I0, I1, I2, I3>::value & 3) << 0) |
+            ((lane4<a1, I0, I1, I2, I3>::value & 3) << 2) |
+            ((lane4<b0, I0, I1, I2, I3>::value & 3) << 4) |
+            ((lane4<b1, I0, I1, I2, I3>::value & 3) << 6),
+          p0 = (a0 == 0) ? 0 : ((a1 == 0) ? 1 : ((b0 == 0) ? 2 : 3)),
+          p1 = (a0 == 1) ? 0 : ((a1 == 1) ? 1 : ((b0 == 1) ? 2 : 3)),
+          p2 = (a0 == 2) ? 0 : ((a1 == 2) ? 1 : ((b0 == 2) ? 2 : 3)),
+          p3 = (a0 == 3) ? 0 : ((a1 == 3) ? 1 : ((b0 == 3) ? 2 : 3)),
+          order = (p3 << 6) | (p2 << 4) | (p1 << 2) | p0
+        };
+      };
+
+      template <int Kind, int I0, int I1, int I2, int I3> struct f32x4_shuffle2;
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_A, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          (void) b;
+          return f32x4_shuffle<f32x4_kind<(I0 & 3), (I1 & 3), (I2 & 3), (I3 & 3)>::value, lanes4<I0, I1, I2, I3>::imm>::apply(a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_B, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          (void) a;
+          return f32x4_shuffle<f32x4_kind<(I0 & 3), (I1 & 3), (I2 & 3), (I3 & 3)>::value, lanes4<I0, I1, I2, I3>::imm>::apply(b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_UNPACKLO_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_ps(a, b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_UNPACKLO_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_ps(b, a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_UNPACKHI_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_ps(a, b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_UNPACKHI_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_ps(b, a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_MOVELH_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_movelh_ps(a, b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_MOVELH_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_movelh_ps(b, a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_MOVEHL_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_movehl_ps(b, a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_MOVEHL_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_movehl_ps(a, b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_SHUFPS_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_shuffle_ps(a, b, (lanes4<I0, I1, I2, I3>::imm));
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_SHUFPS_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          return _mm_shuffle_ps(b, a, (lanes4<I0, I1, I2, I3>::imm));
+        }
+      };
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_BLEND, I0, I1, I2, I3> {
+          static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+            return _mm_blend_ps(a, b, (lanes4<I0, I1, I2, I3>::from_b));
+          }
+        };
+      #else
+        template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_MOVSS_AB, I0, I1, I2, I3> {
+          static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+            return _mm_move_ss(a, b);
+          }
+        };
+        template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_MOVSS_BA, I0, I1, I2, I3> {
+          static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+            return _mm_move_ss(b, a);
+          }
+        };
+      #endif
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_TWO_SHUFPS, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          typedef lanes4_split<I0, I1, I2, I3> s;
+          const __m128 t = _mm_shuffle_ps(a, b, s::gather);
+          return _mm_shuffle_ps(t, t, s::order);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct f32x4_shuffle2<KIND2_BLEND_SHUFFLES, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128 apply(__m128 a, __m128 b) VICTOR_NOEXCEPT {
+          const __m128 sa = f32x4_shuffle<f32x4_kind<(I0 & 3), (I1 & 3), (I2 & 3), (I3 & 3)>::value, lanes4<I0, I1, I2, I3>::imm>::apply(a);
+          const __m128 sb = f32x4_shuffle<f32x4_kind<(I0 & 3), (I1 & 3), (I2 & 3), (I3 & 3)>::value, lanes4<I0, I1, I2, I3>::imm>::apply(b);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return _mm_blend_ps(sa, sb, (lanes4<I0, I1, I2, I3>::from_b));
+          #else
+            const __m128 m = _mm_castsi128_ps(_mm_setr_epi32(-(I0 >= 4), -(I1 >= 4), -(I2 >= 4), -(I3 >= 4)));
+            return _mm_or_ps(_mm_andnot_ps(m, sa), _mm_and_ps(m, sb));
+          #endif
+        }
+      };
+
+      template <int Kind, int I0, int I1, int I2, int I3> struct i32x4_shuffle2;
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_A, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          (void) b;
+          return i32x4_shuffle<i32x4_kind<(I0 & 3), (I1 & 3), (I2 & 3), (I3 & 3)>::value, lanes4<I0, I1, I2, I3>::imm>::apply(a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_B, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          (void) a;
+          return i32x4_shuffle<i32x4_kind<(I0 & 3), (I1 & 3), (I2 & 3), (I3 & 3)>::value, lanes4<I0, I1, I2, I3>::imm>::apply(b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_UNPACKLO_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_epi32(a, b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_UNPACKLO_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_epi32(b, a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_UNPACKHI_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_epi32(a, b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_UNPACKHI_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_epi32(b, a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_MOVELH_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_epi64(a, b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_MOVELH_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_epi64(b, a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_MOVEHL_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_epi64(a, b);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_MOVEHL_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_epi64(b, a);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_SHUFPS_AB, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), (lanes4<I0, I1, I2, I3>::imm)));
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_SHUFPS_BA, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(b), _mm_castsi128_ps(a), (lanes4<I0, I1, I2, I3>::imm)));
+        }
+      };
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_BLEND, I0, I1, I2, I3> {
+          static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+            return _mm_blend_epi16(a, b,
+              ((lanes4<I0, I1, I2, I3>::from_b & 1) * 0x03) | ((lanes4<I0, I1, I2, I3>::from_b & 2) * 0x06) |
+              ((lanes4<I0, I1, I2, I3>::from_b & 4) * 0x0C) | ((lanes4<I0, I1, I2, I3>::from_b & 8) * 0x18));
+          }
+        };
+      #else
+        template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_MOVSS_AB, I0, I1, I2, I3> {
+          static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+            return _mm_castps_si128(_mm_move_ss(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+          }
+        };
+        template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_MOVSS_BA, I0, I1, I2, I3> {
+          static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+            return _mm_castps_si128(_mm_move_ss(_mm_castsi128_ps(b), _mm_castsi128_ps(a)));
+          }
+        };
+      #endif
+      #if defined(VICTOR_ENABLE_SSSE3)
+        template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_ALIGNR_AB, I0, I1, I2, I3> {
+          static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+            return _mm_alignr_epi8(b, a, (I0 & 3) * 4);
+          }
+        };
+        template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_ALIGNR_BA, I0, I1, I2, I3> {
+          static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+            return _mm_alignr_epi8(a, b, (I0 & 3) * 4);
+          }
+        };
+      #endif
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_TWO_SHUFPS, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          typedef lanes4_split<I0, I1, I2, I3> s;
+          const __m128i t = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), s::gather));
+          return _mm_shuffle_epi32(t, s::order);
+        }
+      };
+      template <int I0, int I1, int I2, int I3> struct i32x4_shuffle2<KIND2_BLEND_SHUFFLES, I0, I1, I2, I3> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          const __m128i sa = i32x4_shuffle<i32x4_kind<(I0 & 3), (I1 & 3), (I2 & 3), (I3 & 3)>::value, lanes4<I0, I1, I2, I3>::imm>::apply(a);
+          const __m128i sb = i32x4_shuffle<i32x4_kind<(I0 & 3), (I1 & 3), (I2 & 3), (I3 & 3)>::value, lanes4<I0, I1, I2, I3>::imm>::apply(b);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return _mm_blend_epi16(sa, sb,
+              ((lanes4<I0, I1, I2, I3>::from_b & 1) * 0x03) | ((lanes4<I0, I1, I2, I3>::from_b & 2) * 0x06) |
+              ((lanes4<I0, I1, I2, I3>::from_b & 4) * 0x0C) | ((lanes4<I0, I1, I2, I3>::from_b & 8) * 0x18));
+          #else
+            const __m128i m = _mm_setr_epi32(-(I0 >= 4), -(I1 >= 4), -(I2 >= 4), -(I3 >= 4));
+            return _mm_or_si128(_mm_andnot_si128(m, sa), _mm_and_si128(m, sb));
+          #endif
+        }
+      };
+
+      /* 16 x 8-bit lanes, for i8x16. */
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15>
+      struct lanes16 {
+        enum {
+          in_range1 =
+            ((I0 >= 0 && I0 < 16) && (I1 >= 0 && I1 < 16) && (I2 >= 0 && I2 < 16) && (I3 >= 0 && I3 < 16) &&
+            (I4 >= 0 && I4 < 16) && (I5 >= 0 && I5 < 16) && (I6 >= 0 && I6 < 16) && (I7 >= 0 && I7 < 16) &&
+            (I8 >= 0 && I8 < 16) && (I9 >= 0 && I9 < 16) && (I10 >= 0 && I10 < 16) && (I11 >= 0 && I11 < 16) &&
+            (I12 >= 0 && I12 < 16) && (I13 >= 0 && I13 < 16) && (I14 >= 0 && I14 < 16) && (I15 >= 0 && I15 < 16)),
+          in_range2 =
+            ((I0 >= 0 && I0 < 32) && (I1 >= 0 && I1 < 32) && (I2 >= 0 && I2 < 32) && (I3 >= 0 && I3 < 32) &&
+            (I4 >= 0 && I4 < 32) && (I5 >= 0 && I5 < 32) && (I6 >= 0 && I6 < 32) && (I7 >= 0 && I7 < 32) &&
+            (I8 >= 0 && I8 < 32) && (I9 >= 0 && I9 < 32) && (I10 >= 0 && I10 < 32) && (I11 >= 0 && I11 < 32) &&
+            (I12 >= 0 && I12 < 32) && (I13 >= 0 && I13 < 32) && (I14 >= 0 && I14 < 32) && (I15 >= 0 && I15 < 32)),
+          identity =
+            ((I0 == 0) && (I1 == 1) && (I2 == 2) && (I3 == 3) &&
+            (I4 == 4) && (I5 == 5) && (I6 == 6) && (I7 == 7) &&
+            (I8 == 8) && (I9 == 9) && (I10 == 10) && (I11 == 11) &&
+            (I12 == 12) && (I13 == 13) && (I14 == 14) && (I15 == 15)),
+          all_a =
+            ((I0 < 16) && (I1 < 16) && (I2 < 16) && (I3 < 16) &&
+            (I4 < 16) && (I5 < 16) && (I6 < 16) && (I7 < 16) &&
+            (I8 < 16) && (I9 < 16) && (I10 < 16) && (I11 < 16) &&
+            (I12 < 16) && (I13 < 16) && (I14 < 16) && (I15 < 16)),
+          all_b =
+            ((I0 >= 16) && (I1 >= 16) && (I2 >= 16) && (I3 >= 16) &&
+            (I4 >= 16) && (I5 >= 16) && (I6 >= 16) && (I7 >= 16) &&
+            (I8 >= 16) && (I9 >= 16) && (I10 >= 16) && (I11 >= 16) &&
+            (I12 >= 16) && (I13 >= 16) && (I14 >= 16) && (I15 >= 16)),
+          in_place =
+            (((I0 & 15) == 0) && ((I1 & 15) == 1) && ((I2 & 15) == 2) && ((I3 & 15) == 3) &&
+            ((I4 & 15) == 4) && ((I5 & 15) == 5) && ((I6 & 15) == 6) && ((I7 & 15) == 7) &&
+            ((I8 & 15) == 8) && ((I9 & 15) == 9) && ((I10 & 15) == 10) && ((I11 & 15) == 11) &&
+            ((I12 & 15) == 12) && ((I13 & 15) == 13) && ((I14 & 15) == 14) && ((I15 & 15) == 15)),
+          dwords =
+            (((I0 & 3) == 0 && I1 == I0 + 1 && I2 == I0 + 2 && I3 == I0 + 3) &&
+            ((I4 & 3) == 0 && I5 == I4 + 1 && I6 == I4 + 2 && I7 == I4 + 3) &&
+            ((I8 & 3) == 0 && I9 == I8 + 1 && I10 == I8 + 2 && I11 == I8 + 3) &&
+            ((I12 & 3) == 0 && I13 == I12 + 1 && I14 == I12 + 2 && I15 == I12 + 3)),
+          dwords_imm =
+            ((((I0 >> 2) & 3) << 0) | (((I4 >> 2) & 3) << 2) | (((I8 >> 2) & 3) << 4) | (((I12 >> 2) & 3) << 6)),
+          low_words =
+            (((I0 & 1) == 0 && I0 < 8 && I1 == I0 + 1) && ((I2 & 1) == 0 && I2 < 8 && I3 == I2 + 1) &&
+            ((I4 & 1) == 0 && I4 < 8 && I5 == I4 + 1) && ((I6 & 1) == 0 && I6 < 8 && I7 == I6 + 1) &&
+            (I8 == 8) && (I9 == 9) &&
+            (I10 == 10) && (I11 == 11) &&
+            (I12 == 12) && (I13 == 13) &&
+            (I14 == 14) && (I15 == 15)),
+          low_words_imm =
+            ((((I0 >> 1) & 3) << 0) | (((I2 >> 1) & 3) << 2) | (((I4 >> 1) & 3) << 4) | (((I6 >> 1) & 3) << 6)),
+          high_words =
+            ((I0 == 0) && (I1 == 1) &&
+            (I2 == 2) && (I3 == 3) &&
+            (I4 == 4) && (I5 == 5) &&
+            (I6 == 6) && (I7 == 7) &&
+            ((I8 & 1) == 0 && I8 >= 8 && I9 == I8 + 1) && ((I10 & 1) == 0 && I10 >= 8 && I11 == I10 + 1) &&
+            ((I12 & 1) == 0 && I12 >= 8 && I13 == I12 + 1) && ((I14 & 1) == 0 && I14 >= 8 && I15 == I14 + 1)),
+          high_words_imm =
+            ((((I8 >> 1) & 3) << 0) | (((I10 >> 1) & 3) << 2) | (((I12 >> 1) & 3) << 4) | (((I14 >> 1) & 3) << 6)),
+          rotate =
+            ((I1 == ((I0 + 1) & 15)) && (I2 == ((I0 + 2) & 15)) && (I3 == ((I0 + 3) & 15)) && (I4 == ((I0 + 4) & 15)) &&
+            (I5 == ((I0 + 5) & 15)) && (I6 == ((I0 + 6) & 15)) && (I7 == ((I0 + 7) & 15)) && (I8 == ((I0 + 8) & 15)) &&
+            (I9 == ((I0 + 9) & 15)) && (I10 == ((I0 + 10) & 15)) && (I11 == ((I0 + 11) & 15)) && (I12 == ((I0 + 12) & 15)) &&
+            (I13 == ((I0 + 13) & 15)) && (I14 == ((I0 + 14) & 15)) && (I15 == ((I0 + 15) & 15))),
+          consecutive =
+            ((I1 == ((I0 + 1) & 31)) && (I2 == ((I0 + 2) & 31)) && (I3 == ((I0 + 3) & 31)) && (I4 == ((I0 + 4) & 31)) &&
+            (I5 == ((I0 + 5) & 31)) && (I6 == ((I0 + 6) & 31)) && (I7 == ((I0 + 7) & 31)) && (I8 == ((I0 + 8) & 31)) &&
+            (I9 == ((I0 + 9) & 31)) && (I10 == ((I0 + 10) & 31)) && (I11 == ((I0 + 11) & 31)) && (I12 == ((I0 + 12) & 31)) &&
+            (I13 == ((I0 + 13) & 31)) && (I14 == ((I0 + 14) & 31)) && (I15 == ((I0 + 15) & 31))),
+          unpacklo_ab =
+            ((I0 == 0 && I1 == 16) && (I2 == 1 && I3 == 17) &&
+            (I4 == 2 && I5 == 18) && (I6 == 3 && I7 == 19) &&
+            (I8 == 4 && I9 == 20) && (I10 == 5 && I11 == 21) &&
+            (I12 == 6 && I13 == 22) && (I14 == 7 && I15 == 23)),
+          unpacklo_ba =
+            ((I0 == 16 && I1 == 0) && (I2 == 17 && I3 == 1) &&
+            (I4 == 18 && I5 == 2) && (I6 == 19 && I7 == 3) &&
+            (I8 == 20 && I9 == 4) && (I10 == 21 && I11 == 5) &&
+            (I12 == 22 && I13 == 6) && (I14 == 23 && I15 == 7)),
+          unpackhi_ab =
+            ((I0 == 8 && I1 == 24) && (I2 == 9 && I3 == 25) &&
+            (I4 == 10 && I5 == 26) && (I6 == 11 && I7 == 27) &&
+            (I8 == 12 && I9 == 28) && (I10 == 13 && I11 == 29) &&
+            (I12 == 14 && I13 == 30) && (I14 == 15 && I15 == 31)),
+          unpackhi_ba =
+            ((I0 == 24 && I1 == 8) && (I2 == 25 && I3 == 9) &&
+            (I4 == 26 && I5 == 10) && (I6 == 27 && I7 == 11) &&
+            (I8 == 28 && I9 == 12) && (I10 == 29 && I11 == 13) &&
+            (I12 == 30 && I13 == 14) && (I14 == 31 && I15 == 15)),
+          movelh_ab =
+            ((I0 == 0) && (I1 == 1) && (I2 == 2) && (I3 == 3) &&
+            (I4 == 4) && (I5 == 5) && (I6 == 6) && (I7 == 7) &&
+            (I8 == 16) && (I9 == 17) && (I10 == 18) && (I11 == 19) &&
+            (I12 == 20) && (I13 == 21) && (I14 == 22) && (I15 == 23)),
+          movelh_ba =
+            ((I0 == 16) && (I1 == 17) && (I2 == 18) && (I3 == 19) &&
+            (I4 == 20) && (I5 == 21) && (I6 == 22) && (I7 == 23) &&
+            (I8 == 0) && (I9 == 1) && (I10 == 2) && (I11 == 3) &&
+            (I12 == 4) && (I13 == 5) && (I14 == 6) && (I15 == 7)),
+          movehl_ab =
+            ((I0 == 8) && (I1 == 9) && (I2 == 10) && (I3 == 11) &&
+            (I4 == 12) && (I5 == 13) && (I6 == 14) && (I7 == 15) &&
+            (I8 == 24) && (I9 == 25) && (I10 == 26) && (I11 == 27) &&
+            (I12 == 28) && (I13 == 29) && (I14 == 30) && (I15 == 31)),
+          movehl_ba =
+            ((I0 == 24) && (I1 == 25) && (I2 == 26) && (I3 == 27) &&
+            (I4 == 28) && (I5 == 29) && (I6 == 30) && (I7 == 31) &&
+            (I8 == 8) && (I9 == 9) && (I10 == 10) && (I11 == 11) &&
+            (I12 == 12) && (I13 == 13) && (I14 == 14) && (I15 == 15)),
+          word_blend =
+            (((I0 >= 16) == (I1 >= 16)) && ((I2 >= 16) == (I3 >= 16)) && ((I4 >= 16) == (I5 >= 16)) && ((I6 >= 16) == (I7 >= 16)) &&
+            ((I8 >= 16) == (I9 >= 16)) && ((I10 >= 16) == (I11 >= 16)) && ((I12 >= 16) == (I13 >= 16)) && ((I14 >= 16) == (I15 >= 16))),
+          word_blend_imm =
+            (((I0 >= 16) << 0) | ((I2 >= 16) << 1) | ((I4 >= 16) << 2) | ((I6 >= 16) << 3) |
+            ((I8 >= 16) << 4) | ((I10 >= 16) << 5) | ((I12 >= 16) << 6) | ((I14 >= 16) << 7))
+        };
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15>
+      struct i8x16_kind {
+        typedef lanes16<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> l;
+        enum {
+          value =
+            (l::identity) ? KIND_IDENTITY :
+            (l::dwords) ? KIND_PSHUFD :
+            (l::low_words) ? KIND_PSHUFLW :
+            (l::high_words) ? KIND_PSHUFHW :
+            (l::rotate) ? KIND_ROTATE :
+            #if defined(VICTOR_ENABLE_SSSE3)
+            KIND_PSHUFB
+            #else
+            KIND_SCALAR
+            #endif
+        };
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15>
+      struct i8x16_kind2 {
+        typedef lanes16<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> l;
+        enum {
+          value =
+            (l::all_a) ? KIND2_A :
+            (l::all_b) ? KIND2_B :
+            (l::unpacklo_ab) ? KIND2_UNPACKLO_AB :
+            (l::unpacklo_ba) ? KIND2_UNPACKLO_BA :
+            (l::unpackhi_ab) ? KIND2_UNPACKHI_AB :
+            (l::unpackhi_ba) ? KIND2_UNPACKHI_BA :
+            (l::movelh_ab) ? KIND2_MOVELH_AB :
+            (l::movelh_ba) ? KIND2_MOVELH_BA :
+            (l::movehl_ab) ? KIND2_MOVEHL_AB :
+            (l::movehl_ba) ? KIND2_MOVEHL_BA :
+            (l::in_place && l::word_blend) ? KIND2_BLEND :
+            (l::in_place) ? KIND2_BLEND_SHUFFLES :
+            (l::consecutive && I0 < 16) ? KIND2_ALIGNR_AB :
+            (l::consecutive && I0 >= 16) ? KIND2_ALIGNR_BA :
+            #if defined(VICTOR_ENABLE_SSSE3)
+            KIND2_PSHUFB
+            #else
+            KIND2_SCALAR
+            #endif
+        };
+      };
+
+      template <int Kind, int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle;
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle<KIND_IDENTITY, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT {
+          return v;
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle<KIND_PSHUFD, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT {
+          return _mm_shuffle_epi32(v, (lanes16<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::dwords_imm));
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle<KIND_PSHUFLW, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT {
+          return _mm_shufflelo_epi16(v, (lanes16<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::low_words_imm));
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle<KIND_PSHUFHW, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT {
+          return _mm_shufflehi_epi16(v, (lanes16<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::high_words_imm));
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle<KIND_ROTATE, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSSE3)
+            return _mm_alignr_epi8(v, v, I0 & 15);
+          #else
+            return _mm_or_si128(_mm_srli_si128(v, I0 & 15), _mm_slli_si128(v, 16 - (I0 & 15)));
+          #endif
+        }
+      };
+
+      #if defined(VICTOR_ENABLE_SSSE3)
+        template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle<KIND_PSHUFB, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+          static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT {
+            return _mm_shuffle_epi8(v, _mm_setr_epi8(
+              I0, I1, I2, I3, I4, I5, I6, I7,
+              I8, I9, I10, I11, I12, I13, I14, I15));
+          }
+        };
+
+      #endif
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle<KIND_SCALAR, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i v) VICTOR_NOEXCEPT {
+          int8_t src[16], r[16];
+          _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, src), v);
+          r[0] = src[I0 & 15]; r[1] = src[I1 & 15]; r[2] = src[I2 & 15]; r[3] = src[I3 & 15];
+          r[4] = src[I4 & 15]; r[5] = src[I5 & 15]; r[6] = src[I6 & 15]; r[7] = src[I7 & 15];
+          r[8] = src[I8 & 15]; r[9] = src[I9 & 15]; r[10] = src[I10 & 15]; r[11] = src[I11 & 15];
+          r[12] = src[I12 & 15]; r[13] = src[I13 & 15]; r[14] = src[I14 & 15]; r[15] = src[I15 & 15];
+          return _mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, r));
+        }
+      };
+
+
+      template <int Kind, int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2;
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_A, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          (void) b;
+          return i8x16_shuffle<i8x16_kind<(I0 & 15), (I1 & 15), (I2 & 15), (I3 & 15), (I4 & 15), (I5 & 15), (I6 & 15), (I7 & 15), (I8 & 15), (I9 & 15), (I10 & 15), (I11 & 15), (I12 & 15), (I13 & 15), (I14 & 15), (I15 & 15)>::value, (I0 & 15), (I1 & 15), (I2 & 15), (I3 & 15), (I4 & 15), (I5 & 15), (I6 & 15), (I7 & 15), (I8 & 15), (I9 & 15), (I10 & 15), (I11 & 15), (I12 & 15), (I13 & 15), (I14 & 15), (I15 & 15)>::apply(a);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_B, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          (void) a;
+          return i8x16_shuffle<i8x16_kind<(I0 & 15), (I1 & 15), (I2 & 15), (I3 & 15), (I4 & 15), (I5 & 15), (I6 & 15), (I7 & 15), (I8 & 15), (I9 & 15), (I10 & 15), (I11 & 15), (I12 & 15), (I13 & 15), (I14 & 15), (I15 & 15)>::value, (I0 & 15), (I1 & 15), (I2 & 15), (I3 & 15), (I4 & 15), (I5 & 15), (I6 & 15), (I7 & 15), (I8 & 15), (I9 & 15), (I10 & 15), (I11 & 15), (I12 & 15), (I13 & 15), (I14 & 15), (I15 & 15)>::apply(b);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_UNPACKLO_AB, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_epi8(a, b);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_UNPACKLO_BA, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_epi8(b, a);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_UNPACKHI_AB, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_epi8(a, b);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_UNPACKHI_BA, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_epi8(b, a);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_MOVELH_AB, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_epi64(a, b);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_MOVELH_BA, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpacklo_epi64(b, a);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_MOVEHL_AB, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_epi64(a, b);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_MOVEHL_BA, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          return _mm_unpackhi_epi64(b, a);
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_BLEND, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return _mm_blend_epi16(a, b, (lanes16<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::word_blend_imm));
+          #else
+            const __m128i m = _mm_setr_epi16(-(I0 >= 16), -(I2 >= 16), -(I4 >= 16), -(I6 >= 16), -(I8 >= 16), -(I10 >= 16), -(I12 >= 16), -(I14 >= 16));
+            return _mm_or_si128(_mm_andnot_si128(m, a), _mm_and_si128(m, b));
+          #endif
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_BLEND_SHUFFLES, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          const __m128i m = _mm_setr_epi8(
+              -(I0 >= 16), -(I1 >= 16), -(I2 >= 16), -(I3 >= 16), -(I4 >= 16), -(I5 >= 16), -(I6 >= 16), -(I7 >= 16),
+              -(I8 >= 16), -(I9 >= 16), -(I10 >= 16), -(I11 >= 16), -(I12 >= 16), -(I13 >= 16), -(I14 >= 16), -(I15 >= 16));
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return _mm_blendv_epi8(a, b, m);
+          #else
+            return _mm_or_si128(_mm_andnot_si128(m, a), _mm_and_si128(m, b));
+          #endif
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_ALIGNR_AB, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSSE3)
+            return _mm_alignr_epi8(b, a, I0 & 15);
+          #else
+            return _mm_or_si128(_mm_srli_si128(a, I0 & 15), _mm_slli_si128(b, 16 - (I0 & 15)));
+          #endif
+        }
+      };
+
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_ALIGNR_BA, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSSE3)
+            return _mm_alignr_epi8(a, b, I0 & 15);
+          #else
+            return _mm_or_si128(_mm_srli_si128(b, I0 & 15), _mm_slli_si128(a, 16 - (I0 & 15)));
+          #endif
+        }
+      };
+
+      #if defined(VICTOR_ENABLE_SSSE3)
+        template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_PSHUFB, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+          static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+            return _mm_or_si128(
+              _mm_shuffle_epi8(a, _mm_setr_epi8(
+                (I0 < 16) ? I0 : -128, (I1 < 16) ? I1 : -128, (I2 < 16) ? I2 : -128, (I3 < 16) ? I3 : -128, (I4 < 16) ? I4 : -128, (I5 < 16) ? I5 : -128, (I6 < 16) ? I6 : -128, (I7 < 16) ? I7 : -128,
+                (I8 < 16) ? I8 : -128, (I9 < 16) ? I9 : -128, (I10 < 16) ? I10 : -128, (I11 < 16) ? I11 : -128, (I12 < 16) ? I12 : -128, (I13 < 16) ? I13 : -128, (I14 < 16) ? I14 : -128, (I15 < 16) ? I15 : -128)),
+              _mm_shuffle_epi8(b, _mm_setr_epi8(
+                (I0 >= 16) ? (I0 - 16) : -128, (I1 >= 16) ? (I1 - 16) : -128, (I2 >= 16) ? (I2 - 16) : -128, (I3 >= 16) ? (I3 - 16) : -128, (I4 >= 16) ? (I4 - 16) : -128, (I5 >= 16) ? (I5 - 16) : -128, (I6 >= 16) ? (I6 - 16) : -128, (I7 >= 16) ? (I7 - 16) : -128,
+                (I8 >= 16) ? (I8 - 16) : -128, (I9 >= 16) ? (I9 - 16) : -128, (I10 >= 16) ? (I10 - 16) : -128, (I11 >= 16) ? (I11 - 16) : -128, (I12 >= 16) ? (I12 - 16) : -128, (I13 >= 16) ? (I13 - 16) : -128, (I14 >= 16) ? (I14 - 16) : -128, (I15 >= 16) ? (I15 - 16) : -128)));
+          }
+        };
+
+      #endif
+      template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15> struct i8x16_shuffle2<KIND2_SCALAR, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15> {
+        static VICTOR_INLINE __m128i apply(__m128i a, __m128i b) VICTOR_NOEXCEPT {
+          int8_t src[32], r[16];
+          _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, src), a);
+          _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, src + 16), b);
+          r[0] = src[I0 & 31]; r[1] = src[I1 & 31]; r[2] = src[I2 & 31]; r[3] = src[I3 & 31];
+          r[4] = src[I4 & 31]; r[5] = src[I5 & 31]; r[6] = src[I6 & 31]; r[7] = src[I7 & 31];
+          r[8] = src[I8 & 31]; r[9] = src[I9 & 31]; r[10] = src[I10 & 31]; r[11] = src[I11 & 31];
+          r[12] = src[I12 & 31]; r[13] = src[I13 & 31]; r[14] = src[I14 & 31]; r[15] = src[I15 & 31];
+          return _mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, r));
+        }
+      };
+
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    VICTOR_INLINE f32x4 shuffle(f32x4 v) VICTOR_NOEXCEPT {
+      typedef shuffle_detail::lanes4<I0, I1, I2, I3> l;
+      HEDLEY_STATIC_ASSERT(l::in_range1, "shuffle index out of range");
+      return f32x4(shuffle_detail::f32x4_shuffle<shuffle_detail::f32x4_kind<I0, I1, I2, I3>::value, l::imm>::apply(v.to_native()));
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    VICTOR_INLINE f32x4 shuffle(f32x4 a, f32x4 b) VICTOR_NOEXCEPT {
+      HEDLEY_STATIC_ASSERT((shuffle_detail::lanes4<I0, I1, I2, I3>::in_range2), "shuffle index out of range");
+      return f32x4(shuffle_detail::f32x4_shuffle2<shuffle_detail::lanes4_kind2<false, I0, I1, I2, I3>::value, I0, I1, I2, I3>::apply(a.to_native(), b.to_native()));
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    VICTOR_INLINE i32x4 shuffle(i32x4 v) VICTOR_NOEXCEPT {
+      typedef shuffle_detail::lanes4<I0, I1, I2, I3> l;
+      HEDLEY_STATIC_ASSERT(l::in_range1, "shuffle index out of range");
+      return i32x4(shuffle_detail::i32x4_shuffle<shuffle_detail::i32x4_kind<I0, I1, I2, I3>::value, l::imm>::apply(v.to_native()));
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    VICTOR_INLINE i32x4 shuffle(i32x4 a, i32x4 b) VICTOR_NOEXCEPT {
+      HEDLEY_STATIC_ASSERT((shuffle_detail::lanes4<I0, I1, I2, I3>::in_range2), "shuffle index out of range");
+      return i32x4(shuffle_detail::i32x4_shuffle2<shuffle_detail::lanes4_kind2<true, I0, I1, I2, I3>::value, I0, I1, I2, I3>::apply(a.to_native(), b.to_native()));
+    }
+
+    template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15>
+    VICTOR_INLINE i8x16 shuffle(i8x16 v) VICTOR_NOEXCEPT {
+      HEDLEY_STATIC_ASSERT((shuffle_detail::lanes16<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::in_range1), "shuffle index out of range");
+      return i8x16(shuffle_detail::i8x16_shuffle<shuffle_detail::i8x16_kind<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::value, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::apply(v.to_native()));
+    }
+
+    template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7, int I8, int I9, int I10, int I11, int I12, int I13, int I14, int I15>
+    VICTOR_INLINE i8x16 shuffle(i8x16 a, i8x16 b) VICTOR_NOEXCEPT {
+      HEDLEY_STATIC_ASSERT((shuffle_detail::lanes16<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::in_range2), "shuffle index out of range");
+      return i8x16(shuffle_detail::i8x16_shuffle2<shuffle_detail::i8x16_kind2<I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::value, I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, I12, I13, I14, I15>::apply(a.to_native(), b.to_native()));
+    }
+  VICTOR_X_END_NAMESPACE
+#endif /* defined(VICTOR_ENABLE_CXX_API) && defined(VICTOR_ENABLE_SSE2) */
+
+#if defined(VICTOR_ENABLE_C_API)
+  #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS) && HEDLEY_HAS_BUILTIN(__builtin_shufflevector)
+    #define victor_f32x4_shuffle(v, i0, i1, i2, i3) __builtin_shufflevector((v), (v), (i0), (i1), (i2), (i3))
+    #define victor_f32x4_shuffle2(a, b, i0, i1, i2, i3) __builtin_shufflevector((a), (b), (i0), (i1), (i2), (i3))
+    #define victor_i32x4_shuffle(v, i0, i1, i2, i3) __builtin_shufflevector((v), (v), (i0), (i1), (i2), (i3))
+    #define victor_i32x4_shuffle2(a, b, i0, i1, i2, i3) __builtin_shufflevector((a), (b), (i0), (i1), (i2), (i3))
+    #define victor_i8x16_shuffle(v, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15) \
+      __builtin_shufflevector((v), (v), (i0), (i1), (i2), (i3), (i4), (i5), (i6), (i7), (i8), (i9), (i10), (i11), (i12), (i13), (i14), (i15))
+    #define victor_i8x16_shuffle2(a, b, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15) \
+      __builtin_shufflevector((a), (b), (i0), (i1), (i2), (i3), (i4), (i5), (i6), (i7), (i8), (i9), (i10), (i11), (i12), (i13), (i14), (i15))
+  #elif defined(VICTOR_ENABLE_VECTOR_EXTENSIONS) && HEDLEY_GCC_VERSION_CHECK(4,7,0)
+    typedef int32_t victor_x_shuffle_indices32x4 __attribute__((__vector_size__(16)));
+    typedef int8_t victor_x_shuffle_indices8x16 __attribute__((__vector_size__(16)));
+
+    #define victor_f32x4_shuffle(v, i0, i1, i2, i3) __builtin_shuffle((v), (victor_x_shuffle_indices32x4) { (i0), (i1), (i2), (i3) })
+    #define victor_f32x4_shuffle2(a, b, i0, i1, i2, i3) __builtin_shuffle((a), (b), (victor_x_shuffle_indices32x4) { (i0), (i1), (i2), (i3) })
+    #define victor_i32x4_shuffle(v, i0, i1, i2, i3) __builtin_shuffle((v), (victor_x_shuffle_indices32x4) { (i0), (i1), (i2), (i3) })
+    #define victor_i32x4_shuffle2(a, b, i0, i1, i2, i3) __builtin_shuffle((a), (b), (victor_x_shuffle_indices32x4) { (i0), (i1), (i2), (i3) })
+    #define victor_i8x16_shuffle(v, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15) \
+      __builtin_shuffle((v), (victor_x_shuffle_indices8x16) { (i0), (i1), (i2), (i3), (i4), (i5), (i6), (i7), (i8), (i9), (i10), (i11), (i12), (i13), (i14), (i15) })
+    #define victor_i8x16_shuffle2(a, b, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15) \
+      __builtin_shuffle((a), (b), (victor_x_shuffle_indices8x16) { (i0), (i1), (i2), (i3), (i4), (i5), (i6), (i7), (i8), (i9), (i10), (i11), (i12), (i13), (i14), (i15) })
+  #else
+    #if defined(VICTOR_ENABLE_SSE)
+      #define victor_f32x4_shuffle(v, i0, i1, i2, i3) \
+        victor_f32x4_from_native(_mm_shuffle_ps(victor_f32x4_to_native(v), victor_f32x4_to_native(v), _MM_SHUFFLE((i3), (i2), (i1), (i0))))
+      #define victor_f32x4_shuffle2(a, b, i0, i1, i2, i3) victor_x_f32x4_shuffle2((a), (b), (i0), (i1), (i2), (i3))
+
+      static VICTOR_INLINE victor_f32x4 victor_x_f32x4_shuffle2(victor_f32x4 a, victor_f32x4 b, int i0, int i1, int i2, int i3) {
+        float src[8], r[4];
+        victor_f32x4_store(src, a);
+        victor_f32x4_store(src + 4, b);
+        r[0] = src[i0 & 7];
+        r[1] = src[i1 & 7];
+        r[2] = src[i2 & 7];
+        r[3] = src[i3 & 7];
+        return victor_f32x4_load(r);
+      }
+    #endif
+
+    #if defined(VICTOR_ENABLE_SSE2)
+      #define victor_i32x4_shuffle(v, i0, i1, i2, i3) \
+        victor_i32x4_from_native(_mm_shuffle_epi32(victor_i32x4_to_native(v), _MM_SHUFFLE((i3), (i2), (i1), (i0))))
+      #define victor_i32x4_shuffle2(a, b, i0, i1, i2, i3) victor_x_i32x4_shuffle2((a), (b), (i0), (i1), (i2), (i3))
+      #if defined(VICTOR_ENABLE_SSSE3)
+        #define victor_i8x16_shuffle(v, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15) \
+          victor_i8x16_from_native(_mm_shuffle_epi8(victor_i8x16_to_native(v), _mm_setr_epi8((i0), (i1), (i2), (i3), (i4), (i5), (i6), (i7), (i8), (i9), (i10), (i11), (i12), (i13), (i14), (i15))))
+      #else
+        #define victor_i8x16_shuffle(v, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15) \
+          victor_x_i8x16_shuffle2((v), (v), (i0), (i1), (i2), (i3), (i4), (i5), (i6), (i7), (i8), (i9), (i10), (i11), (i12), (i13), (i14), (i15))
+      #endif
+      #define victor_i8x16_shuffle2(a, b, i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15) \
+        victor_x_i8x16_shuffle2((a), (b), (i0), (i1), (i2), (i3), (i4), (i5), (i6), (i7), (i8), (i9), (i10), (i11), (i12), (i13), (i14), (i15))
+
+      static VICTOR_INLINE victor_i32x4 victor_x_i32x4_shuffle2(victor_i32x4 a, victor_i32x4 b, int i0, int i1, int i2, int i3) {
+        int32_t src[8], r[4];
+        victor_i32x4_store(src, a);
+        victor_i32x4_store(src + 4, b);
+        r[0] = src[i0 & 7];
+        r[1] = src[i1 & 7];
+        r[2] = src[i2 & 7];
+        r[3] = src[i3 & 7];
+        return victor_i32x4_load(r);
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_x_i8x16_shuffle2(victor_i8x16 a, victor_i8x16 b, int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7, int i8, int i9, int i10, int i11, int i12, int i13, int i14, int i15) {
+        int8_t src[32], r[16];
+        victor_i8x16_store(src, a);
+        victor_i8x16_store(src + 16, b);
+        r[0] = src[i0 & 31];
+        r[1] = src[i1 & 31];
+        r[2] = src[i2 & 31];
+        r[3] = src[i3 & 31];
+        r[4] = src[i4 & 31];
+        r[5] = src[i5 & 31];
+        r[6] = src[i6 & 31];
+        r[7] = src[i7 & 31];
+        r[8] = src[i8 & 31];
+        r[9] = src[i9 & 31];
+        r[10] = src[i10 & 31];
+        r[11] = src[i11 & 31];
+        r[12] = src[i12 & 31];
+        r[13] = src[i13 & 31];
+        r[14] = src[i14 & 31];
+        r[15] = src[i15 & 31];
+        return victor_i8x16_load(r);
+      }
+    #endif
+  #endif
+#endif /* defined(VICTOR_ENABLE_C_API) */
+
+#endif /* !defined(VICTOR_SHUFFLE_H) */
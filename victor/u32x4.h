@@ -0,0 +1,342 @@
+/* u32x4.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_SSE2)
+  #if !defined(VICTOR_U32X4_H_FORWARD_DECLARE)
+    #define VICTOR_U32X4_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class u32x4;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_U32X4_H_DECLARE)
+    #define VICTOR_U32X4_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class u32x4 {
+          private:
+            __m128i n;
+
+          public:
+            VICTOR_INLINE u32x4(__m128i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 to_u64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 to_u64x2_high(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4(uint32_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4(uint32_t e0, uint32_t e1, uint32_t e2, uint32_t e3) VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 operator+(u32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 operator&(u32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 and_not(u32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 min(u32x4 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 max(u32x4 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u32x4 load(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u32x4 load_aligned(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u32x4 load_stream(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(uint32_t values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(uint32_t values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(uint32_t values[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u32x4 load_partial(const uint32_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(uint32_t dest[], size_t count) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u32x4 gather(const uint32_t base[], i32x4 indices) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u32x4 gather_masked(mask32x4 mask, const uint32_t base[], i32x4 indices) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void scatter(uint32_t base[], i32x4 indices) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i8x16 as_i8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 as_u8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 as_i16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 as_u16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 as_i32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 as_i64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 as_u64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 as_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 as_f64x2(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef uint32_t victor_u32x4 __attribute__((__vector_size__(16),__aligned__(16)));
+
+        static VICTOR_INLINE victor_u32x4 victor_u32x4_from_native(__m128i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_u32x4, v);
+          #else
+            union {
+              __m128i from;
+              victor_u32x4 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m128i victor_u32x4_to_native(victor_u32x4 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m128i, v);
+          #else
+            union {
+              victor_u32x4 from;
+              __m128i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m128i victor_u32x4;
+        #define victor_u32x4_to_native(v) (v)
+        #define victor_u32x4_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_U32X4_H_DEFINE)
+    #define VICTOR_U32X4_H_DEFINE
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepu32_epi64(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_cvtepu32_epi64(a);
+      #else
+        return _mm_unpacklo_epi32(a, _mm_setzero_si128());
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepu32hi_epi64(__m128i a) {
+      return _mm_unpackhi_epi32(a, _mm_setzero_si128());
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE u32x4::u32x4(__m128i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128i u32x4::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE u32x4::u32x4(uint32_t value) VICTOR_NOEXCEPT :n(_mm_set1_epi32(value)) { };
+        VICTOR_INLINE u32x4::u32x4(uint32_t e0, uint32_t e1, uint32_t e2, uint32_t e3) VICTOR_NOEXCEPT :n(_mm_setr_epi32(e0, e1, e2, e3)) { };
+        VICTOR_INLINE u32x4 u32x4::operator+(u32x4 a) const VICTOR_NOEXCEPT { return u32x4(_mm_add_epi32(n, a.to_native())); };
+        VICTOR_INLINE u32x4 u32x4::operator&(u32x4 a) const VICTOR_NOEXCEPT { return u32x4(_mm_and_si128(n, a.to_native())); };
+        VICTOR_INLINE u32x4 u32x4::and_not(u32x4 a) const VICTOR_NOEXCEPT { return u32x4(_mm_andnot_si128(a.to_native(), n)); };
+        VICTOR_INLINE u32x4 u32x4::min(u32x4 a) const VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return u32x4(_mm_min_epu32(n, a.to_native()));
+          #else
+            const __m128i sign = _mm_set1_epi32(INT32_MIN);
+            const __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(n, sign), _mm_xor_si128(a.to_native(), sign));
+            return u32x4(_mm_or_si128(_mm_and_si128(gt, a.to_native()), _mm_andnot_si128(gt, n)));
+          #endif
+        }
+        VICTOR_INLINE u32x4 u32x4::max(u32x4 a) const VICTOR_NOEXCEPT {
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return u32x4(_mm_max_epu32(n, a.to_native()));
+          #else
+            const __m128i sign = _mm_set1_epi32(INT32_MIN);
+            const __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(n, sign), _mm_xor_si128(a.to_native(), sign));
+            return u32x4(_mm_or_si128(_mm_and_si128(gt, n), _mm_andnot_si128(gt, a.to_native())));
+          #endif
+        }
+        VICTOR_INLINE u32x4 u32x4::load(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT { return u32x4(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src))); }
+        VICTOR_INLINE u32x4 u32x4::load_aligned(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          return u32x4(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        }
+        VICTOR_INLINE u32x4 u32x4::load_stream(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return u32x4(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+          #else
+            return u32x4(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+          #endif
+        }
+        VICTOR_INLINE void u32x4::store(uint32_t dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT { _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n); }
+        VICTOR_INLINE void u32x4::store_aligned(uint32_t dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE void u32x4::store_stream(uint32_t dest[HEDLEY_ARRAY_PARAM(4)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE u32x4 u32x4::load_partial(const uint32_t src[], size_t count) VICTOR_NOEXCEPT { return u32x4(victor_x_mm_load_partial_epi32(src, VICTOR_X_PARTIAL_COUNT(count, 4))); }
+        VICTOR_INLINE void u32x4::store_partial(uint32_t dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm_store_partial_epi32(dest, VICTOR_X_PARTIAL_COUNT(count, 4), n); }
+        VICTOR_INLINE u32x4 u32x4::gather(const uint32_t base[], i32x4 indices) VICTOR_NOEXCEPT { return u32x4(victor_x_mm_i32gather_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, base), indices.to_native())); }
+        VICTOR_INLINE u32x4 u32x4::gather_masked(mask32x4 mask, const uint32_t base[], i32x4 indices) VICTOR_NOEXCEPT { return u32x4(victor_x_mm_maskz_i32gather_epi32(mask.to_native(), HEDLEY_REINTERPRET_CAST(const int32_t*, base), indices.to_native())); }
+        VICTOR_INLINE void u32x4::scatter(uint32_t base[], i32x4 indices) const VICTOR_NOEXCEPT { victor_x_mm_i32scatter_epi32(HEDLEY_REINTERPRET_CAST(int32_t*, base), indices.to_native(), n); }
+
+        VICTOR_INLINE u64x2 u32x4::to_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(victor_x_mm_cvtepu32_epi64(n)); };
+        VICTOR_INLINE u64x2 u32x4::to_u64x2_high(void) const VICTOR_NOEXCEPT { return u64x2(victor_x_mm_cvtepu32hi_epi64(n)); };
+        VICTOR_INLINE i8x16 u32x4::as_i8x16(void) const VICTOR_NOEXCEPT { return i8x16(n); };
+        VICTOR_INLINE u8x16 u32x4::as_u8x16(void) const VICTOR_NOEXCEPT { return u8x16(n); };
+        VICTOR_INLINE i16x8 u32x4::as_i16x8(void) const VICTOR_NOEXCEPT { return i16x8(n); };
+        VICTOR_INLINE u16x8 u32x4::as_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(n); };
+        VICTOR_INLINE i32x4 u32x4::as_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(n); };
+        VICTOR_INLINE i64x2 u32x4::as_i64x2(void) const VICTOR_NOEXCEPT { return i64x2(n); };
+        VICTOR_INLINE u64x2 u32x4::as_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(n); };
+        VICTOR_INLINE f32x4 u32x4::as_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_castsi128_ps(n)); };
+        VICTOR_INLINE f64x2 u32x4::as_f64x2(void) const VICTOR_NOEXCEPT { return f64x2(_mm_castsi128_pd(n)); };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_add(victor_u32x4 a, victor_u32x4 b) {
+        return victor_u32x4_from_native(_mm_add_epi32(victor_u32x4_to_native(a), victor_u32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_and(victor_u32x4 a, victor_u32x4 b) {
+        return victor_u32x4_from_native(_mm_and_si128(victor_u32x4_to_native(a), victor_u32x4_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_and_not(victor_u32x4 a, victor_u32x4 b) {
+        return victor_u32x4_from_native(_mm_andnot_si128(victor_u32x4_to_native(b), victor_u32x4_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_min(victor_u32x4 a, victor_u32x4 b) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_u32x4_from_native(_mm_min_epu32(victor_u32x4_to_native(a), victor_u32x4_to_native(b)));
+        #else
+          const __m128i sign = _mm_set1_epi32(INT32_MIN);
+          const __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(victor_u32x4_to_native(a), sign), _mm_xor_si128(victor_u32x4_to_native(b), sign));
+          return victor_u32x4_from_native(_mm_or_si128(_mm_and_si128(gt, victor_u32x4_to_native(b)), _mm_andnot_si128(gt, victor_u32x4_to_native(a))));
+        #endif
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_max(victor_u32x4 a, victor_u32x4 b) {
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_u32x4_from_native(_mm_max_epu32(victor_u32x4_to_native(a), victor_u32x4_to_native(b)));
+        #else
+          const __m128i sign = _mm_set1_epi32(INT32_MIN);
+          const __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(victor_u32x4_to_native(a), sign), _mm_xor_si128(victor_u32x4_to_native(b), sign));
+          return victor_u32x4_from_native(_mm_or_si128(_mm_and_si128(gt, victor_u32x4_to_native(a)), _mm_andnot_si128(gt, victor_u32x4_to_native(b))));
+        #endif
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_set1(uint32_t value) {
+        return victor_u32x4_from_native(_mm_set1_epi32(value));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_set(uint32_t e0, uint32_t e1, uint32_t e2, uint32_t e3) {
+        return victor_u32x4_from_native(_mm_setr_epi32(e0, e1, e2, e3));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_load(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) {
+        return victor_u32x4_from_native(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_load_aligned(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        return victor_u32x4_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_load_stream(const uint32_t src[HEDLEY_ARRAY_PARAM(4)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_u32x4_from_native(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+        #else
+          return victor_u32x4_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_u32x4_store(uint32_t dest[HEDLEY_ARRAY_PARAM(4)], victor_u32x4 src) {
+        _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_u32x4_store_aligned(uint32_t dest[HEDLEY_ARRAY_PARAM(4)], victor_u32x4 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_u32x4_store_stream(uint32_t dest[HEDLEY_ARRAY_PARAM(4)], victor_u32x4 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_load_partial(const uint32_t src[], size_t count) {
+        return victor_u32x4_from_native(victor_x_mm_load_partial_epi32(src, VICTOR_X_PARTIAL_COUNT(count, 4)));
+      }
+
+      static VICTOR_INLINE void victor_u32x4_store_partial(uint32_t dest[], size_t count, victor_u32x4 src) {
+        victor_x_mm_store_partial_epi32(dest, VICTOR_X_PARTIAL_COUNT(count, 4), victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_gather(const uint32_t base[], victor_i32x4 indices) {
+        return victor_u32x4_from_native(victor_x_mm_i32gather_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, base), victor_i32x4_to_native(indices)));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u32x4_gather_masked(victor_mask32x4 mask, const uint32_t base[], victor_i32x4 indices) {
+        return victor_u32x4_from_native(victor_x_mm_maskz_i32gather_epi32(victor_mask32x4_to_native(mask), HEDLEY_REINTERPRET_CAST(const int32_t*, base), victor_i32x4_to_native(indices)));
+      }
+
+      static VICTOR_INLINE void victor_u32x4_scatter(uint32_t base[], victor_i32x4 indices, victor_u32x4 src) {
+        victor_x_mm_i32scatter_epi32(HEDLEY_REINTERPRET_CAST(int32_t*, base), victor_i32x4_to_native(indices), victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_u32x4_to_u64x2(victor_u32x4 src) {
+        return victor_u64x2_from_native(victor_x_mm_cvtepu32_epi64(victor_u32x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_u32x4_to_u64x2_high(victor_u32x4 src) {
+        return victor_u64x2_from_native(victor_x_mm_cvtepu32hi_epi64(victor_u32x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_u32x4_as_i8x16(victor_u32x4 src) {
+        return victor_i8x16_from_native(victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u32x4_as_u8x16(victor_u32x4 src) {
+        return victor_u8x16_from_native(victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_u32x4_as_i16x8(victor_u32x4 src) {
+        return victor_i16x8_from_native(victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_u32x4_as_u16x8(victor_u32x4 src) {
+        return victor_u16x8_from_native(victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_u32x4_as_i32x4(victor_u32x4 src) {
+        return victor_i32x4_from_native(victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_u32x4_as_i64x2(victor_u32x4 src) {
+        return victor_i64x2_from_native(victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_u32x4_as_u64x2(victor_u32x4 src) {
+        return victor_u64x2_from_native(victor_u32x4_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_u32x4_as_f32x4(victor_u32x4 src) {
+        return victor_f32x4_from_native(_mm_castsi128_ps(victor_u32x4_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_u32x4_as_f64x2(victor_u32x4 src) {
+        return victor_f64x2_from_native(_mm_castsi128_pd(victor_u32x4_to_native(src)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_U32X4_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_SSE2) */
@@ -0,0 +1,394 @@
+/* u8x16.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+#if defined(VICTOR_ENABLE_SSE2)
+  #if !defined(VICTOR_U8X16_H_FORWARD_DECLARE)
+    #define VICTOR_U8X16_H_FORWARD_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class u8x16;
+      VICTOR_X_END_NAMESPACE
+    #endif /* ? defined(__cplusplus)  && !defined(VICTOR_NO_CXX_API)*/
+  #elif !defined(VICTOR_U8X16_H_DECLARE)
+    #define VICTOR_U8X16_H_DECLARE
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        class u8x16 {
+          private:
+            __m128i n;
+
+          public:
+            VICTOR_INLINE u8x16(__m128i value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 to_u16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 to_u16x8_high(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 to_u32x4(void) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u8x16 narrow(i16x8 low, i16x8 high) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u8x16 narrow(u16x8 low, u16x8 high) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void dequantize(f32x4 dest[HEDLEY_ARRAY_PARAM(4)], uint8_t zero_point, float scale) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE __m128i to_native(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16(uint8_t value) VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16(uint8_t e0, uint8_t e1, uint8_t e2, uint8_t e3, uint8_t e4, uint8_t e5, uint8_t e6, uint8_t e7, uint8_t e8, uint8_t e9, uint8_t e10, uint8_t e11, uint8_t e12, uint8_t e13, uint8_t e14, uint8_t e15) VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 operator+(u8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 operator&(u8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 and_not(u8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 min(u8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 max(u8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 adds(u8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 subs(u8x16 a) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u8x16 avg(u8x16 a) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u8x16 load(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u8x16 load_aligned(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u8x16 load_stream(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store(uint8_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_aligned(uint8_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_stream(uint8_t values[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT;
+            static VICTOR_INLINE u8x16 load_partial(const uint8_t src[], size_t count) VICTOR_NOEXCEPT;
+            VICTOR_INLINE void store_partial(uint8_t dest[], size_t count) const VICTOR_NOEXCEPT;
+
+            VICTOR_INLINE i8x16 as_i8x16(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i16x8 as_i16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u16x8 as_u16x8(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i32x4 as_i32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u32x4 as_u32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE i64x2 as_i64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE u64x2 as_u64x2(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f32x4 as_f32x4(void) const VICTOR_NOEXCEPT;
+            VICTOR_INLINE f64x2 as_f64x2(void) const VICTOR_NOEXCEPT;
+        };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      #if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+        typedef uint8_t victor_u8x16 __attribute__((__vector_size__(16),__aligned__(16)));
+
+        static VICTOR_INLINE victor_u8x16 victor_u8x16_from_native(__m128i v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(victor_u8x16, v);
+          #else
+            union {
+              __m128i from;
+              victor_u8x16 to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+
+        static VICTOR_INLINE __m128i victor_u8x16_to_native(victor_u8x16 v) {
+          #if defined(VICTOR_X_BIT_CAST)
+            return VICTOR_X_BIT_CAST(__m128i, v);
+          #else
+            union {
+              victor_u8x16 from;
+              __m128i to;
+            } u;
+            u.from = v;
+            return u.to;
+          #endif
+        }
+      #else
+        typedef __m128i victor_u8x16;
+        #define victor_u8x16_to_native(v) (v)
+        #define victor_u8x16_from_native(v) (v)
+      #endif
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+
+  #elif !defined(VICTOR_U8X16_H_DEFINE)
+    #define VICTOR_U8X16_H_DEFINE
+
+    /* Widening.  SSE4.1 has pmovzx for the low lanes; otherwise we
+       interleave with zero, which is also how we get the high half. */
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepu8_epi16(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_cvtepu8_epi16(a);
+      #else
+        return _mm_unpacklo_epi8(a, _mm_setzero_si128());
+      #endif
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepu8hi_epi16(__m128i a) {
+      return _mm_unpackhi_epi8(a, _mm_setzero_si128());
+    }
+
+    static VICTOR_INLINE __m128i victor_x_mm_cvtepu8_epi32(__m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        return _mm_cvtepu8_epi32(a);
+      #else
+        const __m128i z = _mm_setzero_si128();
+        return _mm_unpacklo_epi16(_mm_unpacklo_epi8(a, z), z);
+      #endif
+    }
+
+    static VICTOR_INLINE void victor_x_mm_cvtepu8_epi32_x4(__m128i r[4], __m128i a) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        r[0] = _mm_cvtepu8_epi32(a);
+        r[1] = _mm_cvtepu8_epi32(_mm_srli_si128(a, 4));
+        r[2] = _mm_cvtepu8_epi32(_mm_srli_si128(a, 8));
+        r[3] = _mm_cvtepu8_epi32(_mm_srli_si128(a, 12));
+      #else
+        const __m128i z = _mm_setzero_si128();
+        const __m128i lo = _mm_unpacklo_epi8(a, z);
+        const __m128i hi = _mm_unpackhi_epi8(a, z);
+        r[0] = _mm_unpacklo_epi16(lo, z);
+        r[1] = _mm_unpackhi_epi16(lo, z);
+        r[2] = _mm_unpacklo_epi16(hi, z);
+        r[3] = _mm_unpackhi_epi16(hi, z);
+      #endif
+    }
+
+    /* packuswb treats its inputs as signed, so clamp unsigned words to
+       255 first (x - (x -sat 255) is min(x, 255) without SSE4.1). */
+    static VICTOR_INLINE __m128i victor_x_mm_packus_epu16(__m128i a, __m128i b) {
+      #if defined(VICTOR_ENABLE_SSE4_1)
+        const __m128i max = _mm_set1_epi16(0x00FF);
+        return _mm_packus_epi16(_mm_min_epu16(a, max), _mm_min_epu16(b, max));
+      #else
+        const __m128i max = _mm_set1_epi16(0x00FF);
+        return _mm_packus_epi16(_mm_sub_epi16(a, _mm_subs_epu16(a, max)), _mm_sub_epi16(b, _mm_subs_epu16(b, max)));
+      #endif
+    }
+
+    #if defined(VICTOR_ENABLE_CXX_API)
+      VICTOR_X_BEGIN_NAMESPACE
+        VICTOR_INLINE u8x16::u8x16(__m128i value) VICTOR_NOEXCEPT :n(value) { };
+        VICTOR_INLINE __m128i u8x16::to_native() const VICTOR_NOEXCEPT { return n; }
+        VICTOR_INLINE u8x16::u8x16(uint8_t value) VICTOR_NOEXCEPT :n(_mm_set1_epi8(value)) { };
+        VICTOR_INLINE u8x16::u8x16(uint8_t e0, uint8_t e1, uint8_t e2, uint8_t e3, uint8_t e4, uint8_t e5, uint8_t e6, uint8_t e7, uint8_t e8, uint8_t e9, uint8_t e10, uint8_t e11, uint8_t e12, uint8_t e13, uint8_t e14, uint8_t e15) VICTOR_NOEXCEPT :n(_mm_setr_epi8(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15)) { };
+        VICTOR_INLINE u8x16 u8x16::operator+(u8x16 a) const VICTOR_NOEXCEPT { return u8x16(_mm_add_epi8(n, a.to_native())); };
+        VICTOR_INLINE u8x16 u8x16::operator&(u8x16 a) const VICTOR_NOEXCEPT { return u8x16(_mm_and_si128(n, a.to_native())); };
+        VICTOR_INLINE u8x16 u8x16::and_not(u8x16 a) const VICTOR_NOEXCEPT { return u8x16(_mm_andnot_si128(a.to_native(), n)); };
+        VICTOR_INLINE u8x16 u8x16::min(u8x16 a) const VICTOR_NOEXCEPT { return u8x16(_mm_min_epu8(n, a.to_native())); };
+        VICTOR_INLINE u8x16 u8x16::max(u8x16 a) const VICTOR_NOEXCEPT { return u8x16(_mm_max_epu8(n, a.to_native())); };
+        VICTOR_INLINE u8x16 u8x16::adds(u8x16 a) const VICTOR_NOEXCEPT { return u8x16(_mm_adds_epu8(n, a.to_native())); };
+        VICTOR_INLINE u8x16 u8x16::subs(u8x16 a) const VICTOR_NOEXCEPT { return u8x16(_mm_subs_epu8(n, a.to_native())); };
+        VICTOR_INLINE u8x16 u8x16::avg(u8x16 a) const VICTOR_NOEXCEPT { return u8x16(_mm_avg_epu8(n, a.to_native())); };
+        VICTOR_INLINE u8x16 u8x16::load(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT { return u8x16(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src))); }
+        VICTOR_INLINE u8x16 u8x16::load_aligned(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          return u8x16(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        }
+        VICTOR_INLINE u8x16 u8x16::load_stream(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(src, 16);
+          #if defined(VICTOR_ENABLE_SSE4_1)
+            return u8x16(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+          #else
+            return u8x16(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+          #endif
+        }
+        VICTOR_INLINE void u8x16::store(uint8_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT { _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n); }
+        VICTOR_INLINE void u8x16::store_aligned(uint8_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE void u8x16::store_stream(uint8_t dest[HEDLEY_ARRAY_PARAM(16)]) const VICTOR_NOEXCEPT {
+          VICTOR_ASSERT_ALIGNED(dest, 16);
+          _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), n);
+        }
+        VICTOR_INLINE u8x16 u8x16::load_partial(const uint8_t src[], size_t count) VICTOR_NOEXCEPT { return u8x16(victor_x_mm_load_partial_si128(src, VICTOR_X_PARTIAL_COUNT(count, 16))); }
+        VICTOR_INLINE void u8x16::store_partial(uint8_t dest[], size_t count) const VICTOR_NOEXCEPT { victor_x_mm_store_partial_si128(dest, VICTOR_X_PARTIAL_COUNT(count, 16), n); }
+
+        VICTOR_INLINE u16x8 u8x16::to_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(victor_x_mm_cvtepu8_epi16(n)); };
+        VICTOR_INLINE u16x8 u8x16::to_u16x8_high(void) const VICTOR_NOEXCEPT { return u16x8(victor_x_mm_cvtepu8hi_epi16(n)); };
+        VICTOR_INLINE u32x4 u8x16::to_u32x4(void) const VICTOR_NOEXCEPT { return u32x4(victor_x_mm_cvtepu8_epi32(n)); };
+        VICTOR_INLINE u8x16 u8x16::narrow(i16x8 low, i16x8 high) VICTOR_NOEXCEPT { return u8x16(_mm_packus_epi16(low.to_native(), high.to_native())); };
+        VICTOR_INLINE u8x16 u8x16::narrow(u16x8 low, u16x8 high) VICTOR_NOEXCEPT { return u8x16(victor_x_mm_packus_epu16(low.to_native(), high.to_native())); };
+        VICTOR_INLINE void u8x16::dequantize(f32x4 dest[HEDLEY_ARRAY_PARAM(4)], uint8_t zero_point, float scale) const VICTOR_NOEXCEPT {
+          const __m128i z = _mm_set1_epi32(zero_point);
+          const __m128 s = _mm_set1_ps(scale);
+          __m128i r[4];
+          victor_x_mm_cvtepu8_epi32_x4(r, n);
+          dest[0] = f32x4(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(r[0], z)), s));
+          dest[1] = f32x4(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(r[1], z)), s));
+          dest[2] = f32x4(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(r[2], z)), s));
+          dest[3] = f32x4(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(r[3], z)), s));
+        }
+        VICTOR_INLINE i8x16 u8x16::as_i8x16(void) const VICTOR_NOEXCEPT { return i8x16(n); };
+        VICTOR_INLINE i16x8 u8x16::as_i16x8(void) const VICTOR_NOEXCEPT { return i16x8(n); };
+        VICTOR_INLINE u16x8 u8x16::as_u16x8(void) const VICTOR_NOEXCEPT { return u16x8(n); };
+        VICTOR_INLINE i32x4 u8x16::as_i32x4(void) const VICTOR_NOEXCEPT { return i32x4(n); };
+        VICTOR_INLINE u32x4 u8x16::as_u32x4(void) const VICTOR_NOEXCEPT { return u32x4(n); };
+        VICTOR_INLINE i64x2 u8x16::as_i64x2(void) const VICTOR_NOEXCEPT { return i64x2(n); };
+        VICTOR_INLINE u64x2 u8x16::as_u64x2(void) const VICTOR_NOEXCEPT { return u64x2(n); };
+        VICTOR_INLINE f32x4 u8x16::as_f32x4(void) const VICTOR_NOEXCEPT { return f32x4(_mm_castsi128_ps(n)); };
+        VICTOR_INLINE f64x2 u8x16::as_f64x2(void) const VICTOR_NOEXCEPT { return f64x2(_mm_castsi128_pd(n)); };
+      VICTOR_X_END_NAMESPACE
+    #endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+    #if defined(VICTOR_ENABLE_C_API)
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_add(victor_u8x16 a, victor_u8x16 b) {
+        return victor_u8x16_from_native(_mm_add_epi8(victor_u8x16_to_native(a), victor_u8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_and(victor_u8x16 a, victor_u8x16 b) {
+        return victor_u8x16_from_native(_mm_and_si128(victor_u8x16_to_native(a), victor_u8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_and_not(victor_u8x16 a, victor_u8x16 b) {
+        return victor_u8x16_from_native(_mm_andnot_si128(victor_u8x16_to_native(b), victor_u8x16_to_native(a)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_min(victor_u8x16 a, victor_u8x16 b) {
+        return victor_u8x16_from_native(_mm_min_epu8(victor_u8x16_to_native(a), victor_u8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_max(victor_u8x16 a, victor_u8x16 b) {
+        return victor_u8x16_from_native(_mm_max_epu8(victor_u8x16_to_native(a), victor_u8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_adds(victor_u8x16 a, victor_u8x16 b) {
+        return victor_u8x16_from_native(_mm_adds_epu8(victor_u8x16_to_native(a), victor_u8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_subs(victor_u8x16 a, victor_u8x16 b) {
+        return victor_u8x16_from_native(_mm_subs_epu8(victor_u8x16_to_native(a), victor_u8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_avg(victor_u8x16 a, victor_u8x16 b) {
+        return victor_u8x16_from_native(_mm_avg_epu8(victor_u8x16_to_native(a), victor_u8x16_to_native(b)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_set1(uint8_t value) {
+        return victor_u8x16_from_native(_mm_set1_epi8(value));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_set(uint8_t e0, uint8_t e1, uint8_t e2, uint8_t e3, uint8_t e4, uint8_t e5, uint8_t e6, uint8_t e7, uint8_t e8, uint8_t e9, uint8_t e10, uint8_t e11, uint8_t e12, uint8_t e13, uint8_t e14, uint8_t e15) {
+        return victor_u8x16_from_native(_mm_setr_epi8(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_load(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        return victor_u8x16_from_native(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_load_aligned(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        return victor_u8x16_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_load_stream(const uint8_t src[HEDLEY_ARRAY_PARAM(16)]) {
+        VICTOR_ASSERT_ALIGNED(src, 16);
+        #if defined(VICTOR_ENABLE_SSE4_1)
+          return victor_u8x16_from_native(_mm_stream_load_si128(HEDLEY_CONST_CAST(__m128i*, HEDLEY_REINTERPRET_CAST(const __m128i*, src))));
+        #else
+          return victor_u8x16_from_native(_mm_load_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, src)));
+        #endif
+      }
+
+      static VICTOR_INLINE void victor_u8x16_store(uint8_t dest[HEDLEY_ARRAY_PARAM(16)], victor_u8x16 src) {
+        _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_u8x16_store_aligned(uint8_t dest[HEDLEY_ARRAY_PARAM(16)], victor_u8x16 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_store_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE void victor_u8x16_store_stream(uint8_t dest[HEDLEY_ARRAY_PARAM(16)], victor_u8x16 src) {
+        VICTOR_ASSERT_ALIGNED(dest, 16);
+        _mm_stream_si128(HEDLEY_REINTERPRET_CAST(__m128i*, dest), victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_load_partial(const uint8_t src[], size_t count) {
+        return victor_u8x16_from_native(victor_x_mm_load_partial_si128(src, VICTOR_X_PARTIAL_COUNT(count, 16)));
+      }
+
+      static VICTOR_INLINE void victor_u8x16_store_partial(uint8_t dest[], size_t count, victor_u8x16 src) {
+        victor_x_mm_store_partial_si128(dest, VICTOR_X_PARTIAL_COUNT(count, 16), victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_u8x16_to_u16x8(victor_u8x16 src) {
+        return victor_u16x8_from_native(victor_x_mm_cvtepu8_epi16(victor_u8x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_u8x16_to_u16x8_high(victor_u8x16 src) {
+        return victor_u16x8_from_native(victor_x_mm_cvtepu8hi_epi16(victor_u8x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u8x16_to_u32x4(victor_u8x16 src) {
+        return victor_u32x4_from_native(victor_x_mm_cvtepu8_epi32(victor_u8x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_narrow_i16x8(victor_i16x8 low, victor_i16x8 high) {
+        return victor_u8x16_from_native(_mm_packus_epi16(victor_i16x8_to_native(low), victor_i16x8_to_native(high)));
+      }
+
+      static VICTOR_INLINE victor_u8x16 victor_u8x16_narrow_u16x8(victor_u16x8 low, victor_u16x8 high) {
+        return victor_u8x16_from_native(victor_x_mm_packus_epu16(victor_u16x8_to_native(low), victor_u16x8_to_native(high)));
+      }
+
+      static VICTOR_INLINE void victor_u8x16_dequantize(victor_f32x4 dest[HEDLEY_ARRAY_PARAM(4)], victor_u8x16 src, uint8_t zero_point, float scale) {
+        const __m128i z = _mm_set1_epi32(zero_point);
+        const __m128 s = _mm_set1_ps(scale);
+        __m128i r[4];
+        victor_x_mm_cvtepu8_epi32_x4(r, victor_u8x16_to_native(src));
+        dest[0] = victor_f32x4_from_native(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(r[0], z)), s));
+        dest[1] = victor_f32x4_from_native(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(r[1], z)), s));
+        dest[2] = victor_f32x4_from_native(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(r[2], z)), s));
+        dest[3] = victor_f32x4_from_native(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(r[3], z)), s));
+      }
+
+      static VICTOR_INLINE victor_i8x16 victor_u8x16_as_i8x16(victor_u8x16 src) {
+        return victor_i8x16_from_native(victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i16x8 victor_u8x16_as_i16x8(victor_u8x16 src) {
+        return victor_i16x8_from_native(victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u16x8 victor_u8x16_as_u16x8(victor_u8x16 src) {
+        return victor_u16x8_from_native(victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i32x4 victor_u8x16_as_i32x4(victor_u8x16 src) {
+        return victor_i32x4_from_native(victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u32x4 victor_u8x16_as_u32x4(victor_u8x16 src) {
+        return victor_u32x4_from_native(victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_i64x2 victor_u8x16_as_i64x2(victor_u8x16 src) {
+        return victor_i64x2_from_native(victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_u64x2 victor_u8x16_as_u64x2(victor_u8x16 src) {
+        return victor_u64x2_from_native(victor_u8x16_to_native(src));
+      }
+
+      static VICTOR_INLINE victor_f32x4 victor_u8x16_as_f32x4(victor_u8x16 src) {
+        return victor_f32x4_from_native(_mm_castsi128_ps(victor_u8x16_to_native(src)));
+      }
+
+      static VICTOR_INLINE victor_f64x2 victor_u8x16_as_f64x2(victor_u8x16 src) {
+        return victor_f64x2_from_native(_mm_castsi128_pd(victor_u8x16_to_native(src)));
+      }
+    #endif /* defined(VICTOR_ENABLE_C_API) */
+  #endif /* ? defined(VICTOR_U8X16_FORWARD_DECLARE_H) */
+#endif /* defined(VICTOR_ENABLE_SSE2) */
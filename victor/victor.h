@@ -23,7 +23,10 @@
  */
 
 #include "hedley.h"
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+#include <assert.h>
 
 #if !defined(VICTOR_COMMON_H)
 #define VICTOR_COMMON_H
@@ -35,6 +38,45 @@
    relevant header from SIMDe <https://github.com/nemequ/simde> (after
    defining SIMDE_ENABLE_NATIVE_ALIASES). */
 
+#if !defined(VICTOR_ENABLE_AVX512VL)
+  #if defined(SIMDE__AVX512VL_H) || defined(__AVX512VL__)
+    #define VICTOR_ENABLE_AVX512VL
+  #endif
+#endif
+#if defined(VICTOR_ENABLE_AVX512VL)
+  #define VICTOR_ENABLE_AVX512F
+#endif
+
+#if !defined(VICTOR_ENABLE_AVX512DQ)
+  #if defined(SIMDE__AVX512DQ_H) || defined(__AVX512DQ__)
+    #define VICTOR_ENABLE_AVX512DQ
+  #endif
+#endif
+#if defined(VICTOR_ENABLE_AVX512DQ)
+  #define VICTOR_ENABLE_AVX512F
+#endif
+
+#if !defined(VICTOR_ENABLE_AVX512BW)
+  #if defined(SIMDE__AVX512BW_H) || defined(__AVX512BW__)
+    #define VICTOR_ENABLE_AVX512BW
+  #endif
+#endif
+#if defined(VICTOR_ENABLE_AVX512BW)
+  #define VICTOR_ENABLE_AVX512F
+#endif
+
+#if !defined(VICTOR_ENABLE_AVX512F)
+  #if defined(SIMDE__AVX512F_H) || defined(__AVX512F__)
+    #define VICTOR_ENABLE_AVX512F
+  #endif
+#endif
+#if defined(VICTOR_ENABLE_AVX512F)
+  #if !defined(SIMDE__AVX512F_H)
+    #include <immintrin.h>
+  #endif
+  #define VICTOR_ENABLE_AVX2
+#endif
+
 #if !defined(VICTOR_ENABLE_AVX2)
   #if defined(SIMDE__AVX2_H) || defined(__AVX2__)
     #define VICTOR_ENABLE_AVX2
@@ -44,6 +86,35 @@
   #define VICTOR_ENABLE_AVX
 #endif
 
+/* FMA3 isn't implied by anything (AVX2 CPUs without it exist, and
+   -mavx2 doesn't enable it), so it has to be requested separately.
+   Without it fmadd() and friends are emulated with a multiply and an
+   add, which rounds twice.  VICTOR_FMA_IS_FUSED_<type> (1 or 0, for
+   f32x4, f64x2, f32x8, f64x4 and f32x16) tells you which one you got,
+   in C or C++; in C++ so does vector_traits<V>::fma_is_fused.  The
+   512-bit types are always fused. */
+#if !defined(VICTOR_ENABLE_FMA)
+  #if defined(SIMDE__FMA_H) || defined(__FMA__)
+    #define VICTOR_ENABLE_FMA
+  #endif
+#endif
+#if defined(VICTOR_ENABLE_FMA)
+  #if !defined(SIMDE__FMA_H)
+    #include <immintrin.h>
+  #endif
+  #define VICTOR_ENABLE_AVX
+  #define VICTOR_FMA_IS_FUSED_f32x4 1
+  #define VICTOR_FMA_IS_FUSED_f64x2 1
+  #define VICTOR_FMA_IS_FUSED_f32x8 1
+  #define VICTOR_FMA_IS_FUSED_f64x4 1
+#else
+  #define VICTOR_FMA_IS_FUSED_f32x4 0
+  #define VICTOR_FMA_IS_FUSED_f64x2 0
+  #define VICTOR_FMA_IS_FUSED_f32x8 0
+  #define VICTOR_FMA_IS_FUSED_f64x4 0
+#endif
+#define VICTOR_FMA_IS_FUSED_f32x16 1
+
 #if !defined(VICTOR_ENABLE_AVX)
   #if defined(SIMDE__AVX_H) || defined(__AVX__)
     #define VICTOR_ENABLE_AVX
@@ -155,6 +226,20 @@
   #endif
 #endif
 
+/* Converting between the vector-extension types and the native types
+   is a bit cast.  We used to go through a union, but at -O0/-Og that
+   sends every value through memory.  A plain cast works as long as
+   both sides are vectors, which they aren't necessarily with SIMDe, so
+   in that case we stick with the union unless __builtin_bit_cast is
+   available. */
+#if defined(VICTOR_ENABLE_VECTOR_EXTENSIONS)
+  #if HEDLEY_HAS_BUILTIN(__builtin_bit_cast)
+    #define VICTOR_X_BIT_CAST(T, v) __builtin_bit_cast(T, v)
+  #elif !defined(SIMDE_ENABLE_NATIVE_ALIASES)
+    #define VICTOR_X_BIT_CAST(T, v) ((T) (v))
+  #endif
+#endif
+
 /* By default, we the C API in C, and both the C and C++ APIs in C++.
    If you want to skip defining one you can define VICTOR_NO_C_API
    or VICTOR_NO_CXX_API */
@@ -165,6 +250,123 @@
   #define VICTOR_ENABLE_CXX_API
 #endif
 
+/* All C++ member functions are noexcept; knowing that nothing can
+   throw lets the compiler keep values in registers across long
+   expression chains.  We don't use throw() for C++98 since some
+   compilers actually generate code to enforce it. */
+#if defined(__cplusplus) && ((__cplusplus >= 201103L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201103L)))
+  #define VICTOR_NOEXCEPT noexcept
+#else
+  #define VICTOR_NOEXCEPT
+#endif
+
+/* The C++ API is all inline functions, templates and class members,
+   and the linker keeps one copy of each no matter how many objects
+   define it.  That's wrong if the objects were built for different
+   instruction sets (which is the whole point of victor/dispatch.h):
+   an SSE2 object could end up calling an AVX2 copy of, say,
+   Victor::math::exp(f32x4).  So everything lives in an inline
+   namespace named after the instruction sets, e.g. Victor::avx2_fma,
+   which keeps each build's copies apart without changing how you
+   spell anything.  The C API is static, so it doesn't need this.
+   Pre-C++11 compilers get the inline namespace as an extension. */
+#if defined(VICTOR_ENABLE_CXX_API)
+  #if defined(VICTOR_ENABLE_AVX512F)
+    #if defined(VICTOR_ENABLE_AVX512BW) && defined(VICTOR_ENABLE_AVX512DQ) && defined(VICTOR_ENABLE_AVX512VL)
+      #define VICTOR_X_ISA avx512
+    #elif defined(VICTOR_ENABLE_AVX512BW) && defined(VICTOR_ENABLE_AVX512DQ)
+      #define VICTOR_X_ISA avx512f_bw_dq
+    #elif defined(VICTOR_ENABLE_AVX512BW) && defined(VICTOR_ENABLE_AVX512VL)
+      #define VICTOR_X_ISA avx512f_bw_vl
+    #elif defined(VICTOR_ENABLE_AVX512DQ) && defined(VICTOR_ENABLE_AVX512VL)
+      #define VICTOR_X_ISA avx512f_dq_vl
+    #elif defined(VICTOR_ENABLE_AVX512BW)
+      #define VICTOR_X_ISA avx512f_bw
+    #elif defined(VICTOR_ENABLE_AVX512DQ)
+      #define VICTOR_X_ISA avx512f_dq
+    #elif defined(VICTOR_ENABLE_AVX512VL)
+      #define VICTOR_X_ISA avx512f_vl
+    #else
+      #define VICTOR_X_ISA avx512f
+    #endif
+  #elif defined(VICTOR_ENABLE_AVX2)
+    #define VICTOR_X_ISA avx2
+  #elif defined(VICTOR_ENABLE_AVX)
+    #define VICTOR_X_ISA avx
+  #elif defined(VICTOR_ENABLE_SSE4_2)
+    #define VICTOR_X_ISA sse4_2
+  #elif defined(VICTOR_ENABLE_SSE4_1)
+    #define VICTOR_X_ISA sse4_1
+  #elif defined(VICTOR_ENABLE_SSSE3)
+    #define VICTOR_X_ISA ssse3
+  #elif defined(VICTOR_ENABLE_SSE3)
+    #define VICTOR_X_ISA sse3
+  #elif defined(VICTOR_ENABLE_SSE2)
+    #define VICTOR_X_ISA sse2
+  #elif defined(VICTOR_ENABLE_SSE)
+    #define VICTOR_X_ISA sse
+  #else
+    #define VICTOR_X_ISA none
+  #endif
+
+  #if defined(VICTOR_ENABLE_FMA)
+    #define VICTOR_X_ISA_NAMESPACE HEDLEY_CONCAT(VICTOR_X_ISA, _fma)
+  #else
+    #define VICTOR_X_ISA_NAMESPACE VICTOR_X_ISA
+  #endif
+
+  HEDLEY_DIAGNOSTIC_PUSH
+  #if HEDLEY_HAS_WARNING("-Wc++11-extensions") || HEDLEY_GCC_VERSION_CHECK(12,0,0)
+    #pragma GCC diagnostic ignored "-Wc++11-extensions"
+  #endif
+  namespace Victor {
+    inline namespace VICTOR_X_ISA_NAMESPACE { }
+  }
+  HEDLEY_DIAGNOSTIC_POP
+
+  #define VICTOR_X_BEGIN_NAMESPACE namespace Victor { namespace VICTOR_X_ISA_NAMESPACE {
+  #define VICTOR_X_END_NAMESPACE } }
+#endif
+
+/* Wrappers are forced inline and marked artificial.  At -O0/-Og a
+   plain inline function is a real call with its arguments passed
+   through memory, which makes debug builds many times slower than the
+   same code written with intrinsics; "artificial" makes debuggers
+   step over them like they do the intrinsics.  Define
+   VICTOR_NO_FORCE_INLINE if you want to step into Victor instead. */
+#if defined(VICTOR_NO_FORCE_INLINE)
+  #define VICTOR_INLINE HEDLEY_INLINE
+#elif HEDLEY_HAS_ATTRIBUTE(artificial) || HEDLEY_GCC_VERSION_CHECK(4,3,0) || HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+  #define VICTOR_INLINE HEDLEY_ALWAYS_INLINE __attribute__((__artificial__))
+#else
+  #define VICTOR_INLINE HEDLEY_ALWAYS_INLINE
+#endif
+
+/* The *_aligned and *_stream loads and stores require memory aligned
+   to the size of the vector.  Passing a misaligned pointer to them is
+   undefined (usually you'll just get a segfault), so in debug builds
+   we check the alignment; define NDEBUG to disable the check. */
+#define VICTOR_ASSERT_ALIGNED(ptr, alignment) \
+  assert((HEDLEY_REINTERPRET_CAST(uintptr_t, ptr) & ((alignment) - 1)) == 0)
+
+/* load_partial(src, n) only reads the first n elements when it can
+   use masked loads (AVX or AVX-512, depending on the element size).
+   Otherwise, if a full vector at src wouldn't cross into the next
+   page, it loads one and zeros the extra elements; that can't fault,
+   but AddressSanitizer will still complain about it, so in ASan
+   builds (or if you define VICTOR_NO_OVERREAD) we copy through a
+   buffer instead.  A count larger than the number of lanes is treated
+   as the number of lanes, so load_partial(p, remaining) is fine at the
+   end of a loop. */
+#define VICTOR_X_PARTIAL_COUNT(count, lanes) \
+  (((count) < (lanes)) ? (count) : HEDLEY_STATIC_CAST(size_t, lanes))
+
+#if !defined(VICTOR_NO_OVERREAD)
+  #if defined(__SANITIZE_ADDRESS__) || HEDLEY_HAS_FEATURE(address_sanitizer)
+    #define VICTOR_NO_OVERREAD
+  #endif
+#endif
+
 /* Victor uses three passes for including headers:
  *
  * 1. Forward declarations so we can use any type in declarations.  For
@@ -175,19 +377,79 @@
  */
 
 /* Forward declarations */
+#include "mask8x16.h"
+#include "mask32x4.h"
 #include "i8x16.h"
+#include "u8x16.h"
+#include "i16x8.h"
+#include "u16x8.h"
 #include "i32x4.h"
+#include "u32x4.h"
+#include "i64x2.h"
+#include "u64x2.h"
 #include "f32x4.h"
+#include "f64x2.h"
+#include "i8x32.h"
+#include "i32x8.h"
+#include "f32x8.h"
+#include "f64x4.h"
+#include "mask16.h"
+#include "mask64.h"
+#include "i8x64.h"
+#include "i32x16.h"
+#include "f32x16.h"
 
 /* Declarations */
+#include "mask8x16.h"
+#include "mask32x4.h"
 #include "i8x16.h"
+#include "u8x16.h"
+#include "i16x8.h"
+#include "u16x8.h"
 #include "i32x4.h"
+#include "u32x4.h"
+#include "i64x2.h"
+#include "u64x2.h"
 #include "f32x4.h"
+#include "f64x2.h"
+#include "i8x32.h"
+#include "i32x8.h"
+#include "f32x8.h"
+#include "f64x4.h"
+#include "mask16.h"
+#include "mask64.h"
+#include "i8x64.h"
+#include "i32x16.h"
+#include "f32x16.h"
 
 /* Definitions */
+#include "mask8x16.h"
+#include "mask32x4.h"
 #include "i8x16.h"
+#include "u8x16.h"
+#include "i16x8.h"
+#include "u16x8.h"
 #include "i32x4.h"
+#include "u32x4.h"
+#include "i64x2.h"
+#include "u64x2.h"
 #include "f32x4.h"
+#include "f64x2.h"
+#include "i8x32.h"
+#include "i32x8.h"
+#include "f32x8.h"
+#include "f64x4.h"
+#include "mask16.h"
+#include "mask64.h"
+#include "i8x64.h"
+#include "i32x16.h"
+#include "f32x16.h"
+
+/* Operations spanning several types */
+#include "shuffle.h"
+#include "vmath.h"
+#include "algorithm.h"
+#include "blocked.h"
 
 #undef VICTOR_INSIDE_COMMON_H
 
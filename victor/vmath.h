@@ -0,0 +1,1673 @@
+/* vmath.h -- Victor Vector Library
+ * Copyright (c) 2020 Evan Nemerson <evan@nemerson.com> 
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(VICTOR_COMMON_H)
+  #include "victor.h"
+#endif /* !defined(VICTOR_COMMON_H) */
+
+/* Vectorized math functions.
+ *
+ * Victor::math::exp(v), victor_f32x4_exp(v), etc., for f32x4 with
+ * SSE2, f32x8 with AVX2 and f32x16 with AVX-512F.  Every function
+ * comes in two versions: the plain one is accurate to about 1 ULP,
+ * the _fast one gives up some accuracy, range or special-case
+ * handling for speed.  Maximum errors, measured against libm in
+ * double precision:
+ *
+ *   function  accurate     _fast
+ *   sqrt      0.5 ULP      3 ULP (1 on AVX-512)
+ *   rsqrt     1.5 ULP      rsqrtps: 1.5 * 2^-12 relative (2^-14 on AVX-512)
+ *   rcp       2 ULP        rcpps: 1.5 * 2^-12 relative (2^-14 on AVX-512)
+ *   exp       1.3 ULP      7.2 ULP
+ *   exp2      1.2 ULP      7.2 ULP
+ *   log       0.9 ULP      4.9 ULP
+ *   log2      1.4 ULP      5.7 ULP
+ *   sin, cos  1.6 ULP      1.4e-6 absolute
+ *   tanh      1.4 ULP      3.8 ULP
+ *   pow       0.6 ULP      about 10 + 4 |y log2(x)| ULP
+ *
+ * sin and cos (and sincos, which shares the argument reduction) are
+ * only accurate for |x| < 2^22, or |x| <= 1024 for the fast versions;
+ * beyond that the results are meaningless, and the fast versions
+ * don't turn infinities into NaN.
+ *
+ * rsqrt, rcp and sqrt_fast treat denormal inputs as zero, and rcp
+ * flushes results which would be denormal to zero, like the SSE and
+ * AVX instructions they are built on (the AVX-512 ones don't).
+ * log_fast, log2_fast and pow_fast also treat denormal inputs as
+ * zero; pow_fast returns NaN for negative x and doesn't special-case
+ * y == 0.  Otherwise special values (zeros, infinities, NaN) are
+ * handled as in C99 Annex F.
+ *
+ * The argument reductions don't depend on the MXCSR rounding mode,
+ * but the bounds above assume round-to-nearest. */
+
+#if !defined(VICTOR_VMATH_H)
+#define VICTOR_VMATH_H
+
+#if defined(VICTOR_ENABLE_SSE2)
+  /* victor_x_mm_fmadd_ps and friends come from f32x4.h and f64x2.h.
+     Without FMA they round twice, which the error bounds above
+     already account for. */
+  static inline __m128 victor_x_mm_blendv_ps(__m128 a, __m128 b, __m128 mask) {
+    #if defined(VICTOR_ENABLE_SSE4_1)
+      return _mm_blendv_ps(a, b, mask);
+    #else
+      return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a));
+    #endif
+  }
+
+  /* Round to a nearby integer for argument reduction.  Ties don't
+     matter here, so on SSE2 we add +/-0.5 and truncate, which (like
+     roundps) doesn't depend on MXCSR. */
+  static inline __m128i victor_x_mm_cvtps_epi32_nearest(__m128 x) {
+    #if defined(VICTOR_ENABLE_SSE4_1)
+      return _mm_cvtps_epi32(_mm_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    #else
+      return _mm_cvttps_epi32(_mm_add_ps(x, _mm_or_ps(_mm_set1_ps(0.5f), _mm_and_ps(x, _mm_set1_ps(-0.0f)))));
+    #endif
+  }
+
+  static inline __m128i victor_x_mm_cvtpd_epi32_nearest(__m128d x) {
+    #if defined(VICTOR_ENABLE_SSE4_1)
+      return _mm_cvtpd_epi32(_mm_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    #else
+      return _mm_cvttpd_epi32(_mm_add_pd(x, _mm_or_pd(_mm_set1_pd(0.5), _mm_and_pd(x, _mm_set1_pd(-0.0)))));
+    #endif
+  }
+
+  /* p * 2^n for n in [-151, 129].  Splitting the scale in two keeps
+     each factor a normal float, so overflow and gradual underflow
+     come out right with a single rounding. */
+  static inline __m128 victor_x_mm_ldexp_ps(__m128 p, __m128i n) {
+    const __m128i n1 = _mm_srai_epi32(n, 1);
+    const __m128i n2 = _mm_sub_epi32(n, n1);
+    p = _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23)));
+    return _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23)));
+  }
+
+  /* Square root, reciprocal square root and reciprocal.  rsqrtps and
+     rcpps are good to about 12 bits (14 for the AVX-512 versions);
+     one Newton-Raphson step roughly doubles that.  Where the
+     estimate is zero or infinite (zero, denormal and infinite x)
+     the step would be 0 * inf, so those lanes keep it unchanged. */
+  static inline __m128 victor_x_mm_sqrt_fast_ps(__m128 x) {
+    const __m128 y = _mm_rsqrt_ps(x);
+    const __m128 big = _mm_cmpeq_ps(y, _mm_set1_ps(0.0f));
+    const __m128 s = _mm_mul_ps(x, y);
+    const __m128 r = victor_x_mm_fmadd_ps(_mm_mul_ps(s, victor_x_mm_fnmadd_ps(s, y, _mm_set1_ps(1.0f))), _mm_set1_ps(0.5f), s);
+    return victor_x_mm_blendv_ps(r, _mm_or_ps(_mm_and_ps(big, x), _mm_and_ps(x, _mm_set1_ps(-0.0f))), _mm_or_ps(big, _mm_cmpeq_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)))));
+  }
+
+  static inline __m128 victor_x_mm_rsqrt_ps(__m128 x) {
+    const __m128 y = _mm_rsqrt_ps(x);
+    const __m128 e = victor_x_mm_fnmadd_ps(_mm_mul_ps(x, y), y, _mm_set1_ps(1.0f));
+    const __m128 r = victor_x_mm_fmadd_ps(_mm_mul_ps(y, e), victor_x_mm_fmadd_ps(e, _mm_set1_ps(0.375f), _mm_set1_ps(0.5f)), y);
+    return victor_x_mm_blendv_ps(r, y, _mm_or_ps(_mm_cmpeq_ps(y, _mm_set1_ps(0.0f)), _mm_cmpeq_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)))));
+  }
+
+  static inline __m128 victor_x_mm_rcp_ps(__m128 x) {
+    const __m128 y = _mm_rcp_ps(x);
+    const __m128 e = victor_x_mm_fnmadd_ps(x, y, _mm_set1_ps(1.0f));
+    const __m128 r = victor_x_mm_fmadd_ps(_mm_mul_ps(y, e), _mm_add_ps(e, _mm_set1_ps(1.0f)), y);
+    return victor_x_mm_blendv_ps(r, y, _mm_or_ps(_mm_cmpeq_ps(y, _mm_set1_ps(0.0f)), _mm_cmpeq_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)))));
+  }
+
+  /* exp(x) = 2^n * exp(r), where n = round(x / ln 2) and r = x - n ln 2
+     is computed in two pieces (Cody-Waite) so it stays exact.  The
+     polynomials are from Cephes (accurate) and a degree 5 minimax
+     fit (fast).  Clamping first makes overflow, underflow and the
+     infinities fall out of the scaling; min/max are ordered so NaN
+     propagates. */
+  static inline __m128 victor_x_mm_exp_ps(__m128 x) {
+    const __m128 c = _mm_max_ps(_mm_set1_ps(-104.0f), _mm_min_ps(_mm_set1_ps(89.0f), x));
+    const __m128i n = victor_x_mm_cvtps_epi32_nearest(_mm_mul_ps(c, _mm_set1_ps(1.44269504088896341f)));
+    const __m128 nf = _mm_cvtepi32_ps(n);
+    const __m128 r = victor_x_mm_fnmadd_ps(nf, _mm_set1_ps(-2.12194440e-4f), victor_x_mm_fnmadd_ps(nf, _mm_set1_ps(0.693359375f), c));
+    __m128 p = _mm_set1_ps(1.9875691500E-4f);
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(1.3981999507E-3f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(8.3334519073E-3f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(4.1665795894E-2f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(1.6666665459E-1f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(5.0000001201E-1f));
+    p = victor_x_mm_fmadd_ps(p, _mm_mul_ps(r, r), _mm_add_ps(r, _mm_set1_ps(1.0f)));
+    return victor_x_mm_ldexp_ps(p, n);
+  }
+
+  static inline __m128 victor_x_mm_exp_fast_ps(__m128 x) {
+    const __m128 c = _mm_max_ps(_mm_set1_ps(-104.0f), _mm_min_ps(_mm_set1_ps(89.0f), x));
+    const __m128i n = victor_x_mm_cvtps_epi32_nearest(_mm_mul_ps(c, _mm_set1_ps(1.44269504088896341f)));
+    const __m128 nf = _mm_cvtepi32_ps(n);
+    const __m128 r = victor_x_mm_fnmadd_ps(nf, _mm_set1_ps(-2.12194440e-4f), victor_x_mm_fnmadd_ps(nf, _mm_set1_ps(0.693359375f), c));
+    __m128 p = _mm_set1_ps(6.953325123E-3f);
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(4.187527299E-2f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(1.668765545E-1f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(4.999937415E-1f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(9.999937415E-1f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(1.0f));
+    return victor_x_mm_ldexp_ps(p, n);
+  }
+
+  /* exp2(x) = 2^n * 2^r with n = round(x); r is exact. */
+  static inline __m128 victor_x_mm_exp2_ps(__m128 x) {
+    const __m128 c = _mm_max_ps(_mm_set1_ps(-151.0f), _mm_min_ps(_mm_set1_ps(129.0f), x));
+    const __m128i n = victor_x_mm_cvtps_epi32_nearest(c);
+    const __m128 nf = _mm_cvtepi32_ps(n);
+    const __m128 r = _mm_sub_ps(c, nf);
+    __m128 p = _mm_set1_ps(1.535336188319500E-4f);
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(1.339887440266574E-3f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(9.618437357674640E-3f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(5.550332471162809E-2f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(2.402264791363012E-1f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(6.931472028550421E-1f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(1.0f));
+    return victor_x_mm_ldexp_ps(p, n);
+  }
+
+  static inline __m128 victor_x_mm_exp2_fast_ps(__m128 x) {
+    const __m128 c = _mm_max_ps(_mm_set1_ps(-151.0f), _mm_min_ps(_mm_set1_ps(129.0f), x));
+    const __m128i n = victor_x_mm_cvtps_epi32_nearest(c);
+    const __m128 nf = _mm_cvtepi32_ps(n);
+    const __m128 r = _mm_sub_ps(c, nf);
+    __m128 p = _mm_set1_ps(1.112550730E-3f);
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(9.666282684E-3f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(5.557400361E-2f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(2.402235121E-1f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(6.931428313E-1f));
+    p = victor_x_mm_fmadd_ps(p, r, _mm_set1_ps(1.0f));
+    return victor_x_mm_ldexp_ps(p, n);
+  }
+
+  /* log(x) = e ln 2 + log(m), with m in [sqrt(0.5), sqrt(2)) taken
+     straight from the bits: adding 1 - sqrt(0.5) to the exponent
+     field before splitting it off rounds e so that we never need a
+     compare.  log(1 + f) = f - f^2/2 + f^3 P(f).  The accurate
+     version rescales denormals first; the fast one treats them as
+     zero. */
+  static inline __m128 victor_x_mm_log_ps(__m128 x) {
+    const __m128 tiny = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+    const __m128 xs = victor_x_mm_blendv_ps(x, _mm_mul_ps(x, _mm_set1_ps(8388608.0f)), tiny);
+    const __m128i bits = _mm_add_epi32(_mm_castps_si128(xs), _mm_set1_epi32(0x004afb0d));
+    const __m128 ef = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)), _mm_and_si128(_mm_castps_si128(tiny), _mm_set1_epi32(23))));
+    const __m128 f = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f3504f3))), _mm_set1_ps(1.0f));
+    const __m128 z = _mm_mul_ps(f, f);
+    const __m128 ok = _mm_and_ps(_mm_cmpgt_ps(x, _mm_set1_ps(0.0f)), _mm_cmplt_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000))));
+    const __m128 special = victor_x_mm_blendv_ps(_mm_castsi128_ps(_mm_set1_epi32(0x7fc00000)), victor_x_mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32(-8388608)), _mm_cmple_ps(x, _mm_set1_ps(0.0f))), _mm_cmpge_ps(x, _mm_set1_ps(0.0f)));
+    __m128 y = _mm_set1_ps(7.0376836292E-2f);
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-1.1514610310E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(1.1676998740E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-1.2420140846E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(1.4249322787E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-1.6668057665E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(2.0000714765E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-2.4999993993E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(3.3333331174E-1f));
+    y = _mm_mul_ps(_mm_mul_ps(y, f), z);
+    y = victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), y);
+    y = victor_x_mm_fmadd_ps(ef, _mm_set1_ps(-2.12194440e-4f), y);
+    return victor_x_mm_blendv_ps(special, victor_x_mm_fmadd_ps(ef, _mm_set1_ps(0.693359375f), _mm_add_ps(f, y)), ok);
+  }
+
+  static inline __m128 victor_x_mm_log_fast_ps(__m128 x) {
+    const __m128i bits = _mm_add_epi32(_mm_castps_si128(x), _mm_set1_epi32(0x004afb0d));
+    const __m128 ef = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    const __m128 f = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f3504f3))), _mm_set1_ps(1.0f));
+    const __m128 z = _mm_mul_ps(f, f);
+    const __m128 ok = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(1.17549435e-38f)), _mm_cmplt_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000))));
+    const __m128 special = victor_x_mm_blendv_ps(_mm_castsi128_ps(_mm_set1_epi32(0x7fc00000)), victor_x_mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32(-8388608)), _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f))), _mm_cmpge_ps(x, _mm_set1_ps(0.0f)));
+    __m128 y = _mm_set1_ps(-1.019173265E-1f);
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(1.602438092E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-1.713712662E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(1.992450356E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-2.498326749E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(3.333424628E-1f));
+    y = _mm_mul_ps(_mm_mul_ps(y, f), z);
+    y = victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), y);
+    return victor_x_mm_blendv_ps(special, victor_x_mm_fmadd_ps(ef, _mm_set1_ps(0.693147181f), _mm_add_ps(f, y)), ok);
+  }
+
+  static inline __m128 victor_x_mm_log2_ps(__m128 x) {
+    const __m128 tiny = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+    const __m128 xs = victor_x_mm_blendv_ps(x, _mm_mul_ps(x, _mm_set1_ps(8388608.0f)), tiny);
+    const __m128i bits = _mm_add_epi32(_mm_castps_si128(xs), _mm_set1_epi32(0x004afb0d));
+    const __m128 ef = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)), _mm_and_si128(_mm_castps_si128(tiny), _mm_set1_epi32(23))));
+    const __m128 f = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f3504f3))), _mm_set1_ps(1.0f));
+    const __m128 z = _mm_mul_ps(f, f);
+    const __m128 ok = _mm_and_ps(_mm_cmpgt_ps(x, _mm_set1_ps(0.0f)), _mm_cmplt_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000))));
+    const __m128 special = victor_x_mm_blendv_ps(_mm_castsi128_ps(_mm_set1_epi32(0x7fc00000)), victor_x_mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32(-8388608)), _mm_cmple_ps(x, _mm_set1_ps(0.0f))), _mm_cmpge_ps(x, _mm_set1_ps(0.0f)));
+    __m128 y = _mm_set1_ps(7.0376836292E-2f);
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-1.1514610310E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(1.1676998740E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-1.2420140846E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(1.4249322787E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-1.6668057665E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(2.0000714765E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-2.4999993993E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(3.3333331174E-1f));
+    y = _mm_mul_ps(_mm_mul_ps(y, f), z);
+    y = victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), y);
+    return victor_x_mm_blendv_ps(special, _mm_add_ps(_mm_add_ps(_mm_add_ps(victor_x_mm_fmadd_ps(f, _mm_set1_ps(0.44269504088896341f), _mm_mul_ps(y, _mm_set1_ps(0.44269504088896341f))), y), f), ef), ok);
+  }
+
+  static inline __m128 victor_x_mm_log2_fast_ps(__m128 x) {
+    const __m128i bits = _mm_add_epi32(_mm_castps_si128(x), _mm_set1_epi32(0x004afb0d));
+    const __m128 ef = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    const __m128 f = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f3504f3))), _mm_set1_ps(1.0f));
+    const __m128 z = _mm_mul_ps(f, f);
+    const __m128 ok = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(1.17549435e-38f)), _mm_cmplt_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000))));
+    const __m128 special = victor_x_mm_blendv_ps(_mm_castsi128_ps(_mm_set1_epi32(0x7fc00000)), victor_x_mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32(-8388608)), _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f))), _mm_cmpge_ps(x, _mm_set1_ps(0.0f)));
+    __m128 y = _mm_set1_ps(-1.019173265E-1f);
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(1.602438092E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-1.713712662E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(1.992450356E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(-2.498326749E-1f));
+    y = victor_x_mm_fmadd_ps(y, f, _mm_set1_ps(3.333424628E-1f));
+    y = _mm_mul_ps(_mm_mul_ps(y, f), z);
+    y = victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), y);
+    return victor_x_mm_blendv_ps(special, victor_x_mm_fmadd_ps(_mm_add_ps(f, y), _mm_set1_ps(1.44269504088896341f), ef), ok);
+  }
+
+  /* Reduce by q = round(x * 2 / pi) quadrants, then pick the sine or
+     cosine polynomial and the sign from the low bits of q.  The
+     accurate version reduces in double with pi / 2 split in two
+     (as in fdlibm), which keeps r good to |x| < 2^22; the fast one
+     stays in float, where the first product is exact for small q. */
+  static inline __m128 victor_x_mm_trig_reduce_ps(__m128 x, __m128i* q) {
+    const __m128d xl = _mm_cvtps_pd(x);
+    const __m128d xh = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+    const __m128i ql = victor_x_mm_cvtpd_epi32_nearest(_mm_mul_pd(xl, _mm_set1_pd(6.36619772367581382433e-01)));
+    const __m128i qh = victor_x_mm_cvtpd_epi32_nearest(_mm_mul_pd(xh, _mm_set1_pd(6.36619772367581382433e-01)));
+    const __m128d qlf = _mm_cvtepi32_pd(ql);
+    const __m128d qhf = _mm_cvtepi32_pd(qh);
+    const __m128d rl = victor_x_mm_fmadd_pd(qlf, _mm_set1_pd(-6.07710050650619224932e-11), victor_x_mm_fmadd_pd(qlf, _mm_set1_pd(-1.57079632673412561417e+00), xl));
+    const __m128d rh = victor_x_mm_fmadd_pd(qhf, _mm_set1_pd(-6.07710050650619224932e-11), victor_x_mm_fmadd_pd(qhf, _mm_set1_pd(-1.57079632673412561417e+00), xh));
+    *q = _mm_unpacklo_epi64(ql, qh);
+    return _mm_movelh_ps(_mm_cvtpd_ps(rl), _mm_cvtpd_ps(rh));
+  }
+
+  static inline __m128 victor_x_mm_sin_ps(__m128 x) {
+    __m128i q;
+    const __m128 r = victor_x_mm_trig_reduce_ps(x, &q);
+    const __m128 z = _mm_mul_ps(r, r);
+    __m128 ps = _mm_set1_ps(-1.9515295891E-4f);
+    __m128 pc = _mm_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm_fmadd_ps(_mm_mul_ps(ps, z), r, r);
+    pc = victor_x_mm_fmadd_ps(_mm_mul_ps(pc, z), z, victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), _mm_set1_ps(1.0f)));
+    return victor_x_mm_blendv_ps(_mm_xor_ps(victor_x_mm_blendv_ps(ps, pc, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)))), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30))), x, _mm_cmpeq_ps(x, _mm_set1_ps(0.0f)));
+  }
+
+  static inline __m128 victor_x_mm_cos_ps(__m128 x) {
+    __m128i q;
+    const __m128 r = victor_x_mm_trig_reduce_ps(x, &q);
+    const __m128i qc = _mm_add_epi32(q, _mm_set1_epi32(1));
+    const __m128 z = _mm_mul_ps(r, r);
+    __m128 ps = _mm_set1_ps(-1.9515295891E-4f);
+    __m128 pc = _mm_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm_fmadd_ps(_mm_mul_ps(ps, z), r, r);
+    pc = victor_x_mm_fmadd_ps(_mm_mul_ps(pc, z), z, victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), _mm_set1_ps(1.0f)));
+    return _mm_xor_ps(victor_x_mm_blendv_ps(ps, pc, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(qc, _mm_set1_epi32(1)), _mm_set1_epi32(1)))), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(qc, _mm_set1_epi32(2)), 30)));
+  }
+
+  static inline __m128 victor_x_mm_sincos_ps(__m128 x, __m128* c) {
+    __m128i q;
+    const __m128 r = victor_x_mm_trig_reduce_ps(x, &q);
+    const __m128i qc = _mm_add_epi32(q, _mm_set1_epi32(1));
+    const __m128 z = _mm_mul_ps(r, r);
+    __m128 ps = _mm_set1_ps(-1.9515295891E-4f);
+    __m128 pc = _mm_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm_fmadd_ps(_mm_mul_ps(ps, z), r, r);
+    pc = victor_x_mm_fmadd_ps(_mm_mul_ps(pc, z), z, victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), _mm_set1_ps(1.0f)));
+    *c = _mm_xor_ps(victor_x_mm_blendv_ps(ps, pc, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(qc, _mm_set1_epi32(1)), _mm_set1_epi32(1)))), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(qc, _mm_set1_epi32(2)), 30)));
+    return victor_x_mm_blendv_ps(_mm_xor_ps(victor_x_mm_blendv_ps(ps, pc, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)))), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30))), x, _mm_cmpeq_ps(x, _mm_set1_ps(0.0f)));
+  }
+
+  static inline __m128 victor_x_mm_sin_fast_ps(__m128 x) {
+    const __m128i q = victor_x_mm_cvtps_epi32_nearest(_mm_mul_ps(x, _mm_set1_ps(0.636619772367581343f)));
+    const __m128 qf = _mm_cvtepi32_ps(q);
+    const __m128 r = victor_x_mm_fnmadd_ps(qf, _mm_set1_ps(4.83826794896619e-4f), victor_x_mm_fnmadd_ps(qf, _mm_set1_ps(1.5703125f), x));
+    const __m128 z = _mm_mul_ps(r, r);
+    __m128 ps = _mm_set1_ps(8.163281716E-3f);
+    __m128 pc = _mm_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm_fmadd_ps(_mm_mul_ps(ps, z), r, r);
+    pc = victor_x_mm_fmadd_ps(_mm_mul_ps(pc, z), z, victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), _mm_set1_ps(1.0f)));
+    return victor_x_mm_blendv_ps(_mm_xor_ps(victor_x_mm_blendv_ps(ps, pc, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)))), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30))), x, _mm_cmpeq_ps(x, _mm_set1_ps(0.0f)));
+  }
+
+  static inline __m128 victor_x_mm_cos_fast_ps(__m128 x) {
+    const __m128i q = victor_x_mm_cvtps_epi32_nearest(_mm_mul_ps(x, _mm_set1_ps(0.636619772367581343f)));
+    const __m128 qf = _mm_cvtepi32_ps(q);
+    const __m128 r = victor_x_mm_fnmadd_ps(qf, _mm_set1_ps(4.83826794896619e-4f), victor_x_mm_fnmadd_ps(qf, _mm_set1_ps(1.5703125f), x));
+    const __m128i qc = _mm_add_epi32(q, _mm_set1_epi32(1));
+    const __m128 z = _mm_mul_ps(r, r);
+    __m128 ps = _mm_set1_ps(8.163281716E-3f);
+    __m128 pc = _mm_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm_fmadd_ps(_mm_mul_ps(ps, z), r, r);
+    pc = victor_x_mm_fmadd_ps(_mm_mul_ps(pc, z), z, victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), _mm_set1_ps(1.0f)));
+    return _mm_xor_ps(victor_x_mm_blendv_ps(ps, pc, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(qc, _mm_set1_epi32(1)), _mm_set1_epi32(1)))), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(qc, _mm_set1_epi32(2)), 30)));
+  }
+
+  static inline __m128 victor_x_mm_sincos_fast_ps(__m128 x, __m128* c) {
+    const __m128i q = victor_x_mm_cvtps_epi32_nearest(_mm_mul_ps(x, _mm_set1_ps(0.636619772367581343f)));
+    const __m128 qf = _mm_cvtepi32_ps(q);
+    const __m128 r = victor_x_mm_fnmadd_ps(qf, _mm_set1_ps(4.83826794896619e-4f), victor_x_mm_fnmadd_ps(qf, _mm_set1_ps(1.5703125f), x));
+    const __m128i qc = _mm_add_epi32(q, _mm_set1_epi32(1));
+    const __m128 z = _mm_mul_ps(r, r);
+    __m128 ps = _mm_set1_ps(8.163281716E-3f);
+    __m128 pc = _mm_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm_fmadd_ps(ps, z, _mm_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm_fmadd_ps(pc, z, _mm_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm_fmadd_ps(_mm_mul_ps(ps, z), r, r);
+    pc = victor_x_mm_fmadd_ps(_mm_mul_ps(pc, z), z, victor_x_mm_fnmadd_ps(z, _mm_set1_ps(0.5f), _mm_set1_ps(1.0f)));
+    *c = _mm_xor_ps(victor_x_mm_blendv_ps(ps, pc, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(qc, _mm_set1_epi32(1)), _mm_set1_epi32(1)))), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(qc, _mm_set1_epi32(2)), 30)));
+    return victor_x_mm_blendv_ps(_mm_xor_ps(victor_x_mm_blendv_ps(ps, pc, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)))), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30))), x, _mm_cmpeq_ps(x, _mm_set1_ps(0.0f)));
+  }
+
+  /* tanh(x) = 1 - 2 / (exp(2|x|) + 1) with the sign copied back,
+     except near zero where that would cancel; there we use an odd
+     polynomial. */
+  static inline __m128 victor_x_mm_tanh_ps(__m128 x) {
+    const __m128 ax = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+    const __m128 z = _mm_mul_ps(x, x);
+    const __m128 e = victor_x_mm_exp_ps(_mm_add_ps(ax, ax));
+    const __m128 t = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(e, _mm_set1_ps(1.0f))));
+    __m128 p = _mm_set1_ps(-5.70498872745E-3f);
+    p = victor_x_mm_fmadd_ps(p, z, _mm_set1_ps(2.06390887954E-2f));
+    p = victor_x_mm_fmadd_ps(p, z, _mm_set1_ps(-5.37397155531E-2f));
+    p = victor_x_mm_fmadd_ps(p, z, _mm_set1_ps(1.33314422036E-1f));
+    p = victor_x_mm_fmadd_ps(p, z, _mm_set1_ps(-3.33332819422E-1f));
+    p = victor_x_mm_fmadd_ps(_mm_mul_ps(p, z), ax, ax);
+    return _mm_or_ps(victor_x_mm_blendv_ps(t, p, _mm_cmplt_ps(ax, _mm_set1_ps(0.625f))), _mm_and_ps(x, _mm_set1_ps(-0.0f)));
+  }
+
+  static inline __m128 victor_x_mm_tanh_fast_ps(__m128 x) {
+    const __m128 ax = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+    const __m128 z = _mm_mul_ps(x, x);
+    const __m128 e = victor_x_mm_exp_fast_ps(_mm_add_ps(ax, ax));
+    const __m128 t = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(e, _mm_set1_ps(1.0f))));
+    __m128 p = _mm_set1_ps(1.519537345E-2f);
+    p = victor_x_mm_fmadd_ps(p, z, _mm_set1_ps(-5.194790289E-2f));
+    p = victor_x_mm_fmadd_ps(p, z, _mm_set1_ps(1.330817491E-1f));
+    p = victor_x_mm_fmadd_ps(p, z, _mm_set1_ps(-3.333234191E-1f));
+    p = victor_x_mm_fmadd_ps(_mm_mul_ps(p, z), ax, ax);
+    return _mm_or_ps(victor_x_mm_blendv_ps(t, p, _mm_cmplt_ps(ax, _mm_set1_ps(0.625f))), _mm_and_ps(x, _mm_set1_ps(-0.0f)));
+  }
+
+  /* pow(x, y) = 2^(y log2 |x|).  An error of d in y log2 |x| is an
+     error of d ln 2 in the result, so with |y log2 |x|| up to 150
+     float isn't enough; we do the middle part in double, where a
+     short series is plenty, and let the final conversion round.
+     The rest is the IEEE special cases: negative x with integer y,
+     zero and infinite x, NaN, and the cases which give exactly 1. */
+  static inline __m128d victor_x_mm_pow_log2_pd(__m128d x) {
+    const __m128i bits = _mm_add_epi64(_mm_castpd_si128(x), _mm_set1_epi64x(INT64_C(0x00095f619980c433)));
+    const __m128d e = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(bits, 52), _mm_set1_epi64x(INT64_C(0x4330000000000000)))), _mm_set1_pd(4503599627371519.0));
+    const __m128d m = _mm_castsi128_pd(_mm_add_epi64(_mm_and_si128(bits, _mm_set1_epi64x(INT64_C(0x000fffffffffffff))), _mm_set1_epi64x(INT64_C(0x3fe6a09e667f3bcd))));
+    const __m128d s = _mm_div_pd(_mm_sub_pd(m, _mm_set1_pd(1.0)), _mm_add_pd(m, _mm_set1_pd(1.0)));
+    const __m128d z = _mm_mul_pd(s, s);
+    __m128d l = _mm_set1_pd(0.26230818925253879);
+    l = victor_x_mm_fmadd_pd(l, z, _mm_set1_pd(0.3205988979753252));
+    l = victor_x_mm_fmadd_pd(l, z, _mm_set1_pd(0.41219858311113244));
+    l = victor_x_mm_fmadd_pd(l, z, _mm_set1_pd(0.57707801635558531));
+    l = victor_x_mm_fmadd_pd(l, z, _mm_set1_pd(0.96179669392597567));
+    l = victor_x_mm_fmadd_pd(l, z, _mm_set1_pd(2.8853900817779268));
+    return victor_x_mm_fmadd_pd(l, s, e);
+  }
+
+  static inline __m128d victor_x_mm_pow_exp2_pd(__m128d t) {
+    const __m128d k = _mm_add_pd(t, _mm_set1_pd(6755399441055744.0));
+    const __m128d r = _mm_sub_pd(t, _mm_sub_pd(k, _mm_set1_pd(6755399441055744.0)));
+    __m128d p = _mm_set1_pd(1.0178086009239696e-07);
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(1.3215486790144305e-06));
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(1.5252733804059838e-05));
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(0.00015403530393381606));
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(0.0013333558146428441));
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(0.0096181291076284769));
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(0.055504108664821576));
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(0.24022650695910069));
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(0.69314718055994529));
+    p = victor_x_mm_fmadd_pd(p, r, _mm_set1_pd(1.0));
+    return _mm_mul_pd(p, _mm_castsi128_pd(_mm_slli_epi64(_mm_add_epi64(_mm_castpd_si128(k), _mm_set1_epi64x(INT64_C(1023))), 52)));
+  }
+
+  static inline __m128d victor_x_mm_pow_core_pd(__m128d x, __m128d y) {
+    return victor_x_mm_pow_exp2_pd(_mm_max_pd(_mm_set1_pd(-200.0), _mm_min_pd(_mm_set1_pd(200.0), _mm_mul_pd(victor_x_mm_pow_log2_pd(x), y))));
+  }
+
+  static inline __m128 victor_x_mm_pow_ps(__m128 x, __m128 y) {
+    const __m128 ax = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+    const __m128 ay = _mm_andnot_ps(_mm_set1_ps(-0.0f), y);
+    __m128 r = _mm_movelh_ps(_mm_cvtpd_ps(victor_x_mm_pow_core_pd(_mm_cvtps_pd(ax), _mm_cvtps_pd(y))), _mm_cvtpd_ps(victor_x_mm_pow_core_pd(_mm_cvtps_pd(_mm_movehl_ps(ax, ax)), _mm_cvtps_pd(_mm_movehl_ps(y, y)))));
+    const __m128i yi = _mm_cvttps_epi32(y);
+    const __m128 yint = _mm_cmpeq_ps(_mm_cvtepi32_ps(yi), y);
+    const __m128 odd = _mm_and_ps(yint, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(yi, _mm_set1_epi32(1)), _mm_set1_epi32(1))));
+    const __m128 even = _mm_andnot_ps(odd, _mm_or_ps(yint, _mm_cmpge_ps(ay, _mm_set1_ps(16777216.0f))));
+    const __m128 zero = _mm_cmpeq_ps(ax, _mm_set1_ps(0.0f));
+    const __m128 inf = _mm_cmpeq_ps(ax, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)));
+    const __m128 huge = _mm_or_ps(_mm_and_ps(zero, _mm_cmplt_ps(y, _mm_set1_ps(0.0f))), _mm_and_ps(inf, _mm_cmpgt_ps(y, _mm_set1_ps(0.0f))));
+    const __m128 one = _mm_or_ps(_mm_or_ps(_mm_cmpeq_ps(y, _mm_set1_ps(0.0f)), _mm_cmpeq_ps(x, _mm_set1_ps(1.0f))), _mm_and_ps(_mm_cmpeq_ps(ax, _mm_set1_ps(1.0f)), _mm_cmpeq_ps(ay, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)))));
+    r = victor_x_mm_blendv_ps(r, _mm_and_ps(huge, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000))), _mm_or_ps(zero, inf));
+    r = _mm_xor_ps(r, _mm_and_ps(odd, _mm_and_ps(x, _mm_set1_ps(-0.0f))));
+    r = victor_x_mm_blendv_ps(r, _mm_castsi128_ps(_mm_set1_epi32(0x7fc00000)), _mm_or_ps(_mm_cmpunord_ps(x, y), _mm_andnot_ps(_mm_or_ps(odd, even), _mm_andnot_ps(inf, _mm_cmplt_ps(x, _mm_set1_ps(0.0f))))));
+    return victor_x_mm_blendv_ps(r, _mm_set1_ps(1.0f), one);
+  }
+
+  static inline __m128 victor_x_mm_pow_fast_ps(__m128 x, __m128 y) {
+    return victor_x_mm_exp2_fast_ps(_mm_mul_ps(y, victor_x_mm_log2_fast_ps(x)));
+  }
+#endif /* defined(VICTOR_ENABLE_SSE2) */
+
+#if defined(VICTOR_ENABLE_AVX2)
+  static inline __m256 victor_x_mm256_ldexp_ps(__m256 p, __m256i n) {
+    const __m256i n1 = _mm256_srai_epi32(n, 1);
+    const __m256i n2 = _mm256_sub_epi32(n, n1);
+    p = _mm256_mul_ps(p, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n1, _mm256_set1_epi32(127)), 23)));
+    return _mm256_mul_ps(p, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n2, _mm256_set1_epi32(127)), 23)));
+  }
+
+  static inline __m256 victor_x_mm256_sqrt_fast_ps(__m256 x) {
+    const __m256 y = _mm256_rsqrt_ps(x);
+    const __m256 big = _mm256_cmp_ps(y, _mm256_set1_ps(0.0f), _CMP_EQ_OQ);
+    const __m256 s = _mm256_mul_ps(x, y);
+    const __m256 r = victor_x_mm256_fmadd_ps(_mm256_mul_ps(s, victor_x_mm256_fnmadd_ps(s, y, _mm256_set1_ps(1.0f))), _mm256_set1_ps(0.5f), s);
+    return _mm256_blendv_ps(r, _mm256_or_ps(_mm256_and_ps(big, x), _mm256_and_ps(x, _mm256_set1_ps(-0.0f))), _mm256_or_ps(big, _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), y), _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_EQ_OQ)));
+  }
+
+  static inline __m256 victor_x_mm256_rsqrt_ps(__m256 x) {
+    const __m256 y = _mm256_rsqrt_ps(x);
+    const __m256 e = victor_x_mm256_fnmadd_ps(_mm256_mul_ps(x, y), y, _mm256_set1_ps(1.0f));
+    const __m256 r = victor_x_mm256_fmadd_ps(_mm256_mul_ps(y, e), victor_x_mm256_fmadd_ps(e, _mm256_set1_ps(0.375f), _mm256_set1_ps(0.5f)), y);
+    return _mm256_blendv_ps(r, y, _mm256_or_ps(_mm256_cmp_ps(y, _mm256_set1_ps(0.0f), _CMP_EQ_OQ), _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), y), _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_EQ_OQ)));
+  }
+
+  static inline __m256 victor_x_mm256_rcp_ps(__m256 x) {
+    const __m256 y = _mm256_rcp_ps(x);
+    const __m256 e = victor_x_mm256_fnmadd_ps(x, y, _mm256_set1_ps(1.0f));
+    const __m256 r = victor_x_mm256_fmadd_ps(_mm256_mul_ps(y, e), _mm256_add_ps(e, _mm256_set1_ps(1.0f)), y);
+    return _mm256_blendv_ps(r, y, _mm256_or_ps(_mm256_cmp_ps(y, _mm256_set1_ps(0.0f), _CMP_EQ_OQ), _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), y), _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_EQ_OQ)));
+  }
+
+  static inline __m256 victor_x_mm256_exp_ps(__m256 x) {
+    const __m256 c = _mm256_max_ps(_mm256_set1_ps(-104.0f), _mm256_min_ps(_mm256_set1_ps(89.0f), x));
+    const __m256i n = _mm256_cvtps_epi32(_mm256_round_ps(_mm256_mul_ps(c, _mm256_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256 nf = _mm256_cvtepi32_ps(n);
+    const __m256 r = victor_x_mm256_fnmadd_ps(nf, _mm256_set1_ps(-2.12194440e-4f), victor_x_mm256_fnmadd_ps(nf, _mm256_set1_ps(0.693359375f), c));
+    __m256 p = _mm256_set1_ps(1.9875691500E-4f);
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(1.3981999507E-3f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(8.3334519073E-3f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(4.1665795894E-2f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(1.6666665459E-1f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(5.0000001201E-1f));
+    p = victor_x_mm256_fmadd_ps(p, _mm256_mul_ps(r, r), _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+    return victor_x_mm256_ldexp_ps(p, n);
+  }
+
+  static inline __m256 victor_x_mm256_exp_fast_ps(__m256 x) {
+    const __m256 c = _mm256_max_ps(_mm256_set1_ps(-104.0f), _mm256_min_ps(_mm256_set1_ps(89.0f), x));
+    const __m256i n = _mm256_cvtps_epi32(_mm256_round_ps(_mm256_mul_ps(c, _mm256_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256 nf = _mm256_cvtepi32_ps(n);
+    const __m256 r = victor_x_mm256_fnmadd_ps(nf, _mm256_set1_ps(-2.12194440e-4f), victor_x_mm256_fnmadd_ps(nf, _mm256_set1_ps(0.693359375f), c));
+    __m256 p = _mm256_set1_ps(6.953325123E-3f);
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(4.187527299E-2f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(1.668765545E-1f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(4.999937415E-1f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(9.999937415E-1f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(1.0f));
+    return victor_x_mm256_ldexp_ps(p, n);
+  }
+
+  static inline __m256 victor_x_mm256_exp2_ps(__m256 x) {
+    const __m256 c = _mm256_max_ps(_mm256_set1_ps(-151.0f), _mm256_min_ps(_mm256_set1_ps(129.0f), x));
+    const __m256i n = _mm256_cvtps_epi32(_mm256_round_ps(c, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256 nf = _mm256_cvtepi32_ps(n);
+    const __m256 r = _mm256_sub_ps(c, nf);
+    __m256 p = _mm256_set1_ps(1.535336188319500E-4f);
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(1.339887440266574E-3f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(9.618437357674640E-3f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(5.550332471162809E-2f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(2.402264791363012E-1f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(6.931472028550421E-1f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(1.0f));
+    return victor_x_mm256_ldexp_ps(p, n);
+  }
+
+  static inline __m256 victor_x_mm256_exp2_fast_ps(__m256 x) {
+    const __m256 c = _mm256_max_ps(_mm256_set1_ps(-151.0f), _mm256_min_ps(_mm256_set1_ps(129.0f), x));
+    const __m256i n = _mm256_cvtps_epi32(_mm256_round_ps(c, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256 nf = _mm256_cvtepi32_ps(n);
+    const __m256 r = _mm256_sub_ps(c, nf);
+    __m256 p = _mm256_set1_ps(1.112550730E-3f);
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(9.666282684E-3f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(5.557400361E-2f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(2.402235121E-1f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(6.931428313E-1f));
+    p = victor_x_mm256_fmadd_ps(p, r, _mm256_set1_ps(1.0f));
+    return victor_x_mm256_ldexp_ps(p, n);
+  }
+
+  static inline __m256 victor_x_mm256_log_ps(__m256 x) {
+    const __m256 tiny = _mm256_cmp_ps(x, _mm256_set1_ps(1.17549435e-38f), _CMP_LT_OQ);
+    const __m256 xs = _mm256_blendv_ps(x, _mm256_mul_ps(x, _mm256_set1_ps(8388608.0f)), tiny);
+    const __m256i bits = _mm256_add_epi32(_mm256_castps_si256(xs), _mm256_set1_epi32(0x004afb0d));
+    const __m256 ef = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)), _mm256_and_si256(_mm256_castps_si256(tiny), _mm256_set1_epi32(23))));
+    const __m256 f = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f3504f3))), _mm256_set1_ps(1.0f));
+    const __m256 z = _mm256_mul_ps(f, f);
+    const __m256 ok = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_GT_OQ), _mm256_cmp_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_LT_OQ));
+    const __m256 special = _mm256_blendv_ps(_mm256_castsi256_ps(_mm256_set1_epi32(0x7fc00000)), _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(-8388608)), _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_LE_OQ)), _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_GE_OQ));
+    __m256 y = _mm256_set1_ps(7.0376836292E-2f);
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-1.1514610310E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(1.1676998740E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-1.2420140846E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(1.4249322787E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-1.6668057665E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(2.0000714765E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-2.4999993993E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(3.3333331174E-1f));
+    y = _mm256_mul_ps(_mm256_mul_ps(y, f), z);
+    y = victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), y);
+    y = victor_x_mm256_fmadd_ps(ef, _mm256_set1_ps(-2.12194440e-4f), y);
+    return _mm256_blendv_ps(special, victor_x_mm256_fmadd_ps(ef, _mm256_set1_ps(0.693359375f), _mm256_add_ps(f, y)), ok);
+  }
+
+  static inline __m256 victor_x_mm256_log_fast_ps(__m256 x) {
+    const __m256i bits = _mm256_add_epi32(_mm256_castps_si256(x), _mm256_set1_epi32(0x004afb0d));
+    const __m256 ef = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+    const __m256 f = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f3504f3))), _mm256_set1_ps(1.0f));
+    const __m256 z = _mm256_mul_ps(f, f);
+    const __m256 ok = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_set1_ps(1.17549435e-38f), _CMP_GE_OQ), _mm256_cmp_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_LT_OQ));
+    const __m256 special = _mm256_blendv_ps(_mm256_castsi256_ps(_mm256_set1_epi32(0x7fc00000)), _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(-8388608)), _mm256_cmp_ps(x, _mm256_set1_ps(1.17549435e-38f), _CMP_LT_OQ)), _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_GE_OQ));
+    __m256 y = _mm256_set1_ps(-1.019173265E-1f);
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(1.602438092E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-1.713712662E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(1.992450356E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-2.498326749E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(3.333424628E-1f));
+    y = _mm256_mul_ps(_mm256_mul_ps(y, f), z);
+    y = victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), y);
+    return _mm256_blendv_ps(special, victor_x_mm256_fmadd_ps(ef, _mm256_set1_ps(0.693147181f), _mm256_add_ps(f, y)), ok);
+  }
+
+  static inline __m256 victor_x_mm256_log2_ps(__m256 x) {
+    const __m256 tiny = _mm256_cmp_ps(x, _mm256_set1_ps(1.17549435e-38f), _CMP_LT_OQ);
+    const __m256 xs = _mm256_blendv_ps(x, _mm256_mul_ps(x, _mm256_set1_ps(8388608.0f)), tiny);
+    const __m256i bits = _mm256_add_epi32(_mm256_castps_si256(xs), _mm256_set1_epi32(0x004afb0d));
+    const __m256 ef = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)), _mm256_and_si256(_mm256_castps_si256(tiny), _mm256_set1_epi32(23))));
+    const __m256 f = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f3504f3))), _mm256_set1_ps(1.0f));
+    const __m256 z = _mm256_mul_ps(f, f);
+    const __m256 ok = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_GT_OQ), _mm256_cmp_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_LT_OQ));
+    const __m256 special = _mm256_blendv_ps(_mm256_castsi256_ps(_mm256_set1_epi32(0x7fc00000)), _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(-8388608)), _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_LE_OQ)), _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_GE_OQ));
+    __m256 y = _mm256_set1_ps(7.0376836292E-2f);
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-1.1514610310E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(1.1676998740E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-1.2420140846E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(1.4249322787E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-1.6668057665E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(2.0000714765E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-2.4999993993E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(3.3333331174E-1f));
+    y = _mm256_mul_ps(_mm256_mul_ps(y, f), z);
+    y = victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), y);
+    return _mm256_blendv_ps(special, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(victor_x_mm256_fmadd_ps(f, _mm256_set1_ps(0.44269504088896341f), _mm256_mul_ps(y, _mm256_set1_ps(0.44269504088896341f))), y), f), ef), ok);
+  }
+
+  static inline __m256 victor_x_mm256_log2_fast_ps(__m256 x) {
+    const __m256i bits = _mm256_add_epi32(_mm256_castps_si256(x), _mm256_set1_epi32(0x004afb0d));
+    const __m256 ef = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+    const __m256 f = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f3504f3))), _mm256_set1_ps(1.0f));
+    const __m256 z = _mm256_mul_ps(f, f);
+    const __m256 ok = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_set1_ps(1.17549435e-38f), _CMP_GE_OQ), _mm256_cmp_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_LT_OQ));
+    const __m256 special = _mm256_blendv_ps(_mm256_castsi256_ps(_mm256_set1_epi32(0x7fc00000)), _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(-8388608)), _mm256_cmp_ps(x, _mm256_set1_ps(1.17549435e-38f), _CMP_LT_OQ)), _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_GE_OQ));
+    __m256 y = _mm256_set1_ps(-1.019173265E-1f);
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(1.602438092E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-1.713712662E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(1.992450356E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(-2.498326749E-1f));
+    y = victor_x_mm256_fmadd_ps(y, f, _mm256_set1_ps(3.333424628E-1f));
+    y = _mm256_mul_ps(_mm256_mul_ps(y, f), z);
+    y = victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), y);
+    return _mm256_blendv_ps(special, victor_x_mm256_fmadd_ps(_mm256_add_ps(f, y), _mm256_set1_ps(1.44269504088896341f), ef), ok);
+  }
+
+  static inline __m256 victor_x_mm256_trig_reduce_ps(__m256 x, __m256i* q) {
+    const __m256d xl = _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+    const __m256d xh = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+    const __m128i ql = _mm256_cvtpd_epi32(_mm256_round_pd(_mm256_mul_pd(xl, _mm256_set1_pd(6.36619772367581382433e-01)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m128i qh = _mm256_cvtpd_epi32(_mm256_round_pd(_mm256_mul_pd(xh, _mm256_set1_pd(6.36619772367581382433e-01)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256d qlf = _mm256_cvtepi32_pd(ql);
+    const __m256d qhf = _mm256_cvtepi32_pd(qh);
+    const __m256d rl = victor_x_mm256_fmadd_pd(qlf, _mm256_set1_pd(-6.07710050650619224932e-11), victor_x_mm256_fmadd_pd(qlf, _mm256_set1_pd(-1.57079632673412561417e+00), xl));
+    const __m256d rh = victor_x_mm256_fmadd_pd(qhf, _mm256_set1_pd(-6.07710050650619224932e-11), victor_x_mm256_fmadd_pd(qhf, _mm256_set1_pd(-1.57079632673412561417e+00), xh));
+    *q = _mm256_inserti128_si256(_mm256_castsi128_si256(ql), qh, 1);
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(rl)), _mm256_cvtpd_ps(rh), 1);
+  }
+
+  static inline __m256 victor_x_mm256_sin_ps(__m256 x) {
+    __m256i q;
+    const __m256 r = victor_x_mm256_trig_reduce_ps(x, &q);
+    const __m256 z = _mm256_mul_ps(r, r);
+    __m256 ps = _mm256_set1_ps(-1.9515295891E-4f);
+    __m256 pc = _mm256_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm256_fmadd_ps(_mm256_mul_ps(ps, z), r, r);
+    pc = victor_x_mm256_fmadd_ps(_mm256_mul_ps(pc, z), z, victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), _mm256_set1_ps(1.0f)));
+    return _mm256_blendv_ps(_mm256_xor_ps(_mm256_blendv_ps(ps, pc, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)))), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30))), x, _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_EQ_OQ));
+  }
+
+  static inline __m256 victor_x_mm256_cos_ps(__m256 x) {
+    __m256i q;
+    const __m256 r = victor_x_mm256_trig_reduce_ps(x, &q);
+    const __m256i qc = _mm256_add_epi32(q, _mm256_set1_epi32(1));
+    const __m256 z = _mm256_mul_ps(r, r);
+    __m256 ps = _mm256_set1_ps(-1.9515295891E-4f);
+    __m256 pc = _mm256_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm256_fmadd_ps(_mm256_mul_ps(ps, z), r, r);
+    pc = victor_x_mm256_fmadd_ps(_mm256_mul_ps(pc, z), z, victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), _mm256_set1_ps(1.0f)));
+    return _mm256_xor_ps(_mm256_blendv_ps(ps, pc, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(qc, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)))), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(qc, _mm256_set1_epi32(2)), 30)));
+  }
+
+  static inline __m256 victor_x_mm256_sincos_ps(__m256 x, __m256* c) {
+    __m256i q;
+    const __m256 r = victor_x_mm256_trig_reduce_ps(x, &q);
+    const __m256i qc = _mm256_add_epi32(q, _mm256_set1_epi32(1));
+    const __m256 z = _mm256_mul_ps(r, r);
+    __m256 ps = _mm256_set1_ps(-1.9515295891E-4f);
+    __m256 pc = _mm256_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm256_fmadd_ps(_mm256_mul_ps(ps, z), r, r);
+    pc = victor_x_mm256_fmadd_ps(_mm256_mul_ps(pc, z), z, victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), _mm256_set1_ps(1.0f)));
+    *c = _mm256_xor_ps(_mm256_blendv_ps(ps, pc, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(qc, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)))), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(qc, _mm256_set1_epi32(2)), 30)));
+    return _mm256_blendv_ps(_mm256_xor_ps(_mm256_blendv_ps(ps, pc, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)))), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30))), x, _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_EQ_OQ));
+  }
+
+  static inline __m256 victor_x_mm256_sin_fast_ps(__m256 x) {
+    const __m256i q = _mm256_cvtps_epi32(_mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.636619772367581343f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256 qf = _mm256_cvtepi32_ps(q);
+    const __m256 r = victor_x_mm256_fnmadd_ps(qf, _mm256_set1_ps(4.83826794896619e-4f), victor_x_mm256_fnmadd_ps(qf, _mm256_set1_ps(1.5703125f), x));
+    const __m256 z = _mm256_mul_ps(r, r);
+    __m256 ps = _mm256_set1_ps(8.163281716E-3f);
+    __m256 pc = _mm256_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm256_fmadd_ps(_mm256_mul_ps(ps, z), r, r);
+    pc = victor_x_mm256_fmadd_ps(_mm256_mul_ps(pc, z), z, victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), _mm256_set1_ps(1.0f)));
+    return _mm256_blendv_ps(_mm256_xor_ps(_mm256_blendv_ps(ps, pc, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)))), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30))), x, _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_EQ_OQ));
+  }
+
+  static inline __m256 victor_x_mm256_cos_fast_ps(__m256 x) {
+    const __m256i q = _mm256_cvtps_epi32(_mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.636619772367581343f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256 qf = _mm256_cvtepi32_ps(q);
+    const __m256 r = victor_x_mm256_fnmadd_ps(qf, _mm256_set1_ps(4.83826794896619e-4f), victor_x_mm256_fnmadd_ps(qf, _mm256_set1_ps(1.5703125f), x));
+    const __m256i qc = _mm256_add_epi32(q, _mm256_set1_epi32(1));
+    const __m256 z = _mm256_mul_ps(r, r);
+    __m256 ps = _mm256_set1_ps(8.163281716E-3f);
+    __m256 pc = _mm256_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm256_fmadd_ps(_mm256_mul_ps(ps, z), r, r);
+    pc = victor_x_mm256_fmadd_ps(_mm256_mul_ps(pc, z), z, victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), _mm256_set1_ps(1.0f)));
+    return _mm256_xor_ps(_mm256_blendv_ps(ps, pc, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(qc, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)))), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(qc, _mm256_set1_epi32(2)), 30)));
+  }
+
+  static inline __m256 victor_x_mm256_sincos_fast_ps(__m256 x, __m256* c) {
+    const __m256i q = _mm256_cvtps_epi32(_mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.636619772367581343f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256 qf = _mm256_cvtepi32_ps(q);
+    const __m256 r = victor_x_mm256_fnmadd_ps(qf, _mm256_set1_ps(4.83826794896619e-4f), victor_x_mm256_fnmadd_ps(qf, _mm256_set1_ps(1.5703125f), x));
+    const __m256i qc = _mm256_add_epi32(q, _mm256_set1_epi32(1));
+    const __m256 z = _mm256_mul_ps(r, r);
+    __m256 ps = _mm256_set1_ps(8.163281716E-3f);
+    __m256 pc = _mm256_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm256_fmadd_ps(ps, z, _mm256_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm256_fmadd_ps(pc, z, _mm256_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm256_fmadd_ps(_mm256_mul_ps(ps, z), r, r);
+    pc = victor_x_mm256_fmadd_ps(_mm256_mul_ps(pc, z), z, victor_x_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), _mm256_set1_ps(1.0f)));
+    *c = _mm256_xor_ps(_mm256_blendv_ps(ps, pc, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(qc, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)))), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(qc, _mm256_set1_epi32(2)), 30)));
+    return _mm256_blendv_ps(_mm256_xor_ps(_mm256_blendv_ps(ps, pc, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)))), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30))), x, _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_EQ_OQ));
+  }
+
+  static inline __m256 victor_x_mm256_tanh_ps(__m256 x) {
+    const __m256 ax = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+    const __m256 z = _mm256_mul_ps(x, x);
+    const __m256 e = victor_x_mm256_exp_ps(_mm256_add_ps(ax, ax));
+    const __m256 t = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_div_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(e, _mm256_set1_ps(1.0f))));
+    __m256 p = _mm256_set1_ps(-5.70498872745E-3f);
+    p = victor_x_mm256_fmadd_ps(p, z, _mm256_set1_ps(2.06390887954E-2f));
+    p = victor_x_mm256_fmadd_ps(p, z, _mm256_set1_ps(-5.37397155531E-2f));
+    p = victor_x_mm256_fmadd_ps(p, z, _mm256_set1_ps(1.33314422036E-1f));
+    p = victor_x_mm256_fmadd_ps(p, z, _mm256_set1_ps(-3.33332819422E-1f));
+    p = victor_x_mm256_fmadd_ps(_mm256_mul_ps(p, z), ax, ax);
+    return _mm256_or_ps(_mm256_blendv_ps(t, p, _mm256_cmp_ps(ax, _mm256_set1_ps(0.625f), _CMP_LT_OQ)), _mm256_and_ps(x, _mm256_set1_ps(-0.0f)));
+  }
+
+  static inline __m256 victor_x_mm256_tanh_fast_ps(__m256 x) {
+    const __m256 ax = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+    const __m256 z = _mm256_mul_ps(x, x);
+    const __m256 e = victor_x_mm256_exp_fast_ps(_mm256_add_ps(ax, ax));
+    const __m256 t = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_div_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(e, _mm256_set1_ps(1.0f))));
+    __m256 p = _mm256_set1_ps(1.519537345E-2f);
+    p = victor_x_mm256_fmadd_ps(p, z, _mm256_set1_ps(-5.194790289E-2f));
+    p = victor_x_mm256_fmadd_ps(p, z, _mm256_set1_ps(1.330817491E-1f));
+    p = victor_x_mm256_fmadd_ps(p, z, _mm256_set1_ps(-3.333234191E-1f));
+    p = victor_x_mm256_fmadd_ps(_mm256_mul_ps(p, z), ax, ax);
+    return _mm256_or_ps(_mm256_blendv_ps(t, p, _mm256_cmp_ps(ax, _mm256_set1_ps(0.625f), _CMP_LT_OQ)), _mm256_and_ps(x, _mm256_set1_ps(-0.0f)));
+  }
+
+  static inline __m256d victor_x_mm256_pow_log2_pd(__m256d x) {
+    const __m256i bits = _mm256_add_epi64(_mm256_castpd_si256(x), _mm256_set1_epi64x(INT64_C(0x00095f619980c433)));
+    const __m256d e = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(INT64_C(0x4330000000000000)))), _mm256_set1_pd(4503599627371519.0));
+    const __m256d m = _mm256_castsi256_pd(_mm256_add_epi64(_mm256_and_si256(bits, _mm256_set1_epi64x(INT64_C(0x000fffffffffffff))), _mm256_set1_epi64x(INT64_C(0x3fe6a09e667f3bcd))));
+    const __m256d s = _mm256_div_pd(_mm256_sub_pd(m, _mm256_set1_pd(1.0)), _mm256_add_pd(m, _mm256_set1_pd(1.0)));
+    const __m256d z = _mm256_mul_pd(s, s);
+    __m256d l = _mm256_set1_pd(0.26230818925253879);
+    l = victor_x_mm256_fmadd_pd(l, z, _mm256_set1_pd(0.3205988979753252));
+    l = victor_x_mm256_fmadd_pd(l, z, _mm256_set1_pd(0.41219858311113244));
+    l = victor_x_mm256_fmadd_pd(l, z, _mm256_set1_pd(0.57707801635558531));
+    l = victor_x_mm256_fmadd_pd(l, z, _mm256_set1_pd(0.96179669392597567));
+    l = victor_x_mm256_fmadd_pd(l, z, _mm256_set1_pd(2.8853900817779268));
+    return victor_x_mm256_fmadd_pd(l, s, e);
+  }
+
+  static inline __m256d victor_x_mm256_pow_exp2_pd(__m256d t) {
+    const __m256d k = _mm256_add_pd(t, _mm256_set1_pd(6755399441055744.0));
+    const __m256d r = _mm256_sub_pd(t, _mm256_sub_pd(k, _mm256_set1_pd(6755399441055744.0)));
+    __m256d p = _mm256_set1_pd(1.0178086009239696e-07);
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(1.3215486790144305e-06));
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(1.5252733804059838e-05));
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(0.00015403530393381606));
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(0.0013333558146428441));
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(0.0096181291076284769));
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(0.055504108664821576));
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(0.24022650695910069));
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(0.69314718055994529));
+    p = victor_x_mm256_fmadd_pd(p, r, _mm256_set1_pd(1.0));
+    return _mm256_mul_pd(p, _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(_mm256_castpd_si256(k), _mm256_set1_epi64x(INT64_C(1023))), 52)));
+  }
+
+  static inline __m256d victor_x_mm256_pow_core_pd(__m256d x, __m256d y) {
+    return victor_x_mm256_pow_exp2_pd(_mm256_max_pd(_mm256_set1_pd(-200.0), _mm256_min_pd(_mm256_set1_pd(200.0), _mm256_mul_pd(victor_x_mm256_pow_log2_pd(x), y))));
+  }
+
+  static inline __m256 victor_x_mm256_pow_ps(__m256 x, __m256 y) {
+    const __m256 ax = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+    const __m256 ay = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), y);
+    __m256 r = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(victor_x_mm256_pow_core_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(ax)), _mm256_cvtps_pd(_mm256_castps256_ps128(y))))), _mm256_cvtpd_ps(victor_x_mm256_pow_core_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(ax, 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(y, 1)))), 1);
+    const __m256i yi = _mm256_cvttps_epi32(y);
+    const __m256 yint = _mm256_cmp_ps(_mm256_cvtepi32_ps(yi), y, _CMP_EQ_OQ);
+    const __m256 odd = _mm256_and_ps(yint, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(yi, _mm256_set1_epi32(1)), _mm256_set1_epi32(1))));
+    const __m256 even = _mm256_andnot_ps(odd, _mm256_or_ps(yint, _mm256_cmp_ps(ay, _mm256_set1_ps(16777216.0f), _CMP_GE_OQ)));
+    const __m256 zero = _mm256_cmp_ps(ax, _mm256_set1_ps(0.0f), _CMP_EQ_OQ);
+    const __m256 inf = _mm256_cmp_ps(ax, _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_EQ_OQ);
+    const __m256 huge = _mm256_or_ps(_mm256_and_ps(zero, _mm256_cmp_ps(y, _mm256_set1_ps(0.0f), _CMP_LT_OQ)), _mm256_and_ps(inf, _mm256_cmp_ps(y, _mm256_set1_ps(0.0f), _CMP_GT_OQ)));
+    const __m256 one = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(y, _mm256_set1_ps(0.0f), _CMP_EQ_OQ), _mm256_cmp_ps(x, _mm256_set1_ps(1.0f), _CMP_EQ_OQ)), _mm256_and_ps(_mm256_cmp_ps(ax, _mm256_set1_ps(1.0f), _CMP_EQ_OQ), _mm256_cmp_ps(ay, _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_EQ_OQ)));
+    r = _mm256_blendv_ps(r, _mm256_and_ps(huge, _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000))), _mm256_or_ps(zero, inf));
+    r = _mm256_xor_ps(r, _mm256_and_ps(odd, _mm256_and_ps(x, _mm256_set1_ps(-0.0f))));
+    r = _mm256_blendv_ps(r, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fc00000)), _mm256_or_ps(_mm256_cmp_ps(x, y, _CMP_UNORD_Q), _mm256_andnot_ps(_mm256_or_ps(odd, even), _mm256_andnot_ps(inf, _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_LT_OQ)))));
+    return _mm256_blendv_ps(r, _mm256_set1_ps(1.0f), one);
+  }
+
+  static inline __m256 victor_x_mm256_pow_fast_ps(__m256 x, __m256 y) {
+    return victor_x_mm256_exp2_fast_ps(_mm256_mul_ps(y, victor_x_mm256_log2_fast_ps(x)));
+  }
+#endif /* defined(VICTOR_ENABLE_AVX2) */
+
+#if defined(VICTOR_ENABLE_AVX512F)
+  /* AVX-512F only has floating-point bitwise operations with AVX-512DQ. */
+  static inline __m512 victor_x_mm512_and_ps(__m512 a, __m512 b) {
+    #if defined(VICTOR_ENABLE_AVX512DQ)
+      return _mm512_and_ps(a, b);
+    #else
+      return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+    #endif
+  }
+
+  static inline __m512 victor_x_mm512_or_ps(__m512 a, __m512 b) {
+    #if defined(VICTOR_ENABLE_AVX512DQ)
+      return _mm512_or_ps(a, b);
+    #else
+      return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+    #endif
+  }
+
+  static inline __m512 victor_x_mm512_xor_ps(__m512 a, __m512 b) {
+    #if defined(VICTOR_ENABLE_AVX512DQ)
+      return _mm512_xor_ps(a, b);
+    #else
+      return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+    #endif
+  }
+
+  static inline __m512 victor_x_mm512_andnot_ps(__m512 a, __m512 b) {
+    #if defined(VICTOR_ENABLE_AVX512DQ)
+      return _mm512_andnot_ps(a, b);
+    #else
+      return _mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+    #endif
+  }
+
+  static inline __m512 victor_x_mm512_fmadd_ps(__m512 a, __m512 b, __m512 c) {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+
+  static inline __m512d victor_x_mm512_fmadd_pd(__m512d a, __m512d b, __m512d c) {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+
+  static inline __m512 victor_x_mm512_fnmadd_ps(__m512 a, __m512 b, __m512 c) {
+    return _mm512_fnmadd_ps(a, b, c);
+  }
+
+  static inline __m512 victor_x_mm512_sqrt_fast_ps(__m512 x) {
+    const __m512 y = _mm512_rsqrt14_ps(x);
+    const __mmask16 big = _mm512_cmp_ps_mask(y, _mm512_set1_ps(0.0f), _CMP_EQ_OQ);
+    const __m512 s = _mm512_mul_ps(x, y);
+    const __m512 r = victor_x_mm512_fmadd_ps(_mm512_mul_ps(s, victor_x_mm512_fnmadd_ps(s, y, _mm512_set1_ps(1.0f))), _mm512_set1_ps(0.5f), s);
+    return _mm512_mask_blend_ps(_mm512_kor(big, _mm512_cmp_ps_mask(victor_x_mm512_andnot_ps(_mm512_set1_ps(-0.0f), y), _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_EQ_OQ)), r, victor_x_mm512_or_ps(_mm512_maskz_mov_ps(big, x), victor_x_mm512_and_ps(x, _mm512_set1_ps(-0.0f))));
+  }
+
+  static inline __m512 victor_x_mm512_rsqrt_ps(__m512 x) {
+    const __m512 y = _mm512_rsqrt14_ps(x);
+    const __m512 e = victor_x_mm512_fnmadd_ps(_mm512_mul_ps(x, y), y, _mm512_set1_ps(1.0f));
+    const __m512 r = victor_x_mm512_fmadd_ps(_mm512_mul_ps(y, e), victor_x_mm512_fmadd_ps(e, _mm512_set1_ps(0.375f), _mm512_set1_ps(0.5f)), y);
+    return _mm512_mask_blend_ps(_mm512_kor(_mm512_cmp_ps_mask(y, _mm512_set1_ps(0.0f), _CMP_EQ_OQ), _mm512_cmp_ps_mask(victor_x_mm512_andnot_ps(_mm512_set1_ps(-0.0f), y), _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_EQ_OQ)), r, y);
+  }
+
+  static inline __m512 victor_x_mm512_rcp_ps(__m512 x) {
+    const __m512 y = _mm512_rcp14_ps(x);
+    const __m512 e = victor_x_mm512_fnmadd_ps(x, y, _mm512_set1_ps(1.0f));
+    const __m512 r = victor_x_mm512_fmadd_ps(_mm512_mul_ps(y, e), _mm512_add_ps(e, _mm512_set1_ps(1.0f)), y);
+    return _mm512_mask_blend_ps(_mm512_kor(_mm512_cmp_ps_mask(y, _mm512_set1_ps(0.0f), _CMP_EQ_OQ), _mm512_cmp_ps_mask(victor_x_mm512_andnot_ps(_mm512_set1_ps(-0.0f), y), _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_EQ_OQ)), r, y);
+  }
+
+  static inline __m512 victor_x_mm512_exp_ps(__m512 x) {
+    const __m512 c = _mm512_max_ps(_mm512_set1_ps(-104.0f), _mm512_min_ps(_mm512_set1_ps(89.0f), x));
+    const __m512 nf = _mm512_roundscale_ps(_mm512_mul_ps(c, _mm512_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m512 r = victor_x_mm512_fnmadd_ps(nf, _mm512_set1_ps(-2.12194440e-4f), victor_x_mm512_fnmadd_ps(nf, _mm512_set1_ps(0.693359375f), c));
+    __m512 p = _mm512_set1_ps(1.9875691500E-4f);
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(1.3981999507E-3f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(8.3334519073E-3f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(4.1665795894E-2f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(1.6666665459E-1f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(5.0000001201E-1f));
+    p = victor_x_mm512_fmadd_ps(p, _mm512_mul_ps(r, r), _mm512_add_ps(r, _mm512_set1_ps(1.0f)));
+    return _mm512_scalef_ps(p, nf);
+  }
+
+  static inline __m512 victor_x_mm512_exp_fast_ps(__m512 x) {
+    const __m512 c = _mm512_max_ps(_mm512_set1_ps(-104.0f), _mm512_min_ps(_mm512_set1_ps(89.0f), x));
+    const __m512 nf = _mm512_roundscale_ps(_mm512_mul_ps(c, _mm512_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m512 r = victor_x_mm512_fnmadd_ps(nf, _mm512_set1_ps(-2.12194440e-4f), victor_x_mm512_fnmadd_ps(nf, _mm512_set1_ps(0.693359375f), c));
+    __m512 p = _mm512_set1_ps(6.953325123E-3f);
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(4.187527299E-2f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(1.668765545E-1f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(4.999937415E-1f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(9.999937415E-1f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(1.0f));
+    return _mm512_scalef_ps(p, nf);
+  }
+
+  static inline __m512 victor_x_mm512_exp2_ps(__m512 x) {
+    const __m512 c = _mm512_max_ps(_mm512_set1_ps(-151.0f), _mm512_min_ps(_mm512_set1_ps(129.0f), x));
+    const __m512 nf = _mm512_roundscale_ps(c, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m512 r = _mm512_sub_ps(c, nf);
+    __m512 p = _mm512_set1_ps(1.535336188319500E-4f);
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(1.339887440266574E-3f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(9.618437357674640E-3f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(5.550332471162809E-2f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(2.402264791363012E-1f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(6.931472028550421E-1f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(1.0f));
+    return _mm512_scalef_ps(p, nf);
+  }
+
+  static inline __m512 victor_x_mm512_exp2_fast_ps(__m512 x) {
+    const __m512 c = _mm512_max_ps(_mm512_set1_ps(-151.0f), _mm512_min_ps(_mm512_set1_ps(129.0f), x));
+    const __m512 nf = _mm512_roundscale_ps(c, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m512 r = _mm512_sub_ps(c, nf);
+    __m512 p = _mm512_set1_ps(1.112550730E-3f);
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(9.666282684E-3f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(5.557400361E-2f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(2.402235121E-1f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(6.931428313E-1f));
+    p = victor_x_mm512_fmadd_ps(p, r, _mm512_set1_ps(1.0f));
+    return _mm512_scalef_ps(p, nf);
+  }
+
+  static inline __m512 victor_x_mm512_log_ps(__m512 x) {
+    const __mmask16 tiny = _mm512_cmp_ps_mask(x, _mm512_set1_ps(1.17549435e-38f), _CMP_LT_OQ);
+    const __m512 xs = _mm512_mask_blend_ps(tiny, x, _mm512_mul_ps(x, _mm512_set1_ps(8388608.0f)));
+    const __m512i bits = _mm512_add_epi32(_mm512_castps_si512(xs), _mm512_set1_epi32(0x004afb0d));
+    const __m512 ef = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(127)), _mm512_maskz_mov_epi32(tiny, _mm512_set1_epi32(23))));
+    const __m512 f = _mm512_sub_ps(_mm512_castsi512_ps(_mm512_add_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f3504f3))), _mm512_set1_ps(1.0f));
+    const __m512 z = _mm512_mul_ps(f, f);
+    const __mmask16 ok = _mm512_kand(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_GT_OQ), _mm512_cmp_ps_mask(x, _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_LT_OQ));
+    const __m512 special = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_GE_OQ), _mm512_castsi512_ps(_mm512_set1_epi32(0x7fc00000)), _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_LE_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32(-8388608))));
+    __m512 y = _mm512_set1_ps(7.0376836292E-2f);
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-1.1514610310E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(1.1676998740E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-1.2420140846E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(1.4249322787E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-1.6668057665E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(2.0000714765E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-2.4999993993E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(3.3333331174E-1f));
+    y = _mm512_mul_ps(_mm512_mul_ps(y, f), z);
+    y = victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+    y = victor_x_mm512_fmadd_ps(ef, _mm512_set1_ps(-2.12194440e-4f), y);
+    return _mm512_mask_blend_ps(ok, special, victor_x_mm512_fmadd_ps(ef, _mm512_set1_ps(0.693359375f), _mm512_add_ps(f, y)));
+  }
+
+  static inline __m512 victor_x_mm512_log_fast_ps(__m512 x) {
+    const __m512i bits = _mm512_add_epi32(_mm512_castps_si512(x), _mm512_set1_epi32(0x004afb0d));
+    const __m512 ef = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(127)));
+    const __m512 f = _mm512_sub_ps(_mm512_castsi512_ps(_mm512_add_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f3504f3))), _mm512_set1_ps(1.0f));
+    const __m512 z = _mm512_mul_ps(f, f);
+    const __mmask16 ok = _mm512_kand(_mm512_cmp_ps_mask(x, _mm512_set1_ps(1.17549435e-38f), _CMP_GE_OQ), _mm512_cmp_ps_mask(x, _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_LT_OQ));
+    const __m512 special = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_GE_OQ), _mm512_castsi512_ps(_mm512_set1_epi32(0x7fc00000)), _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(1.17549435e-38f), _CMP_LT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32(-8388608))));
+    __m512 y = _mm512_set1_ps(-1.019173265E-1f);
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(1.602438092E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-1.713712662E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(1.992450356E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-2.498326749E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(3.333424628E-1f));
+    y = _mm512_mul_ps(_mm512_mul_ps(y, f), z);
+    y = victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+    return _mm512_mask_blend_ps(ok, special, victor_x_mm512_fmadd_ps(ef, _mm512_set1_ps(0.693147181f), _mm512_add_ps(f, y)));
+  }
+
+  static inline __m512 victor_x_mm512_log2_ps(__m512 x) {
+    const __mmask16 tiny = _mm512_cmp_ps_mask(x, _mm512_set1_ps(1.17549435e-38f), _CMP_LT_OQ);
+    const __m512 xs = _mm512_mask_blend_ps(tiny, x, _mm512_mul_ps(x, _mm512_set1_ps(8388608.0f)));
+    const __m512i bits = _mm512_add_epi32(_mm512_castps_si512(xs), _mm512_set1_epi32(0x004afb0d));
+    const __m512 ef = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(127)), _mm512_maskz_mov_epi32(tiny, _mm512_set1_epi32(23))));
+    const __m512 f = _mm512_sub_ps(_mm512_castsi512_ps(_mm512_add_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f3504f3))), _mm512_set1_ps(1.0f));
+    const __m512 z = _mm512_mul_ps(f, f);
+    const __mmask16 ok = _mm512_kand(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_GT_OQ), _mm512_cmp_ps_mask(x, _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_LT_OQ));
+    const __m512 special = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_GE_OQ), _mm512_castsi512_ps(_mm512_set1_epi32(0x7fc00000)), _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_LE_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32(-8388608))));
+    __m512 y = _mm512_set1_ps(7.0376836292E-2f);
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-1.1514610310E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(1.1676998740E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-1.2420140846E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(1.4249322787E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-1.6668057665E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(2.0000714765E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-2.4999993993E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(3.3333331174E-1f));
+    y = _mm512_mul_ps(_mm512_mul_ps(y, f), z);
+    y = victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+    return _mm512_mask_blend_ps(ok, special, _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(victor_x_mm512_fmadd_ps(f, _mm512_set1_ps(0.44269504088896341f), _mm512_mul_ps(y, _mm512_set1_ps(0.44269504088896341f))), y), f), ef));
+  }
+
+  static inline __m512 victor_x_mm512_log2_fast_ps(__m512 x) {
+    const __m512i bits = _mm512_add_epi32(_mm512_castps_si512(x), _mm512_set1_epi32(0x004afb0d));
+    const __m512 ef = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(127)));
+    const __m512 f = _mm512_sub_ps(_mm512_castsi512_ps(_mm512_add_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f3504f3))), _mm512_set1_ps(1.0f));
+    const __m512 z = _mm512_mul_ps(f, f);
+    const __mmask16 ok = _mm512_kand(_mm512_cmp_ps_mask(x, _mm512_set1_ps(1.17549435e-38f), _CMP_GE_OQ), _mm512_cmp_ps_mask(x, _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_LT_OQ));
+    const __m512 special = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_GE_OQ), _mm512_castsi512_ps(_mm512_set1_epi32(0x7fc00000)), _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(1.17549435e-38f), _CMP_LT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32(-8388608))));
+    __m512 y = _mm512_set1_ps(-1.019173265E-1f);
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(1.602438092E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-1.713712662E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(1.992450356E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(-2.498326749E-1f));
+    y = victor_x_mm512_fmadd_ps(y, f, _mm512_set1_ps(3.333424628E-1f));
+    y = _mm512_mul_ps(_mm512_mul_ps(y, f), z);
+    y = victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+    return _mm512_mask_blend_ps(ok, special, victor_x_mm512_fmadd_ps(_mm512_add_ps(f, y), _mm512_set1_ps(1.44269504088896341f), ef));
+  }
+
+  static inline __m512 victor_x_mm512_trig_reduce_ps(__m512 x, __m512i* q) {
+    const __m512d xl = _mm512_cvtps_pd(_mm512_castps512_ps256(x));
+    const __m512d xh = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1)));
+    const __m256i ql = _mm512_cvt_roundpd_epi32(_mm512_mul_pd(xl, _mm512_set1_pd(6.36619772367581382433e-01)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m256i qh = _mm512_cvt_roundpd_epi32(_mm512_mul_pd(xh, _mm512_set1_pd(6.36619772367581382433e-01)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m512d qlf = _mm512_cvtepi32_pd(ql);
+    const __m512d qhf = _mm512_cvtepi32_pd(qh);
+    const __m512d rl = victor_x_mm512_fmadd_pd(qlf, _mm512_set1_pd(-6.07710050650619224932e-11), victor_x_mm512_fmadd_pd(qlf, _mm512_set1_pd(-1.57079632673412561417e+00), xl));
+    const __m512d rh = victor_x_mm512_fmadd_pd(qhf, _mm512_set1_pd(-6.07710050650619224932e-11), victor_x_mm512_fmadd_pd(qhf, _mm512_set1_pd(-1.57079632673412561417e+00), xh));
+    *q = _mm512_inserti64x4(_mm512_castsi256_si512(ql), qh, 1);
+    return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(rl))), _mm256_castps_pd(_mm512_cvtpd_ps(rh)), 1));
+  }
+
+  static inline __m512 victor_x_mm512_sin_ps(__m512 x) {
+    __m512i q;
+    const __m512 r = victor_x_mm512_trig_reduce_ps(x, &q);
+    const __m512 z = _mm512_mul_ps(r, r);
+    __m512 ps = _mm512_set1_ps(-1.9515295891E-4f);
+    __m512 pc = _mm512_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm512_fmadd_ps(_mm512_mul_ps(ps, z), r, r);
+    pc = victor_x_mm512_fmadd_ps(_mm512_mul_ps(pc, z), z, victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), _mm512_set1_ps(1.0f)));
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_EQ_OQ), victor_x_mm512_xor_ps(_mm512_mask_blend_ps(_mm512_test_epi32_mask(q, _mm512_set1_epi32(1)), ps, pc), _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_and_si512(q, _mm512_set1_epi32(2)), 30))), x);
+  }
+
+  static inline __m512 victor_x_mm512_cos_ps(__m512 x) {
+    __m512i q;
+    const __m512 r = victor_x_mm512_trig_reduce_ps(x, &q);
+    const __m512i qc = _mm512_add_epi32(q, _mm512_set1_epi32(1));
+    const __m512 z = _mm512_mul_ps(r, r);
+    __m512 ps = _mm512_set1_ps(-1.9515295891E-4f);
+    __m512 pc = _mm512_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm512_fmadd_ps(_mm512_mul_ps(ps, z), r, r);
+    pc = victor_x_mm512_fmadd_ps(_mm512_mul_ps(pc, z), z, victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), _mm512_set1_ps(1.0f)));
+    return victor_x_mm512_xor_ps(_mm512_mask_blend_ps(_mm512_test_epi32_mask(qc, _mm512_set1_epi32(1)), ps, pc), _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_and_si512(qc, _mm512_set1_epi32(2)), 30)));
+  }
+
+  static inline __m512 victor_x_mm512_sincos_ps(__m512 x, __m512* c) {
+    __m512i q;
+    const __m512 r = victor_x_mm512_trig_reduce_ps(x, &q);
+    const __m512i qc = _mm512_add_epi32(q, _mm512_set1_epi32(1));
+    const __m512 z = _mm512_mul_ps(r, r);
+    __m512 ps = _mm512_set1_ps(-1.9515295891E-4f);
+    __m512 pc = _mm512_set1_ps(2.443315711809948E-5f);
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(8.3321608736E-3f));
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(-1.6666654611E-1f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(-1.388731625493765E-3f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(4.166664568298827E-2f));
+    ps = victor_x_mm512_fmadd_ps(_mm512_mul_ps(ps, z), r, r);
+    pc = victor_x_mm512_fmadd_ps(_mm512_mul_ps(pc, z), z, victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), _mm512_set1_ps(1.0f)));
+    *c = victor_x_mm512_xor_ps(_mm512_mask_blend_ps(_mm512_test_epi32_mask(qc, _mm512_set1_epi32(1)), ps, pc), _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_and_si512(qc, _mm512_set1_epi32(2)), 30)));
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_EQ_OQ), victor_x_mm512_xor_ps(_mm512_mask_blend_ps(_mm512_test_epi32_mask(q, _mm512_set1_epi32(1)), ps, pc), _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_and_si512(q, _mm512_set1_epi32(2)), 30))), x);
+  }
+
+  static inline __m512 victor_x_mm512_sin_fast_ps(__m512 x) {
+    const __m512i q = _mm512_cvt_roundps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(0.636619772367581343f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m512 qf = _mm512_cvtepi32_ps(q);
+    const __m512 r = victor_x_mm512_fnmadd_ps(qf, _mm512_set1_ps(4.83826794896619e-4f), victor_x_mm512_fnmadd_ps(qf, _mm512_set1_ps(1.5703125f), x));
+    const __m512 z = _mm512_mul_ps(r, r);
+    __m512 ps = _mm512_set1_ps(8.163281716E-3f);
+    __m512 pc = _mm512_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm512_fmadd_ps(_mm512_mul_ps(ps, z), r, r);
+    pc = victor_x_mm512_fmadd_ps(_mm512_mul_ps(pc, z), z, victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), _mm512_set1_ps(1.0f)));
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_EQ_OQ), victor_x_mm512_xor_ps(_mm512_mask_blend_ps(_mm512_test_epi32_mask(q, _mm512_set1_epi32(1)), ps, pc), _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_and_si512(q, _mm512_set1_epi32(2)), 30))), x);
+  }
+
+  static inline __m512 victor_x_mm512_cos_fast_ps(__m512 x) {
+    const __m512i q = _mm512_cvt_roundps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(0.636619772367581343f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m512 qf = _mm512_cvtepi32_ps(q);
+    const __m512 r = victor_x_mm512_fnmadd_ps(qf, _mm512_set1_ps(4.83826794896619e-4f), victor_x_mm512_fnmadd_ps(qf, _mm512_set1_ps(1.5703125f), x));
+    const __m512i qc = _mm512_add_epi32(q, _mm512_set1_epi32(1));
+    const __m512 z = _mm512_mul_ps(r, r);
+    __m512 ps = _mm512_set1_ps(8.163281716E-3f);
+    __m512 pc = _mm512_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm512_fmadd_ps(_mm512_mul_ps(ps, z), r, r);
+    pc = victor_x_mm512_fmadd_ps(_mm512_mul_ps(pc, z), z, victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), _mm512_set1_ps(1.0f)));
+    return victor_x_mm512_xor_ps(_mm512_mask_blend_ps(_mm512_test_epi32_mask(qc, _mm512_set1_epi32(1)), ps, pc), _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_and_si512(qc, _mm512_set1_epi32(2)), 30)));
+  }
+
+  static inline __m512 victor_x_mm512_sincos_fast_ps(__m512 x, __m512* c) {
+    const __m512i q = _mm512_cvt_roundps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(0.636619772367581343f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    const __m512 qf = _mm512_cvtepi32_ps(q);
+    const __m512 r = victor_x_mm512_fnmadd_ps(qf, _mm512_set1_ps(4.83826794896619e-4f), victor_x_mm512_fnmadd_ps(qf, _mm512_set1_ps(1.5703125f), x));
+    const __m512i qc = _mm512_add_epi32(q, _mm512_set1_epi32(1));
+    const __m512 z = _mm512_mul_ps(r, r);
+    __m512 ps = _mm512_set1_ps(8.163281716E-3f);
+    __m512 pc = _mm512_set1_ps(-1.364871394E-3f);
+    ps = victor_x_mm512_fmadd_ps(ps, z, _mm512_set1_ps(-1.666339040E-1f));
+    pc = victor_x_mm512_fmadd_ps(pc, z, _mm512_set1_ps(4.166107252E-2f));
+    ps = victor_x_mm512_fmadd_ps(_mm512_mul_ps(ps, z), r, r);
+    pc = victor_x_mm512_fmadd_ps(_mm512_mul_ps(pc, z), z, victor_x_mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), _mm512_set1_ps(1.0f)));
+    *c = victor_x_mm512_xor_ps(_mm512_mask_blend_ps(_mm512_test_epi32_mask(qc, _mm512_set1_epi32(1)), ps, pc), _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_and_si512(qc, _mm512_set1_epi32(2)), 30)));
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_EQ_OQ), victor_x_mm512_xor_ps(_mm512_mask_blend_ps(_mm512_test_epi32_mask(q, _mm512_set1_epi32(1)), ps, pc), _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_and_si512(q, _mm512_set1_epi32(2)), 30))), x);
+  }
+
+  static inline __m512 victor_x_mm512_tanh_ps(__m512 x) {
+    const __m512 ax = victor_x_mm512_andnot_ps(_mm512_set1_ps(-0.0f), x);
+    const __m512 z = _mm512_mul_ps(x, x);
+    const __m512 e = victor_x_mm512_exp_ps(_mm512_add_ps(ax, ax));
+    const __m512 t = _mm512_sub_ps(_mm512_set1_ps(1.0f), _mm512_div_ps(_mm512_set1_ps(2.0f), _mm512_add_ps(e, _mm512_set1_ps(1.0f))));
+    __m512 p = _mm512_set1_ps(-5.70498872745E-3f);
+    p = victor_x_mm512_fmadd_ps(p, z, _mm512_set1_ps(2.06390887954E-2f));
+    p = victor_x_mm512_fmadd_ps(p, z, _mm512_set1_ps(-5.37397155531E-2f));
+    p = victor_x_mm512_fmadd_ps(p, z, _mm512_set1_ps(1.33314422036E-1f));
+    p = victor_x_mm512_fmadd_ps(p, z, _mm512_set1_ps(-3.33332819422E-1f));
+    p = victor_x_mm512_fmadd_ps(_mm512_mul_ps(p, z), ax, ax);
+    return victor_x_mm512_or_ps(_mm512_mask_blend_ps(_mm512_cmp_ps_mask(ax, _mm512_set1_ps(0.625f), _CMP_LT_OQ), t, p), victor_x_mm512_and_ps(x, _mm512_set1_ps(-0.0f)));
+  }
+
+  static inline __m512 victor_x_mm512_tanh_fast_ps(__m512 x) {
+    const __m512 ax = victor_x_mm512_andnot_ps(_mm512_set1_ps(-0.0f), x);
+    const __m512 z = _mm512_mul_ps(x, x);
+    const __m512 e = victor_x_mm512_exp_fast_ps(_mm512_add_ps(ax, ax));
+    const __m512 t = _mm512_sub_ps(_mm512_set1_ps(1.0f), _mm512_div_ps(_mm512_set1_ps(2.0f), _mm512_add_ps(e, _mm512_set1_ps(1.0f))));
+    __m512 p = _mm512_set1_ps(1.519537345E-2f);
+    p = victor_x_mm512_fmadd_ps(p, z, _mm512_set1_ps(-5.194790289E-2f));
+    p = victor_x_mm512_fmadd_ps(p, z, _mm512_set1_ps(1.330817491E-1f));
+    p = victor_x_mm512_fmadd_ps(p, z, _mm512_set1_ps(-3.333234191E-1f));
+    p = victor_x_mm512_fmadd_ps(_mm512_mul_ps(p, z), ax, ax);
+    return victor_x_mm512_or_ps(_mm512_mask_blend_ps(_mm512_cmp_ps_mask(ax, _mm512_set1_ps(0.625f), _CMP_LT_OQ), t, p), victor_x_mm512_and_ps(x, _mm512_set1_ps(-0.0f)));
+  }
+
+  static inline __m512d victor_x_mm512_pow_log2_pd(__m512d x) {
+    const __m512i bits = _mm512_add_epi64(_mm512_castpd_si512(x), _mm512_set1_epi64(INT64_C(0x00095f619980c433)));
+    const __m512d e = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_srli_epi64(bits, 52), _mm512_set1_epi64(INT64_C(0x4330000000000000)))), _mm512_set1_pd(4503599627371519.0));
+    const __m512d m = _mm512_castsi512_pd(_mm512_add_epi64(_mm512_and_si512(bits, _mm512_set1_epi64(INT64_C(0x000fffffffffffff))), _mm512_set1_epi64(INT64_C(0x3fe6a09e667f3bcd))));
+    const __m512d s = _mm512_div_pd(_mm512_sub_pd(m, _mm512_set1_pd(1.0)), _mm512_add_pd(m, _mm512_set1_pd(1.0)));
+    const __m512d z = _mm512_mul_pd(s, s);
+    __m512d l = _mm512_set1_pd(0.26230818925253879);
+    l = victor_x_mm512_fmadd_pd(l, z, _mm512_set1_pd(0.3205988979753252));
+    l = victor_x_mm512_fmadd_pd(l, z, _mm512_set1_pd(0.41219858311113244));
+    l = victor_x_mm512_fmadd_pd(l, z, _mm512_set1_pd(0.57707801635558531));
+    l = victor_x_mm512_fmadd_pd(l, z, _mm512_set1_pd(0.96179669392597567));
+    l = victor_x_mm512_fmadd_pd(l, z, _mm512_set1_pd(2.8853900817779268));
+    return victor_x_mm512_fmadd_pd(l, s, e);
+  }
+
+  static inline __m512d victor_x_mm512_pow_exp2_pd(__m512d t) {
+    const __m512d k = _mm512_add_pd(t, _mm512_set1_pd(6755399441055744.0));
+    const __m512d r = _mm512_sub_pd(t, _mm512_sub_pd(k, _mm512_set1_pd(6755399441055744.0)));
+    __m512d p = _mm512_set1_pd(1.0178086009239696e-07);
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(1.3215486790144305e-06));
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(1.5252733804059838e-05));
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(0.00015403530393381606));
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(0.0013333558146428441));
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(0.0096181291076284769));
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(0.055504108664821576));
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(0.24022650695910069));
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(0.69314718055994529));
+    p = victor_x_mm512_fmadd_pd(p, r, _mm512_set1_pd(1.0));
+    return _mm512_mul_pd(p, _mm512_castsi512_pd(_mm512_slli_epi64(_mm512_add_epi64(_mm512_castpd_si512(k), _mm512_set1_epi64(INT64_C(1023))), 52)));
+  }
+
+  static inline __m512d victor_x_mm512_pow_core_pd(__m512d x, __m512d y) {
+    return victor_x_mm512_pow_exp2_pd(_mm512_max_pd(_mm512_set1_pd(-200.0), _mm512_min_pd(_mm512_set1_pd(200.0), _mm512_mul_pd(victor_x_mm512_pow_log2_pd(x), y))));
+  }
+
+  static inline __m512 victor_x_mm512_pow_ps(__m512 x, __m512 y) {
+    const __m512 ax = victor_x_mm512_andnot_ps(_mm512_set1_ps(-0.0f), x);
+    const __m512 ay = victor_x_mm512_andnot_ps(_mm512_set1_ps(-0.0f), y);
+    __m512 r = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(victor_x_mm512_pow_core_pd(_mm512_cvtps_pd(_mm512_castps512_ps256(ax)), _mm512_cvtps_pd(_mm512_castps512_ps256(y)))))), _mm256_castps_pd(_mm512_cvtpd_ps(victor_x_mm512_pow_core_pd(_mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(ax), 1))), _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(y), 1)))))), 1));
+    const __m512i yi = _mm512_cvttps_epi32(y);
+    const __mmask16 yint = _mm512_cmp_ps_mask(_mm512_cvtepi32_ps(yi), y, _CMP_EQ_OQ);
+    const __mmask16 odd = _mm512_kand(yint, _mm512_test_epi32_mask(yi, _mm512_set1_epi32(1)));
+    const __mmask16 even = _mm512_kandn(odd, _mm512_kor(yint, _mm512_cmp_ps_mask(ay, _mm512_set1_ps(16777216.0f), _CMP_GE_OQ)));
+    const __mmask16 zero = _mm512_cmp_ps_mask(ax, _mm512_set1_ps(0.0f), _CMP_EQ_OQ);
+    const __mmask16 inf = _mm512_cmp_ps_mask(ax, _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_EQ_OQ);
+    const __mmask16 huge = _mm512_kor(_mm512_kand(zero, _mm512_cmp_ps_mask(y, _mm512_set1_ps(0.0f), _CMP_LT_OQ)), _mm512_kand(inf, _mm512_cmp_ps_mask(y, _mm512_set1_ps(0.0f), _CMP_GT_OQ)));
+    const __mmask16 one = _mm512_kor(_mm512_kor(_mm512_cmp_ps_mask(y, _mm512_set1_ps(0.0f), _CMP_EQ_OQ), _mm512_cmp_ps_mask(x, _mm512_set1_ps(1.0f), _CMP_EQ_OQ)), _mm512_kand(_mm512_cmp_ps_mask(ax, _mm512_set1_ps(1.0f), _CMP_EQ_OQ), _mm512_cmp_ps_mask(ay, _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000)), _CMP_EQ_OQ)));
+    r = _mm512_mask_blend_ps(_mm512_kor(zero, inf), r, _mm512_maskz_mov_ps(huge, _mm512_castsi512_ps(_mm512_set1_epi32(0x7f800000))));
+    r = victor_x_mm512_xor_ps(r, _mm512_maskz_mov_ps(odd, victor_x_mm512_and_ps(x, _mm512_set1_ps(-0.0f))));
+    r = _mm512_mask_blend_ps(_mm512_kor(_mm512_cmp_ps_mask(x, y, _CMP_UNORD_Q), _mm512_kandn(_mm512_kor(odd, even), _mm512_kandn(inf, _mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_LT_OQ)))), r, _mm512_castsi512_ps(_mm512_set1_epi32(0x7fc00000)));
+    return _mm512_mask_blend_ps(one, r, _mm512_set1_ps(1.0f));
+  }
+
+  static inline __m512 victor_x_mm512_pow_fast_ps(__m512 x, __m512 y) {
+    return victor_x_mm512_exp2_fast_ps(_mm512_mul_ps(y, victor_x_mm512_log2_fast_ps(x)));
+  }
+#endif /* defined(VICTOR_ENABLE_AVX512F) */
+
+#if defined(VICTOR_ENABLE_CXX_API)
+  VICTOR_X_BEGIN_NAMESPACE
+    namespace math {
+    #if defined(VICTOR_ENABLE_SSE2)
+      inline f32x4 sqrt(f32x4 x) VICTOR_NOEXCEPT { return f32x4(_mm_sqrt_ps(x.to_native())); }
+      inline f32x4 sqrt_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_sqrt_fast_ps(x.to_native())); }
+      inline f32x4 rsqrt(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_rsqrt_ps(x.to_native())); }
+      inline f32x4 rsqrt_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(_mm_rsqrt_ps(x.to_native())); }
+      inline f32x4 rcp(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_rcp_ps(x.to_native())); }
+      inline f32x4 rcp_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(_mm_rcp_ps(x.to_native())); }
+      inline f32x4 exp(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_exp_ps(x.to_native())); }
+      inline f32x4 exp_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_exp_fast_ps(x.to_native())); }
+      inline f32x4 exp2(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_exp2_ps(x.to_native())); }
+      inline f32x4 exp2_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_exp2_fast_ps(x.to_native())); }
+      inline f32x4 log(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_log_ps(x.to_native())); }
+      inline f32x4 log_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_log_fast_ps(x.to_native())); }
+      inline f32x4 log2(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_log2_ps(x.to_native())); }
+      inline f32x4 log2_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_log2_fast_ps(x.to_native())); }
+      inline f32x4 sin(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_sin_ps(x.to_native())); }
+      inline f32x4 sin_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_sin_fast_ps(x.to_native())); }
+      inline f32x4 cos(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_cos_ps(x.to_native())); }
+      inline f32x4 cos_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_cos_fast_ps(x.to_native())); }
+      inline f32x4 tanh(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_tanh_ps(x.to_native())); }
+      inline f32x4 tanh_fast(f32x4 x) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_tanh_fast_ps(x.to_native())); }
+      inline void sincos(f32x4& s, f32x4& c, f32x4 x) VICTOR_NOEXCEPT {
+        __m128 cn;
+        s = f32x4(victor_x_mm_sincos_ps(x.to_native(), &cn));
+        c = f32x4(cn);
+      }
+      inline void sincos_fast(f32x4& s, f32x4& c, f32x4 x) VICTOR_NOEXCEPT {
+        __m128 cn;
+        s = f32x4(victor_x_mm_sincos_fast_ps(x.to_native(), &cn));
+        c = f32x4(cn);
+      }
+      inline f32x4 pow(f32x4 x, f32x4 y) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_pow_ps(x.to_native(), y.to_native())); }
+      inline f32x4 pow_fast(f32x4 x, f32x4 y) VICTOR_NOEXCEPT { return f32x4(victor_x_mm_pow_fast_ps(x.to_native(), y.to_native())); }
+    #endif /* defined(VICTOR_ENABLE_SSE2) */
+
+    #if defined(VICTOR_ENABLE_AVX2)
+      inline f32x8 sqrt(f32x8 x) VICTOR_NOEXCEPT { return f32x8(_mm256_sqrt_ps(x.to_native())); }
+      inline f32x8 sqrt_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_sqrt_fast_ps(x.to_native())); }
+      inline f32x8 rsqrt(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_rsqrt_ps(x.to_native())); }
+      inline f32x8 rsqrt_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(_mm256_rsqrt_ps(x.to_native())); }
+      inline f32x8 rcp(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_rcp_ps(x.to_native())); }
+      inline f32x8 rcp_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(_mm256_rcp_ps(x.to_native())); }
+      inline f32x8 exp(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_exp_ps(x.to_native())); }
+      inline f32x8 exp_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_exp_fast_ps(x.to_native())); }
+      inline f32x8 exp2(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_exp2_ps(x.to_native())); }
+      inline f32x8 exp2_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_exp2_fast_ps(x.to_native())); }
+      inline f32x8 log(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_log_ps(x.to_native())); }
+      inline f32x8 log_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_log_fast_ps(x.to_native())); }
+      inline f32x8 log2(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_log2_ps(x.to_native())); }
+      inline f32x8 log2_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_log2_fast_ps(x.to_native())); }
+      inline f32x8 sin(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_sin_ps(x.to_native())); }
+      inline f32x8 sin_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_sin_fast_ps(x.to_native())); }
+      inline f32x8 cos(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_cos_ps(x.to_native())); }
+      inline f32x8 cos_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_cos_fast_ps(x.to_native())); }
+      inline f32x8 tanh(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_tanh_ps(x.to_native())); }
+      inline f32x8 tanh_fast(f32x8 x) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_tanh_fast_ps(x.to_native())); }
+      inline void sincos(f32x8& s, f32x8& c, f32x8 x) VICTOR_NOEXCEPT {
+        __m256 cn;
+        s = f32x8(victor_x_mm256_sincos_ps(x.to_native(), &cn));
+        c = f32x8(cn);
+      }
+      inline void sincos_fast(f32x8& s, f32x8& c, f32x8 x) VICTOR_NOEXCEPT {
+        __m256 cn;
+        s = f32x8(victor_x_mm256_sincos_fast_ps(x.to_native(), &cn));
+        c = f32x8(cn);
+      }
+      inline f32x8 pow(f32x8 x, f32x8 y) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_pow_ps(x.to_native(), y.to_native())); }
+      inline f32x8 pow_fast(f32x8 x, f32x8 y) VICTOR_NOEXCEPT { return f32x8(victor_x_mm256_pow_fast_ps(x.to_native(), y.to_native())); }
+    #endif /* defined(VICTOR_ENABLE_AVX2) */
+
+    #if defined(VICTOR_ENABLE_AVX512F)
+      inline f32x16 sqrt(f32x16 x) VICTOR_NOEXCEPT { return f32x16(_mm512_sqrt_ps(x.to_native())); }
+      inline f32x16 sqrt_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_sqrt_fast_ps(x.to_native())); }
+      inline f32x16 rsqrt(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_rsqrt_ps(x.to_native())); }
+      inline f32x16 rsqrt_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(_mm512_rsqrt14_ps(x.to_native())); }
+      inline f32x16 rcp(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_rcp_ps(x.to_native())); }
+      inline f32x16 rcp_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(_mm512_rcp14_ps(x.to_native())); }
+      inline f32x16 exp(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_exp_ps(x.to_native())); }
+      inline f32x16 exp_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_exp_fast_ps(x.to_native())); }
+      inline f32x16 exp2(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_exp2_ps(x.to_native())); }
+      inline f32x16 exp2_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_exp2_fast_ps(x.to_native())); }
+      inline f32x16 log(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_log_ps(x.to_native())); }
+      inline f32x16 log_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_log_fast_ps(x.to_native())); }
+      inline f32x16 log2(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_log2_ps(x.to_native())); }
+      inline f32x16 log2_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_log2_fast_ps(x.to_native())); }
+      inline f32x16 sin(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_sin_ps(x.to_native())); }
+      inline f32x16 sin_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_sin_fast_ps(x.to_native())); }
+      inline f32x16 cos(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_cos_ps(x.to_native())); }
+      inline f32x16 cos_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_cos_fast_ps(x.to_native())); }
+      inline f32x16 tanh(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_tanh_ps(x.to_native())); }
+      inline f32x16 tanh_fast(f32x16 x) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_tanh_fast_ps(x.to_native())); }
+      inline void sincos(f32x16& s, f32x16& c, f32x16 x) VICTOR_NOEXCEPT {
+        __m512 cn;
+        s = f32x16(victor_x_mm512_sincos_ps(x.to_native(), &cn));
+        c = f32x16(cn);
+      }
+      inline void sincos_fast(f32x16& s, f32x16& c, f32x16 x) VICTOR_NOEXCEPT {
+        __m512 cn;
+        s = f32x16(victor_x_mm512_sincos_fast_ps(x.to_native(), &cn));
+        c = f32x16(cn);
+      }
+      inline f32x16 pow(f32x16 x, f32x16 y) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_pow_ps(x.to_native(), y.to_native())); }
+      inline f32x16 pow_fast(f32x16 x, f32x16 y) VICTOR_NOEXCEPT { return f32x16(victor_x_mm512_pow_fast_ps(x.to_native(), y.to_native())); }
+    #endif /* defined(VICTOR_ENABLE_AVX512F) */
+    }
+  VICTOR_X_END_NAMESPACE
+#endif /* defined(VICTOR_ENABLE_CXX_API) */
+
+#if defined(VICTOR_ENABLE_C_API)
+  #if defined(VICTOR_ENABLE_SSE2)
+    static inline victor_f32x4 victor_f32x4_sqrt(victor_f32x4 x) {
+      return victor_f32x4_from_native(_mm_sqrt_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_sqrt_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_sqrt_fast_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_rsqrt(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_rsqrt_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_rsqrt_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(_mm_rsqrt_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_rcp(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_rcp_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_rcp_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(_mm_rcp_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_exp(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_exp_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_exp_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_exp_fast_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_exp2(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_exp2_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_exp2_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_exp2_fast_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_log(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_log_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_log_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_log_fast_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_log2(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_log2_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_log2_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_log2_fast_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_sin(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_sin_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_sin_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_sin_fast_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_cos(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_cos_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_cos_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_cos_fast_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_tanh(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_tanh_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_tanh_fast(victor_f32x4 x) {
+      return victor_f32x4_from_native(victor_x_mm_tanh_fast_ps(victor_f32x4_to_native(x)));
+    }
+
+    static inline void victor_f32x4_sincos(victor_f32x4* s, victor_f32x4* c, victor_f32x4 x) {
+      __m128 cn;
+      *s = victor_f32x4_from_native(victor_x_mm_sincos_ps(victor_f32x4_to_native(x), &cn));
+      *c = victor_f32x4_from_native(cn);
+    }
+
+    static inline void victor_f32x4_sincos_fast(victor_f32x4* s, victor_f32x4* c, victor_f32x4 x) {
+      __m128 cn;
+      *s = victor_f32x4_from_native(victor_x_mm_sincos_fast_ps(victor_f32x4_to_native(x), &cn));
+      *c = victor_f32x4_from_native(cn);
+    }
+
+    static inline victor_f32x4 victor_f32x4_pow(victor_f32x4 x, victor_f32x4 y) {
+      return victor_f32x4_from_native(victor_x_mm_pow_ps(victor_f32x4_to_native(x), victor_f32x4_to_native(y)));
+    }
+
+    static inline victor_f32x4 victor_f32x4_pow_fast(victor_f32x4 x, victor_f32x4 y) {
+      return victor_f32x4_from_native(victor_x_mm_pow_fast_ps(victor_f32x4_to_native(x), victor_f32x4_to_native(y)));
+    }
+  #endif /* defined(VICTOR_ENABLE_SSE2) */
+
+  #if defined(VICTOR_ENABLE_AVX2)
+    static inline victor_f32x8 victor_f32x8_sqrt(victor_f32x8 x) {
+      return victor_f32x8_from_native(_mm256_sqrt_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_sqrt_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_sqrt_fast_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_rsqrt(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_rsqrt_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_rsqrt_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(_mm256_rsqrt_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_rcp(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_rcp_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_rcp_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(_mm256_rcp_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_exp(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_exp_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_exp_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_exp_fast_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_exp2(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_exp2_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_exp2_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_exp2_fast_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_log(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_log_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_log_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_log_fast_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_log2(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_log2_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_log2_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_log2_fast_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_sin(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_sin_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_sin_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_sin_fast_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_cos(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_cos_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_cos_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_cos_fast_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_tanh(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_tanh_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_tanh_fast(victor_f32x8 x) {
+      return victor_f32x8_from_native(victor_x_mm256_tanh_fast_ps(victor_f32x8_to_native(x)));
+    }
+
+    static inline void victor_f32x8_sincos(victor_f32x8* s, victor_f32x8* c, victor_f32x8 x) {
+      __m256 cn;
+      *s = victor_f32x8_from_native(victor_x_mm256_sincos_ps(victor_f32x8_to_native(x), &cn));
+      *c = victor_f32x8_from_native(cn);
+    }
+
+    static inline void victor_f32x8_sincos_fast(victor_f32x8* s, victor_f32x8* c, victor_f32x8 x) {
+      __m256 cn;
+      *s = victor_f32x8_from_native(victor_x_mm256_sincos_fast_ps(victor_f32x8_to_native(x), &cn));
+      *c = victor_f32x8_from_native(cn);
+    }
+
+    static inline victor_f32x8 victor_f32x8_pow(victor_f32x8 x, victor_f32x8 y) {
+      return victor_f32x8_from_native(victor_x_mm256_pow_ps(victor_f32x8_to_native(x), victor_f32x8_to_native(y)));
+    }
+
+    static inline victor_f32x8 victor_f32x8_pow_fast(victor_f32x8 x, victor_f32x8 y) {
+      return victor_f32x8_from_native(victor_x_mm256_pow_fast_ps(victor_f32x8_to_native(x), victor_f32x8_to_native(y)));
+    }
+  #endif /* defined(VICTOR_ENABLE_AVX2) */
+
+  #if defined(VICTOR_ENABLE_AVX512F)
+    static inline victor_f32x16 victor_f32x16_sqrt(victor_f32x16 x) {
+      return victor_f32x16_from_native(_mm512_sqrt_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_sqrt_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_sqrt_fast_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_rsqrt(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_rsqrt_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_rsqrt_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(_mm512_rsqrt14_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_rcp(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_rcp_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_rcp_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(_mm512_rcp14_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_exp(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_exp_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_exp_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_exp_fast_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_exp2(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_exp2_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_exp2_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_exp2_fast_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_log(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_log_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_log_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_log_fast_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_log2(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_log2_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_log2_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_log2_fast_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_sin(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_sin_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_sin_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_sin_fast_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_cos(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_cos_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_cos_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_cos_fast_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_tanh(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_tanh_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_tanh_fast(victor_f32x16 x) {
+      return victor_f32x16_from_native(victor_x_mm512_tanh_fast_ps(victor_f32x16_to_native(x)));
+    }
+
+    static inline void victor_f32x16_sincos(victor_f32x16* s, victor_f32x16* c, victor_f32x16 x) {
+      __m512 cn;
+      *s = victor_f32x16_from_native(victor_x_mm512_sincos_ps(victor_f32x16_to_native(x), &cn));
+      *c = victor_f32x16_from_native(cn);
+    }
+
+    static inline void victor_f32x16_sincos_fast(victor_f32x16* s, victor_f32x16* c, victor_f32x16 x) {
+      __m512 cn;
+      *s = victor_f32x16_from_native(victor_x_mm512_sincos_fast_ps(victor_f32x16_to_native(x), &cn));
+      *c = victor_f32x16_from_native(cn);
+    }
+
+    static inline victor_f32x16 victor_f32x16_pow(victor_f32x16 x, victor_f32x16 y) {
+      return victor_f32x16_from_native(victor_x_mm512_pow_ps(victor_f32x16_to_native(x), victor_f32x16_to_native(y)));
+    }
+
+    static inline victor_f32x16 victor_f32x16_pow_fast(victor_f32x16 x, victor_f32x16 y) {
+      return victor_f32x16_from_native(victor_x_mm512_pow_fast_ps(victor_f32x16_to_native(x), victor_f32x16_to_native(y)));
+    }
+  #endif /* defined(VICTOR_ENABLE_AVX512F) */
+#endif /* defined(VICTOR_ENABLE_C_API) */
+
+#endif /* !defined(VICTOR_VMATH_H) */